@@ -5,26 +5,7 @@
 #include <iostream>
 #include <vector>
 
-/**
- * 插入排序算法实现
- * @param arr 待排序的整型数组
- */
-void insertionSort(std::vector<int>& arr) {
-    int n = arr.size();
-    // 从第二个元素开始遍历（索引为1）
-    for (int i = 1; i < n; i++) {
-        int key = arr[i];  // 当前要插入的元素
-        int j = i - 1;     // 已排序部分的最后一个元素索引
-        
-        // 将大于key的元素向后移动
-        while (j >= 0 && arr[j] > key) {
-            arr[j + 1] = arr[j];
-            j = j - 1;
-        }
-        // 将key插入到正确位置
-        arr[j + 1] = key;
-    }
-}
+#include "InsertionSort.h"
 
 /**
  * 打印数组元素
@@ -0,0 +1,47 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#ifndef CLRS_C1_U2_INSERTION_SORT_H
+#define CLRS_C1_U2_INSERTION_SORT_H
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+/**
+ * 对子数组 arr[low..high] 做插入排序
+ * 小规模子数组上常数因子很小，内省排序等混合算法用它处理递归底层
+ * @param arr 待排序的数组
+ * @param low 起始索引
+ * @param high 结束索引（包含）
+ * @param comp 比较器，comp(a, b) 为 true 表示 a 应排在 b 之前
+ */
+template<typename T, typename Compare = std::less<T>>
+void insertionSort(std::vector<T>& arr, int low, int high, Compare comp = Compare()) {
+    // 从第二个元素开始遍历
+    for (int i = low + 1; i <= high; i++) {
+        T key = std::move(arr[i]);  // 当前要插入的元素
+        int j = i - 1;              // 已排序部分的最后一个元素索引
+        
+        // 将大于key的元素向后移动
+        while (j >= low && comp(key, arr[j])) {
+            arr[j + 1] = std::move(arr[j]);
+            j = j - 1;
+        }
+        // 将key插入到正确位置
+        arr[j + 1] = std::move(key);
+    }
+}
+
+/**
+ * 插入排序算法实现
+ * @param arr 待排序的数组
+ * @param comp 比较器，comp(a, b) 为 true 表示 a 应排在 b 之前
+ */
+template<typename T, typename Compare = std::less<T>>
+void insertionSort(std::vector<T>& arr, Compare comp = Compare()) {
+    insertionSort(arr, 0, (int)arr.size() - 1, comp);
+}
+
+#endif //CLRS_C1_U2_INSERTION_SORT_H
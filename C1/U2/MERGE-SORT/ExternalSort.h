@@ -0,0 +1,282 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#ifndef CLRS_C1_U2_EXTERNAL_SORT_H
+#define CLRS_C1_U2_EXTERNAL_SORT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "C1/U2/MERGE-SORT/LoserTree.h"
+#include "C1/U2/MERGE-SORT/MergeSort.h"
+#include "common/Trace.h"
+
+// 默认内存预算：64 MiB
+inline constexpr size_t kExternalSortMemoryBudget = size_t(1) << 26;
+
+// 归并阶段每一路读缓冲的目标大小，决定了内存预算下能同时归并的路数
+inline constexpr size_t kExternalSortBlockBytes = size_t(1) << 16;
+
+/**
+ * 外部排序的统计信息
+ */
+struct ExternalSortStats {
+    size_t records = 0;      // 记录总数
+    size_t runs = 0;         // 第一阶段生成的有序段个数
+    size_t fanIn = 0;        // 每次归并的最大路数
+    size_t mergePasses = 0;  // 归并的趟数（包括最后写入输出文件的一趟）
+};
+
+/**
+ * 按块读取一个二进制文件中的记录，对外表现为一个"当前元素"可前进的有序输入
+ */
+template<typename T>
+class RunReader {
+public:
+    RunReader(const std::filesystem::path& path, size_t blockRecords)
+            : in_(path, std::ios::binary), block_(std::max<size_t>(1, blockRecords)) {
+        if (!in_) {
+            throw std::runtime_error("Cannot open run file: " + path.string());
+        }
+        refill();
+    }
+
+    /**
+     * 当前元素，已读完时返回 nullptr
+     */
+    const T* head() const {
+        return pos_ < count_ ? &block_[pos_] : nullptr;
+    }
+
+    void advance() {
+        if (++pos_ == count_) {
+            refill();
+        }
+    }
+
+private:
+    void refill() {
+        in_.read(reinterpret_cast<char*>(block_.data()), (std::streamsize)(block_.size() * sizeof(T)));
+        if (in_.bad() || in_.gcount() % (std::streamsize)sizeof(T) != 0) {
+            throw std::runtime_error("Corrupted run file");
+        }
+        count_ = (size_t)in_.gcount() / sizeof(T);
+        pos_ = 0;
+    }
+
+    std::ifstream in_;
+    std::vector<T> block_;
+    size_t pos_ = 0;
+    size_t count_ = 0;
+};
+
+/**
+ * 带缓冲地向二进制文件追加记录
+ * 缓冲区在第一次 push 时才分配，只用 write 整段写出时不占用额外内存
+ */
+template<typename T>
+class RunWriter {
+public:
+    RunWriter(const std::filesystem::path& path, size_t blockRecords)
+            : out_(path, std::ios::binary | std::ios::trunc), capacity_(std::max<size_t>(1, blockRecords)) {
+        if (!out_) {
+            throw std::runtime_error("Cannot create file: " + path.string());
+        }
+    }
+
+    void push(const T& x) {
+        if (block_.empty()) {
+            block_.reserve(capacity_);
+        }
+        block_.push_back(x);
+        if (block_.size() == capacity_) {
+            flush();
+        }
+    }
+
+    /**
+     * 不经过缓冲区，直接写出一段连续的记录（缓冲区中已有的记录先写出）
+     * @param data 记录的起始地址
+     * @param count 记录条数
+     * @throws std::runtime_error 写入失败（例如磁盘已满）
+     */
+    void write(const T* data, size_t count) {
+        flush();
+        writeRecords(data, count);
+    }
+
+    /**
+     * 写出缓冲区中的全部记录
+     * @throws std::runtime_error 写入失败（例如磁盘已满）
+     */
+    void flush() {
+        writeRecords(block_.data(), block_.size());
+        block_.clear();
+    }
+
+    void close() {
+        flush();
+        out_.close();
+    }
+
+private:
+    void writeRecords(const T* data, size_t count) {
+        out_.write(reinterpret_cast<const char*>(data), (std::streamsize)(count * sizeof(T)));
+        if (!out_) {
+            throw std::runtime_error("Write failed");
+        }
+    }
+
+    std::ofstream out_;
+    size_t capacity_;
+    std::vector<T> block_;
+};
+
+/**
+ * 用败者树把若干个有序段文件归并成一个文件
+ * 有序段按在输入中的先后顺序排列，相等元素取编号小的段，因此归并是稳定的
+ */
+template<typename T, typename Compare>
+void mergeRunFiles(const std::vector<std::filesystem::path>& runs, const std::filesystem::path& output,
+                   size_t blockRecords, Compare comp) {
+    std::vector<RunReader<T>> readers;
+    readers.reserve(runs.size());
+    std::vector<const T*> heads;
+    for (const std::filesystem::path& run : runs) {
+        readers.emplace_back(run, blockRecords);
+        heads.push_back(readers.back().head());
+    }
+
+    RunWriter<T> writer(output, blockRecords);
+    if (readers.empty()) {
+        writer.close();
+        return;
+    }
+    LoserTree<T, Compare> tree(readers.size(), comp);
+    tree.build(heads);
+    while (!tree.empty()) {
+        RunReader<T>& reader = readers[tree.winner()];
+        writer.push(*reader.head());
+        reader.advance();
+        tree.replay(reader.head());
+    }
+    writer.close();
+}
+
+/**
+ * 外部归并排序：对超出内存的二进制记录文件排序（稳定）
+ *
+ * 1. 生成有序段：每次读入内存预算允许的记录（连同归并排序的缓冲区共占一半预算），
+ *    用 bottomUpMergeSort 排序后写成一个临时的有序段文件；
+ * 2. k 路归并：每一路只保留一个读缓冲，预算决定了同时归并的路数 k；
+ *    有序段多于 k 个时，先把每 k 个相邻的段归并成一个新段，直到不超过 k 个，
+ *    最后一趟用败者树归并写入输出文件。
+ * 临时文件放在 tempDir 下单独的子目录中，排序结束（包括抛出异常）后删除。
+ * @param input 输入文件，内容为若干条连续存放的 T
+ * @param output 输出文件，可以与输入文件相同
+ * @param memoryBudget 内存预算（字节）
+ * @param tempDir 临时文件目录，为空时使用系统临时目录
+ * @param comp 比较器
+ * @return 统计信息
+ * @throws std::runtime_error 文件无法打开、读写失败或输入长度不是 sizeof(T) 的整数倍
+ */
+template<typename T, typename Compare = std::less<T>>
+ExternalSortStats externalSort(const std::string& input, const std::string& output,
+                               size_t memoryBudget = kExternalSortMemoryBudget,
+                               const std::string& tempDir = "", Compare comp = Compare()) {
+    static_assert(std::is_trivially_copyable<T>::value, "externalSort requires trivially copyable records");
+    namespace fs = std::filesystem;
+
+    // 临时目录随对象析构删除，异常退出时也不会留下有序段文件
+    struct TempDirectory {
+        fs::path path;
+        ~TempDirectory() {
+            std::error_code ignored;
+            fs::remove_all(path, ignored);
+        }
+    } temp{(tempDir.empty() ? fs::temp_directory_path() : fs::path(tempDir)) /
+           ("clrs-external-sort-" + std::to_string(std::random_device()()))};
+    fs::create_directories(temp.path);
+    size_t nextRun = 0;
+    auto newRunPath = [&] { return temp.path / ("run-" + std::to_string(nextRun++) + ".bin"); };
+
+    ExternalSortStats stats;
+    const size_t chunkRecords = std::max<size_t>(1, memoryBudget / (2 * sizeof(T)));
+    // 预算中留出一块作为输出缓冲，其余每块对应一路输入，至少两路
+    const size_t blocks = memoryBudget / kExternalSortBlockBytes;
+    stats.fanIn = blocks > 3 ? blocks - 1 : 2;
+    const size_t blockRecords = std::max<size_t>(1, memoryBudget / ((stats.fanIn + 1) * sizeof(T)));
+    TRACE_SUMMARY("开始外部排序，每段记录数: " << chunkRecords << "，归并路数: " << stats.fanIn << std::endl);
+
+    // 第一阶段：生成有序段
+    std::vector<fs::path> runs;
+    {
+        std::ifstream in(input, std::ios::binary);
+        if (!in) {
+            throw std::runtime_error("Cannot open input file: " + input);
+        }
+        std::vector<T> chunk(chunkRecords);
+        std::vector<T> buffer(chunkRecords);
+        while (true) {
+            in.read(reinterpret_cast<char*>(chunk.data()), (std::streamsize)(chunkRecords * sizeof(T)));
+            if (in.bad() || in.gcount() % (std::streamsize)sizeof(T) != 0) {
+                throw std::runtime_error("Input size is not a multiple of the record size: " + input);
+            }
+            size_t count = (size_t)in.gcount() / sizeof(T);
+            if (count == 0) {
+                break;
+            }
+            chunk.resize(count);
+            bottomUpMergeSort(chunk, buffer, 0, count, comp);
+            // 排好序的整段直接写出，不再复制到写缓冲，峰值内存不超过预算
+            runs.push_back(newRunPath());
+            RunWriter<T> writer(runs.back(), blockRecords);
+            writer.write(chunk.data(), count);
+            writer.close();
+            stats.records += count;
+            chunk.resize(chunkRecords);
+        }
+    }
+    stats.runs = runs.size();
+    TRACE_STEP("  生成有序段 " << runs.size() << " 个，共 " << stats.records << " 条记录" << std::endl);
+
+    // 第二阶段：多趟归并，直到有序段不超过 fanIn 个
+    while (runs.size() > stats.fanIn) {
+        std::vector<fs::path> merged;
+        for (size_t first = 0; first < runs.size(); first += stats.fanIn) {
+            std::vector<fs::path> group(runs.begin() + first,
+                                        runs.begin() + std::min(runs.size(), first + stats.fanIn));
+            merged.push_back(newRunPath());
+            mergeRunFiles<T>(group, merged.back(), blockRecords, comp);
+            for (const fs::path& run : group) {
+                fs::remove(run);
+            }
+        }
+        runs.swap(merged);
+        stats.mergePasses++;
+        TRACE_STEP("  第 " << stats.mergePasses << " 趟归并后剩余有序段 " << runs.size() << " 个" << std::endl);
+    }
+
+    // 最后一趟写入临时文件再改名，输出文件与输入文件相同时也不会在读完之前被覆盖
+    fs::path result = newRunPath();
+    mergeRunFiles<T>(runs, result, blockRecords, comp);
+    stats.mergePasses++;
+    std::error_code renamed;
+    fs::rename(result, output, renamed);
+    if (renamed) {
+        // 跨文件系统时无法改名，退回复制
+        fs::copy_file(result, output, fs::copy_options::overwrite_existing);
+    }
+    return stats;
+}
+
+#endif //CLRS_C1_U2_EXTERNAL_SORT_H
@@ -0,0 +1,103 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#ifndef CLRS_C1_U2_LOSER_TREE_H
+#define CLRS_C1_U2_LOSER_TREE_H
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+/**
+ * 败者树，用于 k 路归并
+ *
+ * k 个叶子对应 k 个有序输入的当前元素，内部结点记录该处比赛的败者，tree_[0] 记录总的胜者。
+ * 胜者所在的输入前进一个元素后，只需沿它到根的路径与各结点的败者重赛一次，
+ * 每次取出最小元素的代价为 ⌈log k⌉ 次比较（堆需要约 2 log k 次）。
+ * 元素相等时编号较小的输入获胜，按输入编号归并即可保持稳定性。
+ *
+ * 用法：
+ *   LoserTree<int> tree(k);
+ *   tree.build(heads);               // heads[i] 指向第 i 路的当前元素，nullptr 表示已耗尽
+ *   while (!tree.empty()) {
+ *       size_t i = tree.winner();    // 当前最小元素所在的输入
+ *       ...输出第 i 路的当前元素，第 i 路前进...
+ *       tree.replay(next);           // next 为第 i 路新的当前元素，耗尽时为 nullptr
+ *   }
+ */
+template<typename T, typename Compare = std::less<T>>
+class LoserTree {
+public:
+    /**
+     * @param k 输入路数，至少为 1
+     * @param comp 比较器
+     */
+    explicit LoserTree(size_t k, Compare comp = Compare())
+            : k_(k), heads_(k, nullptr), tree_(k, 0), comp_(comp) {}
+
+    /**
+     * 用各路的当前元素建树
+     * @param heads heads[i] 指向第 i 路的当前元素，nullptr 表示该路已耗尽
+     */
+    void build(const std::vector<const T*>& heads) {
+        heads_ = heads;
+        // 结点 p 的子结点为 2p、2p+1，叶子位于 [k, 2k)，自底向上求出每个结点的胜者
+        std::vector<size_t> winners(2 * k_);
+        for (size_t p = 2 * k_ - 1; p >= k_; p--) {
+            winners[p] = p - k_;
+        }
+        for (size_t p = k_ - 1; p >= 1; p--) {
+            size_t a = winners[2 * p], b = winners[2 * p + 1];
+            winners[p] = beats(a, b) ? a : b;
+            tree_[p] = beats(a, b) ? b : a;
+        }
+        tree_[0] = k_ > 1 ? winners[1] : 0;
+    }
+
+    /**
+     * 当前胜者（最小元素）所在的输入编号
+     */
+    size_t winner() const {
+        return tree_[0];
+    }
+
+    /**
+     * 所有输入是否都已耗尽
+     */
+    bool empty() const {
+        return heads_[tree_[0]] == nullptr;
+    }
+
+    /**
+     * 胜者所在的输入前进后重赛
+     * @param head 该输入新的当前元素，耗尽时为 nullptr
+     */
+    void replay(const T* head) {
+        size_t w = tree_[0];
+        heads_[w] = head;
+        for (size_t p = (w + k_) / 2; p >= 1; p /= 2) {
+            if (beats(tree_[p], w)) {
+                std::swap(tree_[p], w);
+            }
+        }
+        tree_[0] = w;
+    }
+
+private:
+    // 输入 a 的当前元素是否排在输入 b 之前：耗尽的输入总是落败，相等时编号小的获胜
+    bool beats(size_t a, size_t b) const {
+        if (heads_[b] == nullptr) return heads_[a] != nullptr || a < b;
+        if (heads_[a] == nullptr) return false;
+        if (comp_(*heads_[a], *heads_[b])) return true;
+        if (comp_(*heads_[b], *heads_[a])) return false;
+        return a < b;
+    }
+
+    size_t k_;
+    std::vector<const T*> heads_;
+    std::vector<size_t> tree_;  // tree_[0] 为胜者，tree_[1..k) 为各内部结点的败者
+    Compare comp_;
+};
+
+#endif //CLRS_C1_U2_LOSER_TREE_H
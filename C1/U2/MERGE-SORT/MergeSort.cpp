@@ -0,0 +1,130 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "ExternalSort.h"
+#include "MergeSort.h"
+
+/**
+ * 打印数组元素
+ * @param arr 要打印的数组
+ * @param msg 打印信息
+ */
+void printArray(const std::vector<int>& arr, const std::string& msg = "") {
+    if (!msg.empty()) {
+        std::cout << msg;
+    }
+    for (size_t i = 0; i < arr.size(); i++) {
+        std::cout << arr[i] << " ";
+    }
+    std::cout << std::endl;
+}
+
+/**
+ * 学生记录，用于演示稳定性
+ */
+struct Student {
+    int score;
+    std::string name;
+};
+
+std::ostream& operator<<(std::ostream& os, const Student& s) {
+    return os << s.score << "(" << s.name << ")";
+}
+
+/**
+ * 生成 n 个伪随机数
+ */
+std::vector<int> pseudoRandom(size_t n, int mod) {
+    std::vector<int> arr(n);
+    unsigned int seed = 12345;
+    for (int& x : arr) {
+        seed = seed * 1103515245 + 12345;
+        x = (seed >> 16) % mod;
+    }
+    return arr;
+}
+
+/**
+ * 主函数，用于测试归并排序算法
+ */
+int main() {
+#ifdef ACM_LOCAL
+    freopen("data.in", "r", stdin);
+    freopen("data.out", "w", stdout);
+#endif
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "      自底向上归并排序算法演示" << std::endl;
+    std::cout << "========================================" << std::endl << std::endl;
+
+    std::vector<int> arr = pseudoRandom(40, 100);
+    printArray(arr, "排序前: ");
+    mergeSort(arr);
+    printArray(arr, "排序后: ");
+
+    // 稳定性：按成绩排序，成绩相同的学生保持原来的先后顺序
+    std::cout << std::endl << "稳定性演示（按成绩排序）:" << std::endl;
+    std::vector<Student> students = {
+            {85, "张三"}, {92, "李四"}, {85, "王五"}, {78, "赵六"}, {92, "钱七"}, {85, "孙八"}};
+    mergeSort(students, [](const Student& a, const Student& b) { return a.score < b.score; });
+    for (const Student& s : students) {
+        std::cout << "  " << s.score << " " << s.name << std::endl;
+    }
+
+    std::cout << std::endl << "========================================" << std::endl;
+    std::cout << "      并行归并排序算法演示" << std::endl;
+    std::cout << "========================================" << std::endl << std::endl;
+
+    // 粒度取 64，使 1000 个元素也会被分块并行归并
+    std::vector<int> large = pseudoRandom(1000, 1000);
+    std::vector<int> buffer;
+    WorkStealingPool pool(4);
+    parallelMergeSort(pool, large, buffer, std::less<int>(), 64);
+    printArray(std::vector<int>(large.begin(), large.begin() + 20), "排序后（前20个）: ");
+    std::cout << "是否有序: " << (std::is_sorted(large.begin(), large.end()) ? "是" : "否") << std::endl;
+
+    // 复用上面的缓冲区（此时比数组长）排序 129 个元素，排序后长度不变
+    std::vector<int> small = pseudoRandom(129, 1000);
+    buffer.resize(263);
+    parallelMergeSort(pool, small, buffer, std::less<int>(), 64);
+    std::cout << "复用长度为 263 的缓冲区排序 129 个元素，排序后长度: " << small.size()
+              << "，是否有序: " << (std::is_sorted(small.begin(), small.end()) ? "是" : "否") << std::endl;
+
+    std::cout << std::endl << "========================================" << std::endl;
+    std::cout << "      外部归并排序算法演示" << std::endl;
+    std::cout << "========================================" << std::endl << std::endl;
+
+    // 10000 个 int 写入临时文件，内存预算只有 1 KiB，需要多趟归并
+    const std::filesystem::path file = std::filesystem::temp_directory_path() / "clrs-merge-sort-demo.bin";
+    std::vector<int> records = pseudoRandom(10000, 100000);
+    {
+        std::ofstream out(file, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(records.data()), (std::streamsize)(records.size() * sizeof(int)));
+    }
+    ExternalSortStats stats = externalSort<int>(file.string(), file.string(), 1024);
+    std::cout << "记录数: " << stats.records << std::endl;
+    std::cout << "有序段个数: " << stats.runs << std::endl;
+    std::cout << "归并路数: " << stats.fanIn << std::endl;
+    std::cout << "归并趟数: " << stats.mergePasses << std::endl;
+
+    std::vector<int> sorted(records.size());
+    {
+        std::ifstream in(file, std::ios::binary);
+        in.read(reinterpret_cast<char*>(sorted.data()), (std::streamsize)(sorted.size() * sizeof(int)));
+    }
+    std::filesystem::remove(file);
+    std::sort(records.begin(), records.end());
+    printArray(std::vector<int>(sorted.begin(), sorted.begin() + 20), "排序后（前20个）: ");
+    std::cout << "与 std::sort 结果一致: " << (sorted == records ? "是" : "否") << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,234 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#ifndef CLRS_C1_U2_MERGE_SORT_H
+#define CLRS_C1_U2_MERGE_SORT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include "C1/U2/INSERTION-SORT/InsertionSort.h"
+#include "common/Trace.h"
+#include "common/WorkStealingPool.h"
+
+// 自底向上归并前，先用插入排序把数组排成长度为该值的有序段
+inline constexpr size_t kMergeSortRunLength = 32;
+
+// 并行归并排序中，一个任务至少处理的元素个数
+inline constexpr size_t kParallelMergeGrain = 1 << 14;
+
+/**
+ * 稳定地归并 src[lo, mid) 与 src[mid, hi) 两个有序段，结果写入 dst[lo, hi)
+ * 两侧元素相等时先取左侧的，保证稳定性
+ * @param src 源数组
+ * @param dst 目标数组
+ * @param lo 左段起点
+ * @param mid 左段终点，也是右段起点
+ * @param hi 右段终点（不包含）
+ * @param comp 比较器
+ */
+template<typename T, typename Compare>
+void mergeRuns(const std::vector<T>& src, std::vector<T>& dst, size_t lo, size_t mid, size_t hi, Compare comp) {
+    // 左段的最大值不超过右段的最小值时两段已经有序，直接复制
+    if (lo == mid || mid == hi || !comp(src[mid], src[mid - 1])) {
+        std::copy(src.begin() + lo, src.begin() + hi, dst.begin() + lo);
+        return;
+    }
+    size_t i = lo, j = mid, k = lo;
+    while (i < mid && j < hi) {
+        dst[k++] = comp(src[j], src[i]) ? src[j++] : src[i++];
+    }
+    std::copy(src.begin() + i, src.begin() + mid, dst.begin() + k);
+    std::copy(src.begin() + j, src.begin() + hi, dst.begin() + k + (mid - i));
+}
+
+/**
+ * 自底向上的归并排序：对 arr[lo, hi) 排序，buffer[lo, hi) 作为归并的缓冲区
+ * 先用插入排序得到长度为 kMergeSortRunLength 的有序段，再逐轮把相邻两段归并，
+ * 每轮在 arr 与 buffer 之间交替读写，不再分配内存；结束时若结果位于 buffer 则复制回 arr
+ * @param arr 待排序数组
+ * @param buffer 缓冲区，长度不小于 hi
+ * @param lo 起点
+ * @param hi 终点（不包含）
+ * @param comp 比较器
+ */
+template<typename T, typename Compare>
+void bottomUpMergeSort(std::vector<T>& arr, std::vector<T>& buffer, size_t lo, size_t hi, Compare comp) {
+    for (size_t start = lo; start < hi; start += kMergeSortRunLength) {
+        insertionSort(arr, (int)start, (int)std::min(hi, start + kMergeSortRunLength) - 1, comp);
+    }
+
+    std::vector<T>* src = &arr;
+    std::vector<T>* dst = &buffer;
+    for (size_t width = kMergeSortRunLength; width < hi - lo; width *= 2) {
+        for (size_t left = lo; left < hi; left += 2 * width) {
+            size_t mid = std::min(hi, left + width);
+            size_t right = std::min(hi, left + 2 * width);
+            mergeRuns(*src, *dst, left, mid, right, comp);
+        }
+        TRACE_STEP("  段长 " << 2 * width << " 归并后: " << trace::range(*dst, lo, (long)hi - 1) << std::endl);
+        TRACE_COUNT("mergeSort.passes");
+        std::swap(src, dst);
+    }
+    if (src != &arr) {
+        std::copy(buffer.begin() + lo, buffer.begin() + hi, arr.begin() + lo);
+    }
+}
+
+/**
+ * 归并排序（自底向上，稳定）
+ * 缓冲区由调用者提供，多次排序之间可以复用，长度不足时自动扩展
+ * @param arr 待排序数组
+ * @param buffer 缓冲区
+ * @param comp 比较器
+ */
+template<typename T, typename Compare = std::less<T>>
+void mergeSort(std::vector<T>& arr, std::vector<T>& buffer, Compare comp = Compare()) {
+    if (arr.size() < 2) {
+        return;
+    }
+    if (buffer.size() < arr.size()) {
+        buffer.resize(arr.size());
+    }
+    TRACE_SUMMARY("开始归并排序..." << std::endl);
+    TRACE_STEP("原数组: " << trace::range(arr) << std::endl);
+    bottomUpMergeSort(arr, buffer, 0, arr.size(), comp);
+}
+
+/**
+ * 归并排序（自底向上，稳定），临时分配一个与 arr 等长的缓冲区
+ * @param arr 待排序数组
+ * @param comp 比较器
+ */
+template<typename T, typename Compare = std::less<T>>
+void mergeSort(std::vector<T>& arr, Compare comp = Compare()) {
+    std::vector<T> buffer;
+    mergeSort(arr, buffer, comp);
+}
+
+/**
+ * 归并路径划分：两个有序段 a[aLo, aHi)、b[bLo, bHi) 稳定归并后的前 k 个元素中，有多少个来自 a
+ * 在 a 上二分查找满足 a[i-1] ≤ b[j] 且 b[j-1] < a[i]（j = k - i）的 i，
+ * 按各划分点切开后，每一块可以独立归并，拼接起来与整体归并的结果相同
+ */
+template<typename T, typename Compare>
+size_t mergePathSplit(const std::vector<T>& a, size_t aLo, size_t aHi,
+                      const std::vector<T>& b, size_t bLo, size_t bHi, size_t k, Compare comp) {
+    size_t lo = k > bHi - bLo ? k - (bHi - bLo) : 0;
+    size_t hi = std::min(k, aHi - aLo);
+    while (lo < hi) {
+        size_t i = lo + (hi - lo) / 2;
+        size_t j = k - i;
+        // b[j-1] < a[i] 不成立，说明 a[i] 应排在前 k 个之内
+        if (!comp(b[bLo + j - 1], a[aLo + i])) {
+            lo = i + 1;
+        } else {
+            hi = i;
+        }
+    }
+    return lo;
+}
+
+/**
+ * 把 src[lo, mid) 与 src[mid, hi) 的归并切成若干块，作为独立任务提交给线程池
+ * 块数取决于输出长度与 pieceSize，每块各自用归并路径定出两侧的起止位置
+ */
+template<typename T, typename Compare>
+void submitParallelMerge(WorkStealingPool& pool, const std::vector<T>& src, std::vector<T>& dst,
+                         size_t lo, size_t mid, size_t hi, size_t pieceSize, Compare comp) {
+    const size_t n = hi - lo;
+    const size_t pieces = std::max<size_t>(1, (n + pieceSize - 1) / pieceSize);
+    for (size_t p = 0; p < pieces; p++) {
+        pool.submit([&src, &dst, lo, mid, hi, n, pieces, p, comp] {
+            size_t kBegin = n * p / pieces;
+            size_t kEnd = n * (p + 1) / pieces;
+            size_t iBegin = mergePathSplit(src, lo, mid, src, mid, hi, kBegin, comp);
+            size_t iEnd = mergePathSplit(src, lo, mid, src, mid, hi, kEnd, comp);
+            size_t jBegin = kBegin - iBegin;
+            size_t jEnd = kEnd - iEnd;
+
+            size_t i = lo + iBegin, iStop = lo + iEnd;
+            size_t j = mid + jBegin, jStop = mid + jEnd;
+            size_t k = lo + kBegin;
+            while (i < iStop && j < jStop) {
+                dst[k++] = comp(src[j], src[i]) ? src[j++] : src[i++];
+            }
+            std::copy(src.begin() + i, src.begin() + iStop, dst.begin() + k);
+            std::copy(src.begin() + j, src.begin() + jStop, dst.begin() + k + (iStop - i));
+        });
+    }
+}
+
+/**
+ * 在给定线程池上做并行归并排序（稳定）
+ *
+ * 1. 数组切成若干块，各线程用 bottomUpMergeSort 排序自己的块；
+ * 2. 逐轮归并相邻的块。后几轮中段数少于线程数，单个归并也要并行：
+ *    用归并路径把输出切成等长的几段，每段对应两侧各一个连续区间，彼此独立。
+ * @param pool 工作窃取线程池
+ * @param arr 待排序数组
+ * @param buffer 缓冲区，调整为与 arr 等长，结束后内容未定义（可能与 arr 交换了存储），可以反复使用
+ * @param comp 比较器
+ * @param grain 每个任务至少处理的元素个数
+ */
+template<typename T, typename Compare = std::less<T>>
+void parallelMergeSort(WorkStealingPool& pool, std::vector<T>& arr, std::vector<T>& buffer,
+                       Compare comp = Compare(), size_t grain = kParallelMergeGrain) {
+    const size_t n = arr.size();
+    if (n < 2) {
+        return;
+    }
+    // 结果最后留在 buffer 中时与 arr 交换，buffer 必须恰好为 n 个元素，否则 arr 的长度会被改变
+    buffer.resize(n);
+
+    const size_t chunks = std::max<size_t>(1, std::min(pool.size(), n / grain));
+    const size_t chunkSize = (n + chunks - 1) / chunks;
+    TRACE_SUMMARY("开始并行归并排序，线程数: " << pool.size() << "，分块数: " << chunks << std::endl);
+
+    for (size_t c = 0; c < chunks; c++) {
+        pool.submit([&arr, &buffer, c, chunkSize, n, comp] {
+            bottomUpMergeSort(arr, buffer, c * chunkSize, std::min(n, (c + 1) * chunkSize), comp);
+        });
+    }
+    pool.wait();
+
+    // 每轮的输出切成约 pool.size() 块，但每块不少于 grain 个元素
+    const size_t pieceSize = std::max(grain, (n + pool.size() - 1) / pool.size());
+    std::vector<T>* src = &arr;
+    std::vector<T>* dst = &buffer;
+    for (size_t width = chunkSize; width < n; width *= 2) {
+        for (size_t left = 0; left < n; left += 2 * width) {
+            size_t mid = std::min(n, left + width);
+            size_t right = std::min(n, left + 2 * width);
+            submitParallelMerge(pool, *src, *dst, left, mid, right, pieceSize, comp);
+        }
+        pool.wait();
+        TRACE_COUNT("parallelMergeSort.passes");
+        std::swap(src, dst);
+    }
+    if (src != &arr) {
+        arr.swap(buffer);
+    }
+}
+
+/**
+ * 并行归并排序（稳定）
+ * @param arr 待排序数组
+ * @param threads 线程数（包括调用线程），0 表示使用硬件线程数，1 即顺序排序
+ * @param comp 比较器
+ */
+template<typename T, typename Compare = std::less<T>>
+void parallelMergeSort(std::vector<T>& arr, size_t threads = 0, Compare comp = Compare()) {
+    std::vector<T> buffer;
+    if (threads == 1) {
+        mergeSort(arr, buffer, comp);
+        return;
+    }
+    WorkStealingPool pool(threads);
+    parallelMergeSort(pool, arr, buffer, comp);
+}
+
+#endif //CLRS_C1_U2_MERGE_SORT_H
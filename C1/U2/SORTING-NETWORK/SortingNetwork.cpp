@@ -0,0 +1,95 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "SortingNetwork.h"
+
+/**
+ * 打印数组元素
+ * @param arr 要打印的数组
+ * @param msg 打印信息
+ */
+template<typename T>
+void printArray(const std::vector<T>& arr, const std::string& msg = "") {
+    if (!msg.empty()) {
+        std::cout << msg;
+    }
+    for (size_t i = 0; i < arr.size(); i++) {
+        std::cout << arr[i] << " ";
+    }
+    std::cout << std::endl;
+}
+
+/**
+ * 指令集名称
+ */
+const char* simdLevelName(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::AVX2:  return "AVX2";
+        case SimdLevel::SSE41: return "SSE4.1";
+        default:               return "无（插入排序）";
+    }
+}
+
+/**
+ * 主函数，用于测试排序网络
+ */
+int main() {
+#ifdef ACM_LOCAL
+    freopen("data.in", "r", stdin);
+    freopen("data.out", "w", stdout);
+#endif
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "      SIMD排序网络演示" << std::endl;
+    std::cout << "========================================" << std::endl << std::endl;
+    std::cout << "当前使用的指令集: " << simdLevelName(detectSimdLevel()) << std::endl << std::endl;
+
+    // 恰好8个元素：一个AVX2寄存器内完成
+    std::vector<int> arr = {5, 2, 4, 6, 1, 3, 8, 7};
+    printArray(arr, "排序前: ");
+    sortingNetworkSort(arr.data(), arr.size());
+    printArray(arr, "排序后: ");
+    std::cout << std::endl;
+
+    // 13个元素：补齐到16个，多出的位置填最大值
+    std::vector<int> odd = {31, -4, 15, 9, 26, -5, 3, 58, 97, 9, 32, -38, 46};
+    printArray(odd, "排序前（13个）: ");
+    smallSort(odd, 0, (int)odd.size() - 1);
+    printArray(odd, "排序后（13个）: ");
+    std::cout << std::endl;
+
+    std::vector<float> reals = {0.5f, -1.25f, 3.0f, 2.75f, -0.5f, 1.0f, 9.5f, -3.0f,
+                                4.25f, 0.0f, 7.5f, -2.0f, 6.0f, 1.5f, -7.25f, 2.0f};
+    printArray(reals, "排序前（float）: ");
+    smallSort(reals, 0, (int)reals.size() - 1);
+    printArray(reals, "排序后（float）: ");
+    std::cout << std::endl;
+
+    // 含 ±∞ 的10个float：补齐到16个，填充值为 +∞，不会替换掉输入中的 +∞
+    const float inf = std::numeric_limits<float>::infinity();
+    std::vector<float> infinite = {3.5f, inf, -1.0f, -inf, 2.25f, inf, 0.0f, -7.5f, 1.0f, -inf};
+    printArray(infinite, "排序前（含±∞）: ");
+    smallSort(infinite, 0, (int)infinite.size() - 1);
+    printArray(infinite, "排序后（含±∞）: ");
+    std::cout << std::endl;
+
+    // 64个元素：网络能处理的最大规模
+    std::vector<int> large(64);
+    unsigned int seed = 12345;
+    for (int& x : large) {
+        seed = seed * 1103515245 + 12345;
+        x = (seed >> 16) % 1000;
+    }
+    sortingNetworkSort(large.data(), large.size());
+    printArray(std::vector<int>(large.begin(), large.begin() + 16), "64个元素排序后（前16个）: ");
+    std::cout << "是否有序: " << (std::is_sorted(large.begin(), large.end()) ? "是" : "否") << std::endl;
+
+    return 0;
+}
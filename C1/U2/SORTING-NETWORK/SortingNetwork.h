@@ -0,0 +1,325 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#ifndef CLRS_C1_U2_SORTING_NETWORK_H
+#define CLRS_C1_U2_SORTING_NETWORK_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "C1/U2/INSERTION-SORT/InsertionSort.h"
+
+// 只在 x86 上的 GCC / Clang 中启用 SIMD 内核：用 target 属性单独编译各指令集版本，运行时按 CPU 选择
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define CLRS_SORTING_NETWORK_SIMD 1
+#include <immintrin.h>
+#else
+#define CLRS_SORTING_NETWORK_SIMD 0
+#endif
+
+/**
+ * 运行时检测到的 SIMD 指令集
+ */
+enum class SimdLevel {
+    Scalar,  // 不使用 SIMD，退回插入排序
+    SSE41,   // 128 位寄存器，每个寄存器 4 个元素
+    AVX2     // 256 位寄存器，每个寄存器 8 个元素
+};
+
+/**
+ * 检测当前 CPU 支持的最高 SIMD 指令集，结果只计算一次
+ */
+inline SimdLevel detectSimdLevel() {
+#if CLRS_SORTING_NETWORK_SIMD
+    static const SimdLevel level = [] {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) return SimdLevel::AVX2;
+        if (__builtin_cpu_supports("sse4.1")) return SimdLevel::SSE41;
+        return SimdLevel::Scalar;
+    }();
+    return level;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+// 排序网络能处理的最大元素个数
+inline constexpr size_t kSortingNetworkMaxSize = 64;
+
+// 少于该个数时插入排序更快，不值得把数据装入寄存器
+inline constexpr size_t kSortingNetworkMinSize = 8;
+
+#if CLRS_SORTING_NETWORK_SIMD
+
+#define CLRS_TARGET_AVX2 __attribute__((target("avx2")))
+#define CLRS_TARGET_SSE41 __attribute__((target("sse4.1")))
+
+/**
+ * 各指令集的寄存器操作，寄存器一律按引用传递：
+ * 通用的网络代码不带 target 属性，按值传递向量会因调用约定不同而出错
+ *   W                    每个寄存器的元素个数
+ *   minMax(a, b)         逐元素比较交换，a 取较小值，b 取较大值
+ *   exchange<J, Mask>(v) 第 i 个元素与第 i ^ J 个元素比较，Mask 第 i 位为 1 时取较大值，否则取较小值
+ */
+struct Avx2Int32 {
+    using value_type = int32_t;
+    using reg = __m256i;
+    static constexpr int W = 8;
+
+    CLRS_TARGET_AVX2 static void load(reg& v, const int32_t* p) { v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    CLRS_TARGET_AVX2 static void store(int32_t* p, const reg& v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+
+    CLRS_TARGET_AVX2 static void minMax(reg& a, reg& b) {
+        reg lo = _mm256_min_epi32(a, b);
+        b = _mm256_max_epi32(a, b);
+        a = lo;
+    }
+
+    template<int J, int Mask>
+    CLRS_TARGET_AVX2 static void exchange(reg& v) {
+        reg p = _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(0 ^ J, 1 ^ J, 2 ^ J, 3 ^ J, 4 ^ J, 5 ^ J, 6 ^ J, 7 ^ J));
+        v = _mm256_blend_epi32(_mm256_min_epi32(v, p), _mm256_max_epi32(v, p), Mask);
+    }
+};
+
+/**
+ * float 按位模式转换成有序的 int32 键后复用整数网络：负数翻转除符号位以外的各位，
+ * 补码比较的结果与浮点比较一致，且 -0.0 < +0.0。min_ps / max_ps 遇到 ±0 时都返回第二个操作数，
+ * 会复制一个零、丢掉另一个；整数键是全序，比较交换后两个操作数都保留。
+ * 这一变换是对合的，存回时再做一次即可还原
+ */
+struct Avx2Float : Avx2Int32 {
+    using value_type = float;
+
+    CLRS_TARGET_AVX2 static reg orderedKey(const reg& v) {
+        return _mm256_xor_si256(v, _mm256_srli_epi32(_mm256_srai_epi32(v, 31), 1));
+    }
+
+    CLRS_TARGET_AVX2 static void load(reg& v, const float* p) {
+        v = orderedKey(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)));
+    }
+
+    CLRS_TARGET_AVX2 static void store(float* p, const reg& v) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), orderedKey(v));
+    }
+};
+
+struct Sse41Int32 {
+    using value_type = int32_t;
+    using reg = __m128i;
+    static constexpr int W = 4;
+
+    CLRS_TARGET_SSE41 static void load(reg& v, const int32_t* p) { v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+    CLRS_TARGET_SSE41 static void store(int32_t* p, const reg& v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+
+    CLRS_TARGET_SSE41 static void minMax(reg& a, reg& b) {
+        reg lo = _mm_min_epi32(a, b);
+        b = _mm_max_epi32(a, b);
+        a = lo;
+    }
+
+    // 按 16 位粒度混合，每个 32 位元素对应掩码中的两位
+    template<int J, int Mask>
+    CLRS_TARGET_SSE41 static void exchange(reg& v) {
+        constexpr int wide = ((Mask & 1) ? 0x03 : 0) | ((Mask & 2) ? 0x0C : 0) | ((Mask & 4) ? 0x30 : 0) | ((Mask & 8) ? 0xC0 : 0);
+        reg p = _mm_shuffle_epi32(v, _MM_SHUFFLE(3 ^ J, 2 ^ J, 1 ^ J, 0 ^ J));
+        v = _mm_blend_epi16(_mm_min_epi32(v, p), _mm_max_epi32(v, p), wide);
+    }
+};
+
+// 与 Avx2Float 相同，转换成有序的 int32 键后复用整数网络
+struct Sse41Float : Sse41Int32 {
+    using value_type = float;
+
+    CLRS_TARGET_SSE41 static reg orderedKey(const reg& v) {
+        return _mm_xor_si128(v, _mm_srli_epi32(_mm_srai_epi32(v, 31), 1));
+    }
+
+    CLRS_TARGET_SSE41 static void load(reg& v, const float* p) {
+        v = orderedKey(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+    }
+
+    CLRS_TARGET_SSE41 static void store(float* p, const reg& v) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p), orderedKey(v));
+    }
+};
+
+/**
+ * 寄存器内一次比较交换的混合掩码
+ * 第 l 个元素与第 l ^ j 个元素比较，升序段中位置较高的取较大值，降序段相反；
+ * k 小于寄存器宽度时升降序由元素位置决定，否则整个寄存器同为升序或降序（由 descending 给出）
+ */
+template<int W>
+constexpr int bitonicLaneMask(int j, int k, bool descending) {
+    int mask = 0;
+    for (int l = 0; l < W; l++) {
+        bool desc = k < W ? (l & k) != 0 : descending;
+        if (((l & j) != 0) != desc) mask |= 1 << l;
+    }
+    return mask;
+}
+
+/**
+ * 双调排序网络第 (k, j) 步中第 i 个寄存器上的比较交换：元素 e 与 e ^ j 比较，e & k 为 0 的段升序、否则降序
+ * j 不小于寄存器宽度时与第 i + j / W 个寄存器逐元素比较，否则在寄存器内部比较
+ */
+template<typename V, int k, int j, int i>
+inline void bitonicExchange(typename V::reg* r) {
+    constexpr int W = V::W;
+    constexpr bool descending = ((i * W) & k) != 0;
+    if constexpr (j >= W) {
+        constexpr int d = j / W;
+        if constexpr ((i & d) == 0) {
+            if constexpr (descending) {
+                V::minMax(r[i + d], r[i]);
+            } else {
+                V::minMax(r[i], r[i + d]);
+            }
+        }
+    } else {
+        V::template exchange<j, bitonicLaneMask<W>(j, k, descending)>(r[i]);
+    }
+}
+
+/**
+ * 双调排序网络从第 (k, j) 步到最后一步，全部在编译期展开
+ * @tparam V 寄存器操作
+ * @tparam K 寄存器个数，共排序 K * V::W 个元素
+ */
+template<typename V, int K, int k, int j, int... I>
+inline void bitonicStep(typename V::reg* r, std::integer_sequence<int, I...> registers) {
+    (bitonicExchange<V, k, j, I>(r), ...);
+    if constexpr (j > 1) {
+        bitonicStep<V, K, k, j / 2>(r, registers);
+    } else if constexpr (k < K * V::W) {
+        bitonicStep<V, K, k * 2, k>(r, registers);
+    }
+}
+
+/**
+ * 用双调排序网络对 K * V::W 个元素排序
+ */
+template<typename V, int K>
+inline void bitonicSortRegisters(typename V::value_type* data) {
+    typename V::reg r[K];
+    for (int i = 0; i < K; i++) V::load(r[i], data + i * V::W);
+    bitonicStep<V, K, 2, 1>(r, std::make_integer_sequence<int, K>());
+    for (int i = 0; i < K; i++) V::store(data + i * V::W, r[i]);
+}
+
+// 各指令集的入口：flatten 把整个网络内联进带 target 属性的函数，生成对应指令集的代码
+template<typename V, int K>
+__attribute__((target("avx2"), flatten)) void bitonicSortAvx2(typename V::value_type* data) {
+    bitonicSortRegisters<V, K>(data);
+}
+
+template<typename V, int K>
+__attribute__((target("sse4.1"), flatten)) void bitonicSortSse41(typename V::value_type* data) {
+    bitonicSortRegisters<V, K>(data);
+}
+
+/**
+ * 对恰好 size 个元素（size 为 8、16、32 或 64）运行对应指令集的网络
+ */
+template<typename Avx2, typename Sse41>
+void runSortingNetwork(typename Avx2::value_type* data, size_t size, SimdLevel level) {
+    if (level == SimdLevel::AVX2) {
+        switch (size) {
+            case 8:  bitonicSortAvx2<Avx2, 1>(data); return;
+            case 16: bitonicSortAvx2<Avx2, 2>(data); return;
+            case 32: bitonicSortAvx2<Avx2, 4>(data); return;
+            default: bitonicSortAvx2<Avx2, 8>(data); return;
+        }
+    }
+    switch (size) {
+        case 8:  bitonicSortSse41<Sse41, 2>(data); return;
+        case 16: bitonicSortSse41<Sse41, 4>(data); return;
+        case 32: bitonicSortSse41<Sse41, 8>(data); return;
+        default: bitonicSortSse41<Sse41, 16>(data); return;
+    }
+}
+
+#endif // CLRS_SORTING_NETWORK_SIMD
+
+/**
+ * 用 SIMD 排序网络对不超过 64 个 int32 或 float 排序
+ * 元素个数向上取到 8、16、32、64 之一，不足的部分用 float 的 +∞ 或 int32 的最大值填充；
+ * CPU 不支持 SSE4.1 / AVX2 时退回插入排序。float 中不能包含 NaN
+ * @param data 待排序的元素
+ * @param n 元素个数，不超过 kSortingNetworkMaxSize
+ */
+template<typename T>
+void sortingNetworkSort(T* data, size_t n) {
+    static_assert(std::is_same<T, int32_t>::value || std::is_same<T, float>::value,
+                  "sortingNetworkSort supports int32_t and float");
+#if CLRS_SORTING_NETWORK_SIMD
+    const SimdLevel level = detectSimdLevel();
+    if (level != SimdLevel::Scalar && n >= 2 && n <= kSortingNetworkMaxSize) {
+        using Avx2 = std::conditional_t<std::is_same<T, float>::value, Avx2Float, Avx2Int32>;
+        using Sse41 = std::conditional_t<std::is_same<T, float>::value, Sse41Float, Sse41Int32>;
+        size_t size = 8;
+        while (size < n) size *= 2;
+        if (size == n) {
+            runSortingNetwork<Avx2, Sse41>(data, size, level);
+            return;
+        }
+        // 填充值不能小于任何元素，否则排序后会混进前 n 个位置（float 用最大有限值会把 +∞ 换掉）
+        constexpr T pad = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
+                                                               : std::numeric_limits<T>::max();
+        T padded[kSortingNetworkMaxSize];
+        std::copy(data, data + n, padded);
+        std::fill(padded + n, padded + size, pad);
+        runSortingNetwork<Avx2, Sse41>(padded, size, level);
+        std::copy(padded, padded + n, data);
+        return;
+    }
+#endif
+    // 标量回退：直接在原地做插入排序
+    for (size_t i = 1; i < n; i++) {
+        T key = data[i];
+        size_t j = i;
+        while (j > 0 && key < data[j - 1]) {
+            data[j] = data[j - 1];
+            j--;
+        }
+        data[j] = key;
+    }
+}
+
+/**
+ * 元素类型与比较器能否使用排序网络：int32 或 float，且按默认的升序比较
+ */
+template<typename T, typename Compare>
+inline constexpr bool kUsesSortingNetwork =
+        (std::is_same<T, int32_t>::value || std::is_same<T, float>::value) &&
+        std::is_same<Compare, std::less<T>>::value;
+
+/**
+ * 小数组排序原语：对子数组 arr[low..high] 排序
+ * 满足 kUsesSortingNetwork 且元素个数在 [kSortingNetworkMinSize, kSortingNetworkMaxSize] 内时
+ * 使用 SIMD 排序网络，否则使用插入排序。快速排序、桶排序等算法在递归底层调用它
+ * @param arr 待排序的数组
+ * @param low 起始索引
+ * @param high 结束索引（包含）
+ * @param comp 比较器
+ */
+template<typename T, typename Compare = std::less<T>>
+void smallSort(std::vector<T>& arr, int low, int high, Compare comp = Compare()) {
+    if constexpr (kUsesSortingNetwork<T, Compare>) {
+        const size_t n = high >= low ? static_cast<size_t>(high - low + 1) : 0;
+        if (n >= kSortingNetworkMinSize && n <= kSortingNetworkMaxSize) {
+            sortingNetworkSort(arr.data() + low, n);
+            return;
+        }
+    }
+    insertionSort(arr, low, high, comp);
+}
+
+#endif //CLRS_C1_U2_SORTING_NETWORK_H
@@ -0,0 +1,243 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#ifndef CLRS_C2_U6_HEAP_SORT_H
+#define CLRS_C2_U6_HEAP_SORT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "common/Trace.h"
+
+/**
+ * 维护最大堆性质
+ * 堆顶是比较器意义下的最大元素，默认的 std::less 即为普通的最大堆
+ * @param arr 数组表示的堆
+ * @param heapSize 堆的大小
+ * @param i 需要维护节点的索引
+ * @param comp 比较器，comp(a, b) 为 true 表示 a 小于 b
+ * @param step 步骤编号，只在 STEP 级别下递增
+ */
+template<typename T, typename Compare>
+void maxHeapify(std::vector<T>& arr, int heapSize, int i, Compare comp, int& step) {
+    TRACE_STEP("第" << step << "步: 调整节点 " << i << ", 当前堆大小: " << heapSize << std::endl);
+    TRACE_STEP("  调整前: " << trace::range(arr, 0, heapSize - 1) << "| " << trace::range(arr, heapSize, (int)arr.size() - 1) << std::endl);
+    TRACE_STEP_EXEC(step++);
+    TRACE_COUNT("heapSort.heapifyCalls");
+
+    int largest = i;          // 初始化最大值为根节点
+    int left = 2 * i + 1;     // 左子节点
+    int right = 2 * i + 2;    // 右子节点
+
+    // 如果左子节点存在且大于根节点
+    if (left < heapSize && comp(arr[largest], arr[left]))
+        largest = left;
+
+    // 如果右子节点存在且大于当前最大值
+    if (right < heapSize && comp(arr[largest], arr[right]))
+        largest = right;
+
+    // 如果最大值不是根节点
+    if (largest != i) {
+        TRACE_STEP("  交换 arr[" << i << "]=" << arr[i] << " 和 arr[" << largest << "]=" << arr[largest] << std::endl);
+        TRACE_COUNT("heapSort.swaps");
+        std::swap(arr[i], arr[largest]);
+        // 递归地调整受影响的子树
+        maxHeapify(arr, heapSize, largest, comp, step);
+    } else {
+        TRACE_STEP("  节点 " << i << " 已满足最大堆性质，无需调整" << std::endl);
+    }
+    
+    TRACE_STEP("  调整后: " << trace::range(arr, 0, heapSize - 1) << "| " << trace::range(arr, heapSize, (int)arr.size() - 1) << std::endl << std::endl);
+}
+
+// 重载版本，不带step参数，步骤编号从 1 开始
+template<typename T, typename Compare = std::less<T>>
+void maxHeapify(std::vector<T>& arr, int heapSize, int i, Compare comp = Compare()) {
+    int step = 1;
+    maxHeapify(arr, heapSize, i, comp, step);
+}
+
+/**
+ * 构建最大堆
+ * @param arr 待构建堆的数组
+ * @param n 数组长度
+ * @param comp 比较器
+ */
+template<typename T, typename Compare = std::less<T>>
+void buildMaxHeap(std::vector<T>& arr, int n, Compare comp = Compare()) {
+    TRACE_SUMMARY("开始构建最大堆..." << std::endl);
+    TRACE_STEP("初始数组: " << trace::range(arr, 0, n - 1) << std::endl << std::endl);
+
+    // 从最后一个非叶子节点开始，自底向上构建最大堆
+    int step = 1;
+    for (int i = n / 2 - 1; i >= 0; i--) {
+        maxHeapify(arr, n, i, comp, step);
+    }
+    
+    TRACE_SUMMARY("最大堆构建完成!" << std::endl);
+    TRACE_STEP("最大堆: " << trace::range(arr, 0, n - 1) << std::endl << std::endl);
+}
+
+/**
+ * 堆排序算法实现
+ * @param arr 待排序的数组
+ * @param comp 比较器，排序后数组按 comp 意义下的升序排列
+ */
+template<typename T, typename Compare = std::less<T>>
+void heapSort(std::vector<T>& arr, Compare comp = Compare()) {
+    int n = arr.size();
+    TRACE_SUMMARY("开始执行堆排序算法..." << std::endl);
+    TRACE_SUMMARY("========================================" << std::endl);
+
+    // 构建最大堆
+    buildMaxHeap(arr, n, comp);
+
+    TRACE_SUMMARY("开始排序阶段..." << std::endl);
+    TRACE_SUMMARY("========================================" << std::endl);
+
+    // 逐个从堆顶取出元素
+    int step = 1;
+    for (int i = n - 1; i > 0; i--) {
+        TRACE_STEP("第 " << (n-i) << " 轮排序:" << std::endl);
+        TRACE_STEP("  交换堆顶元素 " << arr[0] << " 与末尾元素 " << arr[i] << std::endl);
+        // 将当前最大元素（堆顶）移到数组末尾
+        std::swap(arr[0], arr[i]);
+        
+        TRACE_STEP("  交换后: " << trace::range(arr, 0, i) << "| " << trace::range(arr, i + 1, n - 1) << " (已排序部分)" << std::endl);
+
+        // 对剩下的元素重新调整为最大堆
+        maxHeapify(arr, i, 0, comp, step);
+    }
+}
+
+/**
+ * 以 arr[base] 为堆顶的子堆上的迭代下沉
+ * 与 maxHeapify 逻辑相同，但不输出跟踪信息、不递归，供其他排序算法在子数组上复用
+ * @param arr 数组
+ * @param base 子堆在数组中的起始偏移
+ * @param heapSize 子堆大小
+ * @param i 需要维护节点在子堆内的索引
+ * @param comp 比较器
+ */
+template<typename T, typename Compare>
+void siftDown(std::vector<T>& arr, int base, int heapSize, int i, Compare comp) {
+    T value = std::move(arr[base + i]);
+    int child;
+    while ((child = 2 * i + 1) < heapSize) {
+        // 选出较大的子节点
+        if (child + 1 < heapSize && comp(arr[base + child], arr[base + child + 1]))
+            child++;
+        if (!comp(value, arr[base + child]))
+            break;
+        arr[base + i] = std::move(arr[base + child]);
+        i = child;
+    }
+    arr[base + i] = std::move(value);
+}
+
+/**
+ * 对子数组 arr[low..high] 做堆排序
+ * 内省排序在递归过深时退化到这里，保证最坏 O(n log n)
+ * @param arr 待排序的数组
+ * @param low 起始索引
+ * @param high 结束索引（包含）
+ * @param comp 比较器
+ */
+template<typename T, typename Compare = std::less<T>>
+void heapSort(std::vector<T>& arr, int low, int high, Compare comp = Compare()) {
+    int n = high - low + 1;
+    for (int i = n / 2 - 1; i >= 0; i--) {
+        siftDown(arr, low, n, i, comp);
+    }
+    for (int i = n - 1; i > 0; i--) {
+        TRACE_COUNT("heapSort.swaps");
+        std::swap(arr[low], arr[low + i]);
+        siftDown(arr, low, i, 0, comp);
+    }
+}
+
+/**
+ * d 叉堆上的自底向上（Floyd）下沉，以 arr[base] 为堆顶
+ * 普通的下沉每层先在 d 个子节点中选出最大者，再与被下沉的元素比较，共 d 次比较；
+ * Floyd 的做法先不与被下沉的元素比较，沿最大的子节点一路走到叶子（每层 d - 1 次比较），
+ * 再从叶子向上找到它的位置。堆排序中被下沉的总是原来的末尾元素，通常很小，向上只需很少几步。
+ * d 个子节点在数组中连续存放，d 取 4 或 8 时一次比较大小所需的子节点常常位于同一缓存行，
+ * 树高也降为 log_d n，访存次数随之减少
+ * @tparam D 堆的叉数
+ * @param arr 数组
+ * @param base 子堆在数组中的起始偏移
+ * @param heapSize 子堆大小
+ * @param i 需要维护节点在子堆内的索引
+ * @param comp 比较器
+ */
+template<int D, typename T, typename Compare>
+void bottomUpSiftDown(std::vector<T>& arr, size_t base, size_t heapSize, size_t i, Compare comp) {
+    static_assert(D >= 2, "heap arity must be at least 2");
+    T* heap = arr.data() + base;
+    T value = std::move(heap[i]);
+    const size_t top = i;
+
+    // 沿最大的子节点走到叶子，路径上的子节点依次上移一层
+    size_t child;
+    while ((child = D * i + 1) < heapSize) {
+        size_t best = child;
+        size_t last = std::min(child + D, heapSize);
+        for (size_t c = child + 1; c < last; c++) {
+            if (comp(heap[best], heap[c])) best = c;
+        }
+        heap[i] = std::move(heap[best]);
+        i = best;
+    }
+
+    // 从叶子向上，把比 value 小的祖先移回下一层
+    while (i > top) {
+        size_t parent = (i - 1) / D;
+        if (!comp(heap[parent], value)) break;
+        heap[i] = std::move(heap[parent]);
+        i = parent;
+    }
+    heap[i] = std::move(value);
+}
+
+/**
+ * d 叉堆排序：对子数组 arr[low..high] 排序
+ * 迭代实现，没有递归与跟踪输出；节点 i 的子节点为 d·i+1 … d·i+d
+ * @tparam D 堆的叉数，常用 2、4、8
+ * @param arr 待排序的数组
+ * @param low 起始索引
+ * @param high 结束索引（包含）
+ * @param comp 比较器
+ */
+template<int D = 4, typename T, typename Compare = std::less<T>>
+void dAryHeapSort(std::vector<T>& arr, int low, int high, Compare comp = Compare()) {
+    if (high <= low) {
+        return;
+    }
+    const size_t n = static_cast<size_t>(high - low) + 1;
+    for (size_t i = (n - 2) / D + 1; i-- > 0;) {
+        bottomUpSiftDown<D>(arr, low, n, i, comp);
+    }
+    for (size_t i = n - 1; i > 0; i--) {
+        std::swap(arr[low], arr[low + i]);
+        bottomUpSiftDown<D>(arr, low, i, 0, comp);
+    }
+}
+
+/**
+ * d 叉堆排序
+ * @tparam D 堆的叉数，常用 2、4、8
+ * @param arr 待排序的数组
+ * @param comp 比较器，排序后数组按 comp 意义下的升序排列
+ */
+template<int D = 4, typename T, typename Compare = std::less<T>>
+void dAryHeapSort(std::vector<T>& arr, Compare comp = Compare()) {
+    TRACE_SUMMARY("开始执行 " << D << " 叉堆排序..." << std::endl);
+    dAryHeapSort<D>(arr, 0, (int)arr.size() - 1, comp);
+}
+
+#endif //CLRS_C2_U6_HEAP_SORT_H
@@ -2,120 +2,13 @@
 // Created by HaPpY on 2025/12/7.
 //
 
+#include <climits>
 #include <iostream>
+#include <memory>
+#include <string>
 #include <vector>
-#include <climits>
-
-/**
- * 维护最大堆性质
- * @param arr 数组表示的堆
- * @param heapSize 堆的大小
- * @param i 需要维护节点的索引
- */
-void maxHeapify(std::vector<int>& arr, int heapSize, int i) {
-    int largest = i;          // 初始化最大值为根节点
-    int left = 2 * i + 1;     // 左子节点
-    int right = 2 * i + 2;    // 右子节点
-
-    // 如果左子节点存在且大于根节点
-    if (left < heapSize && arr[left] > arr[largest])
-        largest = left;
-
-    // 如果右子节点存在且大于当前最大值
-    if (right < heapSize && arr[right] > arr[largest])
-        largest = right;
-
-    // 如果最大值不是根节点
-    if (largest != i) {
-        std::swap(arr[i], arr[largest]);
-        // 递归地调整受影响的子树
-        maxHeapify(arr, heapSize, largest);
-    }
-}
-
-/**
- * 构建最大堆
- * @param arr 待构建堆的数组
- * @param n 数组长度
- */
-void buildMaxHeap(std::vector<int>& arr, int n) {
-    // 从最后一个非叶子节点开始，自底向上构建最大堆
-    for (int i = n / 2 - 1; i >= 0; i--)
-        maxHeapify(arr, n, i);
-}
 
-/**
- * 向最大堆中插入一个元素
- * @param arr 堆数组
- * @param key 要插入的元素
- */
-void heapInsert(std::vector<int>& arr, int& heapSize, int key) {
-    // 增加堆的大小
-    heapSize++;
-    if (heapSize > (int)arr.size()) {
-        arr.push_back(key);
-    } else {
-        arr[heapSize - 1] = key;
-    }
-    
-    // 保持最大堆性质
-    int i = heapSize - 1;
-    while (i > 0 && arr[(i - 1) / 2] < arr[i]) {
-        std::swap(arr[i], arr[(i - 1) / 2]);
-        i = (i - 1) / 2;
-    }
-}
-
-/**
- * 获取最大元素（堆顶元素）
- * @param arr 堆数组
- * @return 堆顶元素
- */
-int heapMaximum(const std::vector<int>& arr) {
-    if (arr.empty()) {
-        std::cerr << "堆为空" << std::endl;
-        return INT_MIN;
-    }
-    return arr[0];
-}
-
-/**
- * 提取并删除最大元素（堆顶元素）
- * @param arr 堆数组
- * @param heapSize 堆大小的引用
- * @return 堆顶元素
- */
-int heapExtractMax(std::vector<int>& arr, int& heapSize) {
-    if (heapSize < 1) {
-        std::cerr << "堆下溢" << std::endl;
-        return INT_MIN;
-    }
-    
-    int max = arr[0];
-    arr[0] = arr[heapSize - 1];
-    heapSize--;
-    maxHeapify(arr, heapSize, 0);
-    return max;
-}
-
-/**
- * 增加堆中某个元素的值
- * @param arr 堆数组
- * @param i 要增加元素的索引
- * @param key 新的键值
- */
-void heapIncreaseKey(std::vector<int>& arr, int i, int key) {
-    if (key < arr[i]) {
-        std::cerr << "新的键值比当前键值小" << std::endl;
-        return;
-    }
-    
-    arr[i] = key;
-    while (i > 0 && arr[(i - 1) / 2] < arr[i]) {
-        std::swap(arr[i], arr[(i - 1) / 2]);
-        i = (i - 1) / 2;
-    }
-}
+#include "PriorityQueue.h"
 
 /**
  * 打印数组元素
@@ -187,6 +80,57 @@ int main() {
     std::cout << "再次提取的最大元素: " << maxElement << std::endl;
     std::cout << "提取后优先队列: ";
     printArray(priorityQueue, heapSize);
+    std::cout << std::endl;
+    
+    // 索引优先队列：批量建堆，载荷是只能移动的 unique_ptr
+    std::vector<std::pair<int, std::unique_ptr<std::string>>> tasks;
+    tasks.emplace_back(3, std::make_unique<std::string>("写日志"));
+    tasks.emplace_back(9, std::make_unique<std::string>("处理请求"));
+    tasks.emplace_back(5, std::make_unique<std::string>("刷新缓存"));
+    tasks.emplace_back(1, std::make_unique<std::string>("统计报表"));
+    IndexedPriorityQueue<int, std::unique_ptr<std::string>> taskQueue(std::move(tasks));
+    std::cout << "索引优先队列批量建堆，堆顶任务: " << *taskQueue.topValue() << std::endl;
+    
+    // 句柄 3 是"统计报表"，把它的优先级提高到 10
+    taskQueue.increaseKey(3, 10);
+    std::cout << "提高\"统计报表\"的优先级后依次出队: ";
+    while (!taskQueue.empty()) {
+        std::pair<int, std::unique_ptr<std::string>> task = taskQueue.pop();
+        std::cout << *task.second << "(" << task.first << ") ";
+    }
+    std::cout << std::endl << std::endl;
+    
+    // 用 std::greater 得到最小堆，驱动 Dijkstra 最短路径：松弛时对句柄调用 increaseKey
+    std::vector<std::vector<std::pair<int, int>>> graph = {
+        {{1, 10}, {3, 5}},          // s
+        {{2, 1}, {3, 2}},           // t
+        {{4, 4}},                   // x
+        {{1, 3}, {2, 9}, {4, 2}},   // y
+        {{0, 7}, {2, 6}},           // z
+    };
+    const char* names = "stxyz";
+    IndexedPriorityQueue<int, int, std::greater<int>> frontier;
+    std::vector<IndexedPriorityQueue<int, int, std::greater<int>>::Handle> handles;
+    for (int v = 0; v < (int)graph.size(); v++) {
+        handles.push_back(frontier.push(v == 0 ? 0 : INT_MAX, v));
+    }
+    std::vector<int> dist(graph.size(), INT_MAX);
+    while (!frontier.empty()) {
+        std::pair<int, int> top = frontier.pop();
+        int u = top.second;
+        dist[u] = top.first;
+        for (const std::pair<int, int>& edge : graph[u]) {
+            int v = edge.first;
+            if (frontier.contains(handles[v]) && dist[u] + edge.second < frontier.key(handles[v])) {
+                frontier.increaseKey(handles[v], dist[u] + edge.second);
+            }
+        }
+    }
+    std::cout << "Dijkstra 最短路径（《算法导论》图24-6，源点 s）: ";
+    for (size_t v = 0; v < dist.size(); v++) {
+        std::cout << names[v] << "=" << dist[v] << " ";
+    }
+    std::cout << std::endl;
     
     return 0;
 }
\ No newline at end of file
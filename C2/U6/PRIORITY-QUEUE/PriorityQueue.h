@@ -0,0 +1,364 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#ifndef CLRS_C2_U6_PRIORITY_QUEUE_H
+#define CLRS_C2_U6_PRIORITY_QUEUE_H
+
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// 复用堆排序中的 MAX-HEAPIFY 和 BUILD-MAX-HEAP（《算法导论》6.2、6.3节）
+#include "C2/U6/HEAP-SORT/HeapSort.h"
+#include "common/Trace.h"
+
+/**
+ * 向最大堆中插入一个元素
+ * @param arr 堆数组
+ * @param heapSize 堆大小的引用
+ * @param key 要插入的元素
+ * @param comp 比较器，堆顶是比较器意义下的最大元素
+ */
+template<typename T, typename Compare = std::less<T>>
+void heapInsert(std::vector<T>& arr, int& heapSize, T key, Compare comp = Compare()) {
+    // 增加堆的大小
+    heapSize++;
+    if (heapSize > (int)arr.size()) {
+        arr.push_back(std::move(key));
+    } else {
+        arr[heapSize - 1] = std::move(key);
+    }
+    
+    // 保持最大堆性质
+    int i = heapSize - 1;
+    while (i > 0 && comp(arr[(i - 1) / 2], arr[i])) {
+        std::swap(arr[i], arr[(i - 1) / 2]);
+        i = (i - 1) / 2;
+    }
+}
+
+/**
+ * 获取最大元素（堆顶元素）
+ * @param arr 堆数组
+ * @return 堆顶元素
+ * @throws std::underflow_error 如果堆为空
+ */
+template<typename T>
+const T& heapMaximum(const std::vector<T>& arr) {
+    if (arr.empty()) {
+        throw std::underflow_error("Heap is empty");
+    }
+    return arr[0];
+}
+
+/**
+ * 提取并删除最大元素（堆顶元素）
+ * @param arr 堆数组
+ * @param heapSize 堆大小的引用
+ * @param comp 比较器
+ * @return 堆顶元素
+ * @throws std::underflow_error 如果堆为空
+ */
+template<typename T, typename Compare = std::less<T>>
+T heapExtractMax(std::vector<T>& arr, int& heapSize, Compare comp = Compare()) {
+    if (heapSize < 1) {
+        throw std::underflow_error("Heap underflow");
+    }
+    
+    T max = std::move(arr[0]);
+    heapSize--;
+    if (heapSize > 0) {
+        arr[0] = std::move(arr[heapSize]);
+        maxHeapify(arr, heapSize, 0, comp);
+    }
+    return max;
+}
+
+/**
+ * 增加堆中某个元素的值
+ * @param arr 堆数组
+ * @param i 要增加元素的索引
+ * @param key 新的键值
+ * @param comp 比较器
+ * @throws std::invalid_argument 如果新的键值比当前键值小
+ */
+template<typename T, typename Compare = std::less<T>>
+void heapIncreaseKey(std::vector<T>& arr, int i, T key, Compare comp = Compare()) {
+    if (comp(key, arr[i])) {
+        throw std::invalid_argument("New key is smaller than current key");
+    }
+    
+    arr[i] = std::move(key);
+    while (i > 0 && comp(arr[(i - 1) / 2], arr[i])) {
+        std::swap(arr[i], arr[(i - 1) / 2]);
+        i = (i - 1) / 2;
+    }
+}
+
+/**
+ * 带句柄的索引优先队列（最大堆）
+ *
+ * 堆顶是比较器意义下的最大元素；以 std::greater 作比较器即为最小堆，可用于 Dijkstra、Prim 等算法。
+ * 每个元素由一个关键字和一个载荷组成，插入时返回一个句柄，元素出队前句柄一直有效：
+ * - 堆数组只存放关键字与句柄，上浮、下沉时不移动载荷；载荷可以是只能移动的类型；
+ * - pos_ 记录每个句柄在堆数组中的位置，increaseKey、decreaseKey、erase 都是 O(log n)；
+ * - 出队后句柄被回收，之后插入的元素可能复用同一个句柄。
+ * increaseKey 与 decreaseKey 中的"增加""减小"都是比较器意义下的：
+ * 用 std::greater 的最小堆中，把距离改小要调用 increaseKey。
+ */
+template<typename Key, typename Value, typename Compare = std::less<Key>>
+class IndexedPriorityQueue {
+public:
+    using Handle = size_t;
+
+    explicit IndexedPriorityQueue(Compare comp = Compare()) : comp_(comp) {}
+
+    /**
+     * 批量建堆：元素按原顺序获得句柄 0..n-1，用 buildMaxHeap 在 O(n) 时间内建堆
+     * @param items 关键字与载荷
+     * @param comp 比较器
+     */
+    explicit IndexedPriorityQueue(std::vector<std::pair<Key, Value>> items, Compare comp = Compare()) : comp_(comp) {
+        heap_.reserve(items.size());
+        values_.reserve(items.size());
+        for (std::pair<Key, Value>& item : items) {
+            heap_.push_back(Node{std::move(item.first), values_.size()});
+            values_.push_back(std::move(item.second));
+        }
+        Compare keyComp = comp_;
+        buildMaxHeap(heap_, (int)heap_.size(),
+                     [keyComp](const Node& a, const Node& b) { return keyComp(a.key, b.key); });
+        pos_.resize(heap_.size());
+        for (size_t i = 0; i < heap_.size(); i++) {
+            pos_[heap_[i].handle] = i;
+        }
+    }
+
+    size_t size() const {
+        return heap_.size();
+    }
+
+    bool empty() const {
+        return heap_.empty();
+    }
+
+    /**
+     * 句柄对应的元素是否仍在队列中
+     */
+    bool contains(Handle h) const {
+        return h < pos_.size() && pos_[h] != kAbsent;
+    }
+
+    /**
+     * 插入一个元素
+     * @return 新元素的句柄
+     */
+    Handle push(Key key, Value value) {
+        Handle h;
+        if (!free_.empty()) {
+            h = free_.back();
+            free_.pop_back();
+            values_[h] = std::move(value);
+        } else {
+            h = values_.size();
+            values_.push_back(std::move(value));
+            pos_.push_back(kAbsent);
+        }
+        heap_.push_back(Node{std::move(key), h});
+        pos_[h] = heap_.size() - 1;
+        siftUp(heap_.size() - 1);
+        TRACE_COUNT("indexedPriorityQueue.pushes");
+        return h;
+    }
+
+    /**
+     * 堆顶元素的句柄
+     * @throws std::underflow_error 如果队列为空
+     */
+    Handle top() const {
+        if (heap_.empty()) {
+            throw std::underflow_error("Heap is empty");
+        }
+        return heap_[0].handle;
+    }
+
+    const Key& topKey() const {
+        return key(top());
+    }
+
+    const Value& topValue() const {
+        return values_[top()];
+    }
+
+    /**
+     * 取出堆顶元素，它的句柄随之失效
+     * @return 堆顶的关键字与载荷
+     * @throws std::underflow_error 如果队列为空
+     */
+    std::pair<Key, Value> pop() {
+        if (heap_.empty()) {
+            throw std::underflow_error("Heap underflow");
+        }
+        return removeAt(0);
+    }
+
+    /**
+     * 删除句柄对应的元素
+     * @return 被删除元素的关键字与载荷
+     * @throws std::out_of_range 如果句柄无效
+     */
+    std::pair<Key, Value> erase(Handle h) {
+        return removeAt(position(h));
+    }
+
+    const Key& key(Handle h) const {
+        return heap_[position(h)].key;
+    }
+
+    const Value& value(Handle h) const {
+        position(h);
+        return values_[h];
+    }
+
+    Value& value(Handle h) {
+        position(h);
+        return values_[h];
+    }
+
+    /**
+     * 把关键字改为更大的值（比较器意义下），元素向堆顶上浮，O(log n)
+     * @throws std::out_of_range 如果句柄无效
+     * @throws std::invalid_argument 如果新的关键字比当前关键字小
+     */
+    void increaseKey(Handle h, Key key) {
+        size_t i = position(h);
+        if (comp_(key, heap_[i].key)) {
+            throw std::invalid_argument("New key is smaller than current key");
+        }
+        heap_[i].key = std::move(key);
+        siftUp(i);
+        TRACE_COUNT("indexedPriorityQueue.increaseKeys");
+    }
+
+    /**
+     * 把关键字改为更小的值（比较器意义下），元素向下沉，O(log n)
+     * @throws std::out_of_range 如果句柄无效
+     * @throws std::invalid_argument 如果新的关键字比当前关键字大
+     */
+    void decreaseKey(Handle h, Key key) {
+        size_t i = position(h);
+        if (comp_(heap_[i].key, key)) {
+            throw std::invalid_argument("New key is larger than current key");
+        }
+        heap_[i].key = std::move(key);
+        siftDown(i);
+        TRACE_COUNT("indexedPriorityQueue.decreaseKeys");
+    }
+
+    /**
+     * 修改关键字，根据新旧关键字的大小上浮或下沉
+     * @throws std::out_of_range 如果句柄无效
+     */
+    void changeKey(Handle h, Key key) {
+        size_t i = position(h);
+        bool up = comp_(heap_[i].key, key);
+        heap_[i].key = std::move(key);
+        up ? siftUp(i) : siftDown(i);
+    }
+
+private:
+    // 堆数组中的结点：关键字与句柄放在一起，比较时不需要再查一次表
+    struct Node {
+        Key key;
+        Handle handle;
+
+        // STEP 级别的追踪输出 buildMaxHeap 的中间状态时打印关键字
+        friend std::ostream& operator<<(std::ostream& os, const Node& node) {
+            return os << node.key;
+        }
+    };
+
+    static constexpr size_t kAbsent = std::numeric_limits<size_t>::max();
+
+    size_t position(Handle h) const {
+        if (!contains(h)) {
+            throw std::out_of_range("Invalid priority queue handle");
+        }
+        return pos_[h];
+    }
+
+    /**
+     * 把 heap_[i] 移出堆：用最后一个结点填补空位，再上浮或下沉
+     */
+    std::pair<Key, Value> removeAt(size_t i) {
+        Handle h = heap_[i].handle;
+        std::pair<Key, Value> removed(std::move(heap_[i].key), std::move(values_[h]));
+        pos_[h] = kAbsent;
+        free_.push_back(h);
+
+        size_t last = heap_.size() - 1;
+        if (i != last) {
+            heap_[i] = std::move(heap_[last]);
+            pos_[heap_[i].handle] = i;
+        }
+        heap_.pop_back();
+        if (i < heap_.size()) {
+            if (i > 0 && comp_(heap_[(i - 1) / 2].key, heap_[i].key)) {
+                siftUp(i);
+            } else {
+                siftDown(i);
+            }
+        }
+        return removed;
+    }
+
+    /**
+     * 上浮：沿途的父结点依次下移一层，最后把结点放入空位，每层只写一次
+     */
+    void siftUp(size_t i) {
+        Node node = std::move(heap_[i]);
+        while (i > 0 && comp_(heap_[(i - 1) / 2].key, node.key)) {
+            size_t parent = (i - 1) / 2;
+            heap_[i] = std::move(heap_[parent]);
+            pos_[heap_[i].handle] = i;
+            i = parent;
+        }
+        heap_[i] = std::move(node);
+        pos_[heap_[i].handle] = i;
+    }
+
+    /**
+     * 下沉：较大的子结点依次上移一层，最后把结点放入空位
+     */
+    void siftDown(size_t i) {
+        const size_t n = heap_.size();
+        Node node = std::move(heap_[i]);
+        while (2 * i + 1 < n) {
+            size_t child = 2 * i + 1;
+            if (child + 1 < n && comp_(heap_[child].key, heap_[child + 1].key)) {
+                child++;
+            }
+            if (!comp_(node.key, heap_[child].key)) {
+                break;
+            }
+            heap_[i] = std::move(heap_[child]);
+            pos_[heap_[i].handle] = i;
+            i = child;
+        }
+        heap_[i] = std::move(node);
+        pos_[heap_[i].handle] = i;
+    }
+
+    std::vector<Node> heap_;      // 按堆序排列的结点
+    std::vector<Value> values_;   // values_[h] 为句柄 h 的载荷
+    std::vector<size_t> pos_;     // pos_[h] 为句柄 h 在 heap_ 中的位置，kAbsent 表示已出队
+    std::vector<Handle> free_;    // 可以复用的句柄
+    Compare comp_;
+};
+
+#endif //CLRS_C2_U6_PRIORITY_QUEUE_H
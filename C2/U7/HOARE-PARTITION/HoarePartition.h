@@ -0,0 +1,216 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#ifndef CLRS_C2_U7_HOARE_PARTITION_H
+#define CLRS_C2_U7_HOARE_PARTITION_H
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "C2/U7/QUICK-SORT/QuickSort.h"
+#include "common/Trace.h"
+
+/**
+ * 划分方案
+ */
+enum class PartitionScheme {
+    Hoare,  // 经典Hoare划分：双指针相向扫描，遇到逆序对立即交换
+    Block   // 块划分（BlockQuicksort）：先把比较结果写入偏移量缓冲区，再成批交换
+};
+
+// 块划分每次扫描的元素个数，偏移量用 unsigned char 存储，不能超过 256
+inline constexpr int kPartitionBlockSize = 64;
+
+/**
+ * Hoare划分算法实现
+ * 该算法由C.R.Hoare在1960年代初设计，是快速排序的原始划分方案
+ * @param arr 待划分的数组
+ * @param low 起始索引
+ * @param high 结束索引
+ * @param comp 比较器，comp(a, b) 为 true 表示 a 应排在 b 之前
+ * @return 分割点索引 j，满足 arr[low..j] <= 基准 <= arr[j+1..high]，且 low <= j < high
+ */
+template<typename T, typename Compare = std::less<T>>
+int hoarePartition(std::vector<T>& arr, int low, int high, Compare comp = Compare()) {
+    // 选择第一个元素作为基准
+    T pivot = arr[low];
+    int i = low - 1;  // 左指针
+    int j = high + 1; // 右指针
+
+    TRACE_STEP("  执行Hoare划分，范围: [" << low << ", " << high << "], 基准: " << pivot << std::endl);
+
+    while (true) {
+        // 从左边找到第一个大于等于pivot的元素
+        do {
+            i++;
+        } while (comp(arr[i], pivot));
+
+        // 从右边找到第一个小于等于pivot的元素
+        do {
+            j--;
+        } while (comp(pivot, arr[j]));
+
+        // 如果指针相遇或交错，则返回分割点
+        if (i >= j) {
+            TRACE_STEP("  划分完成，返回分割点: " << j << std::endl);
+            TRACE_COUNT("hoarePartition.partitions");
+            return j;
+        }
+
+        // 交换元素
+        TRACE_STEP("  交换 arr[" << i << "]=" << arr[i] << " 和 arr[" << j << "]=" << arr[j] << std::endl);
+        TRACE_COUNT("hoarePartition.swaps");
+        std::swap(arr[i], arr[j]);
+    }
+}
+
+/**
+ * 块划分的实现，基准为 arr[low]
+ *
+ * 左右两端各取一块，把"放错了一侧"的元素的块内偏移量写入缓冲区：
+ *   offsetsL[numL] = k; numL += !goesLeft(左块第k个元素);
+ * 写入总会发生、计数用比较结果直接累加，循环里没有依赖数据的分支。
+ * 两个缓冲区都非空时成批交换，哪一侧的缓冲区用完就把那一侧的块向中间推进。
+ * 剩余不足两块的部分退回逐个比较的划分。
+ *
+ * @param goesLeft goesLeft(x) 为 true 表示 x 应放在基准左侧
+ * @return 基准的最终位置
+ */
+template<typename T, typename Predicate>
+int blockPartitionWith(std::vector<T>& arr, int low, int high, Predicate goesLeft) {
+    constexpr int B = kPartitionBlockSize;
+    unsigned char offsetsL[B];
+    unsigned char offsetsR[B];
+    int first = low + 1;   // arr[low+1..first) 已确定在左侧
+    int last = high + 1;   // arr[last..high] 已确定在右侧
+    int numL = 0, numR = 0, startL = 0, startR = 0;
+
+    while (last - first > 2 * B) {
+        if (numL == 0) {
+            startL = 0;
+            for (int k = 0; k < B; k++) {
+                offsetsL[numL] = static_cast<unsigned char>(k);
+                numL += !goesLeft(arr[first + k]);
+            }
+        }
+        if (numR == 0) {
+            startR = 0;
+            for (int k = 0; k < B; k++) {
+                offsetsR[numR] = static_cast<unsigned char>(k);
+                numR += goesLeft(arr[last - 1 - k]);
+            }
+        }
+
+        int num = std::min(numL, numR);
+        TRACE_COUNT_ADD("blockPartition.swaps", num);
+        for (int k = 0; k < num; k++) {
+            std::swap(arr[first + offsetsL[startL + k]], arr[last - 1 - offsetsR[startR + k]]);
+        }
+        numL -= num;
+        numR -= num;
+        startL += num;
+        startR += num;
+        if (numL == 0) first += B;
+        if (numR == 0) last -= B;
+    }
+
+    // 未处理完的块仍在 [first, last) 内，与剩余元素一起逐个划分
+    int i = first;
+    for (int j = first; j < last; j++) {
+        if (goesLeft(arr[j])) {
+            std::swap(arr[i], arr[j]);
+            i++;
+        }
+    }
+    std::swap(arr[low], arr[i - 1]);
+    TRACE_COUNT("blockPartition.partitions");
+    return i - 1;
+}
+
+/**
+ * 块划分（BlockQuicksort，Edelkamp 与 Weiß）
+ * 以 arr[low] 为基准，小于基准的元素放到左侧，其余放到右侧，基准放到两者之间
+ * @param arr 待划分的数组
+ * @param low 起始索引
+ * @param high 结束索引
+ * @param comp 比较器
+ * @return 基准的最终位置 p，满足 arr[low..p-1] < arr[p] <= arr[p+1..high]
+ */
+template<typename T, typename Compare = std::less<T>>
+int blockPartition(std::vector<T>& arr, int low, int high, Compare comp = Compare()) {
+    TRACE_STEP("  执行块划分，范围: [" << low << ", " << high << "], 基准: " << arr[low] << std::endl);
+    const T& pivot = arr[low];  // 划分过程中 arr[low] 不会被移动
+    int p = blockPartitionWith(arr, low, high, [&](const T& x) { return comp(x, pivot); });
+    TRACE_STEP("  划分完成，基准位置: " << p << std::endl);
+    return p;
+}
+
+/**
+ * 使用Hoare或块划分的快速排序
+ * 基准按 choosePivot 取三数或九数中值并换到 arr[low]；只对较短的一侧递归，栈深度不超过 log n。
+ * 块划分把等于基准的元素都放到右侧，重复键很多时会反复切出空的左侧；
+ * 因此当基准等于左邻元素（上一层的基准，不大于本段所有元素）时，
+ * 改为把所有等于基准的元素一次性放到左侧并跳过
+ * @param arr 待排序数组
+ * @param low 起始索引
+ * @param high 结束索引
+ * @param scheme 划分方案
+ * @param comp 比较器
+ * @param leftmost 本段是否位于整个数组的最左侧（即没有左邻元素）
+ */
+template<typename T, typename Compare>
+void hoareQuickSort(std::vector<T>& arr, int low, int high, PartitionScheme scheme, Compare comp, bool leftmost) {
+    while (low < high) {
+        TRACE_STEP("处理范围: [" << low << ", " << high << "]" << std::endl);
+        TRACE_STEP("  当前子数组: " << trace::range(arr, low, high) << std::endl);
+
+        std::swap(arr[low], arr[choosePivot(arr, low, high, comp)]);
+
+        int leftHigh, rightLow;
+        if (scheme == PartitionScheme::Hoare) {
+            // 与Lomuto划分不同，分割点本身属于左半部分
+            int j = hoarePartition(arr, low, high, comp);
+            leftHigh = j;
+            rightLow = j + 1;
+        } else {
+            if (!leftmost && !comp(arr[low - 1], arr[low])) {
+                const T& pivot = arr[low];
+                low = blockPartitionWith(arr, low, high, [&](const T& x) { return !comp(pivot, x); }) + 1;
+                continue;
+            }
+            int p = blockPartition(arr, low, high, comp);
+            leftHigh = p - 1;
+            rightLow = p + 1;
+        }
+        TRACE_STEP("分割点: " << leftHigh << std::endl << std::endl);
+
+        if (leftHigh - low < high - rightLow) {
+            hoareQuickSort(arr, low, leftHigh, scheme, comp, leftmost);
+            low = rightLow;
+            leftmost = false;
+        } else {
+            hoareQuickSort(arr, rightLow, high, scheme, comp, false);
+            high = leftHigh;
+        }
+    }
+    TRACE_STEP("递归终止" << std::endl << std::endl);
+}
+
+/**
+ * 快速排序包装函数
+ * @param arr 待排序数组
+ * @param scheme 划分方案，默认经典Hoare划分
+ * @param comp 比较器
+ */
+template<typename T, typename Compare = std::less<T>>
+void hoareQuickSort(std::vector<T>& arr, PartitionScheme scheme = PartitionScheme::Hoare, Compare comp = Compare()) {
+    if (!arr.empty()) {
+        TRACE_SUMMARY("开始" << (scheme == PartitionScheme::Hoare ? "Hoare" : "块") << "划分快速排序..." << std::endl);
+        hoareQuickSort(arr, 0, (int)arr.size() - 1, scheme, comp, true);
+    }
+}
+
+#endif //CLRS_C2_U7_HOARE_PARTITION_H
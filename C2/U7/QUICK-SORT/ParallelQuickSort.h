@@ -0,0 +1,95 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#ifndef CLRS_C2_U7_PARALLEL_QUICK_SORT_H
+#define CLRS_C2_U7_PARALLEL_QUICK_SORT_H
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "C2/U7/HOARE-PARTITION/HoarePartition.h"
+#include "C2/U7/QUICK-SORT/QuickSort.h"
+#include "common/Trace.h"
+#include "common/WorkStealingPool.h"
+
+// 子数组不超过该长度时不再派生任务，直接在当前线程上顺序排序
+inline constexpr int kParallelSortGrain = 1 << 14;
+
+/**
+ * 并行快速排序的一个任务：处理 arr[low..high]
+ * 每轮用块划分把子数组分成两半，左半部分作为新任务提交给线程池（可能被其他线程窃取），
+ * 当前线程继续处理右半部分；子数组足够短时退回顺序的块划分快速排序。
+ * 划分完成后基准元素的位置不再改变，因此左邻元素 arr[low-1] 可以被安全地并发读取
+ * @param pool 工作窃取线程池
+ * @param arr 待排序数组
+ * @param low 起始索引
+ * @param high 结束索引
+ * @param comp 比较器
+ * @param leftmost 本段是否位于整个数组的最左侧
+ * @param grain 顺序排序的阈值
+ */
+template<typename T, typename Compare>
+void parallelQuickSortTask(WorkStealingPool& pool, std::vector<T>& arr, int low, int high,
+                           Compare comp, bool leftmost, int grain) {
+    while (high - low + 1 > grain) {
+        std::swap(arr[low], arr[choosePivot(arr, low, high, comp)]);
+
+        // 基准等于左邻元素时，等于基准的元素一次性归到左侧，见 hoareQuickSort
+        if (!leftmost && !comp(arr[low - 1], arr[low])) {
+            const T& pivot = arr[low];
+            low = blockPartitionWith(arr, low, high, [&](const T& x) { return !comp(pivot, x); }) + 1;
+            continue;
+        }
+
+        int p = blockPartition(arr, low, high, comp);
+        TRACE_COUNT("parallelQuickSort.forks");
+        pool.submit([&pool, &arr, low, p, comp, leftmost, grain] {
+            parallelQuickSortTask(pool, arr, low, p - 1, comp, leftmost, grain);
+        });
+        low = p + 1;
+        leftmost = false;
+    }
+    hoareQuickSort(arr, low, high, PartitionScheme::Block, comp, leftmost);
+}
+
+/**
+ * 在给定线程池上并行排序
+ * @param pool 工作窃取线程池，可在多次排序之间复用
+ * @param arr 待排序数组
+ * @param comp 比较器
+ * @param grain 子数组不超过该长度时顺序排序
+ */
+template<typename T, typename Compare = std::less<T>>
+void parallelQuickSort(WorkStealingPool& pool, std::vector<T>& arr, Compare comp = Compare(),
+                       int grain = kParallelSortGrain) {
+    if (arr.size() < 2) {
+        return;
+    }
+    TRACE_SUMMARY("开始并行快速排序，线程数: " << pool.size() << std::endl);
+    pool.submit([&pool, &arr, comp, grain] {
+        parallelQuickSortTask(pool, arr, 0, (int)arr.size() - 1, comp, true, grain);
+    });
+    pool.wait();
+}
+
+/**
+ * 并行快速排序
+ * 子数组超过 grain 时划分后把一侧派生为任务，由工作窃取线程池在各线程间均衡，
+ * 较短的子数组在当前线程上顺序排序
+ * @param arr 待排序数组
+ * @param threads 线程数（包括调用线程），0 表示使用硬件线程数，1 即顺序排序
+ * @param comp 比较器
+ */
+template<typename T, typename Compare = std::less<T>>
+void parallelQuickSort(std::vector<T>& arr, size_t threads = 0, Compare comp = Compare()) {
+    if (threads == 1) {
+        hoareQuickSort(arr, PartitionScheme::Block, comp);
+        return;
+    }
+    WorkStealingPool pool(threads);
+    parallelQuickSort(pool, arr, comp);
+}
+
+#endif //CLRS_C2_U7_PARALLEL_QUICK_SORT_H
@@ -0,0 +1,310 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#ifndef CLRS_C2_U7_QUICK_SORT_H
+#define CLRS_C2_U7_QUICK_SORT_H
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "C1/U2/INSERTION-SORT/InsertionSort.h"
+#include "C1/U2/SORTING-NETWORK/SortingNetwork.h"
+#include "C2/U6/HEAP-SORT/HeapSort.h"
+#include "common/Trace.h"
+
+// 添加全局变量用于跟踪递归深度，只在 STEP 级别下用于缩进输出
+#if CLRS_TRACE_LEVEL >= CLRS_TRACE_STEP
+inline int recursionDepth = 0;
+#endif
+
+/**
+ * 分区函数，快速排序的核心
+ * @param arr 待排序数组
+ * @param low 起始索引
+ * @param high 结束索引
+ * @param comp 比较器，comp(a, b) 为 true 表示 a 应排在 b 之前
+ * @return 分区点索引
+ */
+template<typename T, typename Compare = std::less<T>>
+int partition(std::vector<T>& arr, int low, int high, Compare comp = Compare()) {
+    TRACE_STEP("  " << trace::indent(recursionDepth) << "执行分区操作，范围: [" << low << ", " << high << "]" << std::endl);
+    
+    const T& pivot = arr[high];  // 选择最后一个元素作为基准（循环中不会移动 arr[high]）
+    TRACE_STEP("  " << trace::indent(recursionDepth) << "基准元素(pivot): " << pivot << std::endl);
+    
+    int i = low - 1;  // 较小元素的索引
+
+    for (int j = low; j <= high - 1; j++) {
+        TRACE_COUNT("quickSort.comparisons");
+        // 如果当前元素小于或等于基准
+        if (!comp(pivot, arr[j])) {
+            i++;  // 较小元素索引增加
+            if (i != j) {  // 只有当需要交换时才显示
+                TRACE_STEP("  " << trace::indent(recursionDepth) << "交换 arr[" << i << "]=" << arr[i] << " 和 arr[" << j << "]=" << arr[j] << std::endl);
+                TRACE_COUNT("quickSort.swaps");
+                std::swap(arr[i], arr[j]);
+            }
+        }
+    }
+    TRACE_STEP("  " << trace::indent(recursionDepth) << "将基准元素放到正确位置，交换 arr[" << (i+1) << "]=" << arr[i+1] << " 和 arr[" << high << "]=" << arr[high] << std::endl);
+    std::swap(arr[i + 1], arr[high]);
+    
+    TRACE_STEP("  " << trace::indent(recursionDepth) << "分区完成，基准元素位置: " << (i+1) << std::endl);
+    TRACE_COUNT("quickSort.partitions");
+    return (i + 1);
+}
+
+/**
+ * 快速排序主函数
+ * @param arr 待排序数组
+ * @param low 起始索引
+ * @param high 结束索引
+ * @param comp 比较器
+ */
+template<typename T, typename Compare = std::less<T>>
+void quickSort(std::vector<T>& arr, int low, int high, Compare comp = Compare()) {
+    // 打印当前处理范围和子数组状态
+    TRACE_STEP(std::endl << trace::indent(recursionDepth) << "递归深度 " << recursionDepth << ": 处理范围 [" << low << ", " << high << "]" << std::endl);
+    TRACE_STEP("  " << trace::indent(recursionDepth) << "当前子数组: " << trace::range(arr, low, high) << std::endl);
+    
+    if (low < high) {
+        // 获取分区索引
+        TRACE_STEP_EXEC(recursionDepth++);
+        int pi = partition(arr, low, high, comp);
+        TRACE_STEP_EXEC(recursionDepth--);
+
+        TRACE_STEP(std::endl << trace::indent(recursionDepth) << "递归深度 " << recursionDepth << ": 基准位置 " << pi << ", 值为 " << arr[pi] << std::endl);
+        
+        // 分别对基准元素左右两部分进行排序
+        TRACE_STEP("  " << trace::indent(recursionDepth) << "递归处理左半部分: [" << low << ", " << (pi-1) << "]" << std::endl);
+        TRACE_STEP_EXEC(recursionDepth++);
+        quickSort(arr, low, pi - 1, comp);
+        TRACE_STEP_EXEC(recursionDepth--);
+        
+        TRACE_STEP(std::endl << trace::indent(recursionDepth) << "递归深度 " << recursionDepth << ": 处理右半部分: [" << (pi+1) << ", " << high << "]" << std::endl);
+        TRACE_STEP_EXEC(recursionDepth++);
+        quickSort(arr, pi + 1, high, comp);
+        TRACE_STEP_EXEC(recursionDepth--);
+    } else {
+        if (low == high) {
+            TRACE_STEP("  " << trace::indent(recursionDepth) << "递归终止条件: 子数组只有一个元素 " << arr[low] << std::endl);
+        } else {
+            TRACE_STEP("  " << trace::indent(recursionDepth) << "递归终止条件: 无效范围 [" << low << ", " << high << "]" << std::endl);
+        }
+    }
+}
+
+/**
+ * 快速排序包装函数
+ * @param arr 待排序数组
+ * @param comp 比较器
+ */
+template<typename T, typename Compare = std::less<T>>
+void quickSort(std::vector<T>& arr, Compare comp = Compare()) {
+    TRACE_SUMMARY("开始快速排序..." << std::endl);
+    quickSort(arr, 0, (int)arr.size() - 1, comp);
+}
+
+// 子数组长度不超过该值时改用小数组排序（smallSort）
+inline constexpr int kIntroSortThreshold = 16;
+
+/**
+ * 递归底层的子数组长度阈值：能用排序网络时放宽到网络的最大规模，否则为 kIntroSortThreshold
+ */
+template<typename T, typename Compare>
+constexpr int smallSortThreshold() {
+    return kUsesSortingNetwork<T, Compare> ? (int)kSortingNetworkMaxSize : kIntroSortThreshold;
+}
+
+// 子数组长度超过该值时用九数取中（ninther）代替三数取中
+inline constexpr int kNintherThreshold = 128;
+
+/**
+ * 三数取中
+ * @return arr[a]、arr[b]、arr[c] 中中位数的索引
+ */
+template<typename T, typename Compare>
+int medianOfThree(const std::vector<T>& arr, int a, int b, int c, Compare comp) {
+    if (comp(arr[a], arr[b])) {
+        if (comp(arr[b], arr[c])) return b;       // a < b < c
+        return comp(arr[a], arr[c]) ? c : a;      // a < b, c <= b
+    }
+    if (comp(arr[a], arr[c])) return a;           // b <= a < c
+    return comp(arr[b], arr[c]) ? c : b;          // b <= a, c <= a
+}
+
+/**
+ * 为子数组 arr[low..high] 选取基准
+ * 较短的子数组用首、中、尾三数取中；较长的用 Tukey 九数取中，
+ * 即在首、中、尾附近各取三个数的中位数，再取这三个中位数的中位数
+ * @return 基准元素的索引
+ */
+template<typename T, typename Compare>
+int choosePivot(const std::vector<T>& arr, int low, int high, Compare comp) {
+    int mid = low + (high - low) / 2;
+    if (high - low + 1 <= kNintherThreshold) {
+        return medianOfThree(arr, low, mid, high, comp);
+    }
+    int step = (high - low + 1) / 8;
+    int a = medianOfThree(arr, low, low + step, low + 2 * step, comp);
+    int b = medianOfThree(arr, mid - step, mid, mid + step, comp);
+    int c = medianOfThree(arr, high - 2 * step, high - step, high, comp);
+    return medianOfThree(arr, a, b, c, comp);
+}
+
+/**
+ * 内省排序的主循环
+ * 只对较短的一侧递归，较长的一侧在循环中继续处理，递归深度不超过 log n；
+ * 划分层数超过 depthLimit 时说明基准持续选得很差，剩余部分改用堆排序
+ * @param arr 待排序数组
+ * @param low 起始索引
+ * @param high 结束索引
+ * @param depthLimit 剩余允许的划分层数
+ * @param comp 比较器
+ */
+template<typename T, typename Compare>
+void introSortLoop(std::vector<T>& arr, int low, int high, int depthLimit, Compare comp) {
+    while (high - low + 1 > smallSortThreshold<T, Compare>()) {
+        if (depthLimit == 0) {
+            TRACE_STEP(trace::indent(recursionDepth) << "划分层数超限，对 [" << low << ", " << high << "] 改用堆排序" << std::endl);
+            TRACE_COUNT("introSort.heapSortFallbacks");
+            heapSort(arr, low, high, comp);
+            return;
+        }
+        depthLimit--;
+
+        // 把选出的基准换到末尾，复用 Lomuto 划分
+        std::swap(arr[choosePivot(arr, low, high, comp)], arr[high]);
+        int pi = partition(arr, low, high, comp);
+
+        TRACE_STEP_EXEC(recursionDepth++);
+        if (pi - low < high - pi) {
+            introSortLoop(arr, low, pi - 1, depthLimit, comp);
+            low = pi + 1;
+        } else {
+            introSortLoop(arr, pi + 1, high, depthLimit, comp);
+            high = pi - 1;
+        }
+        TRACE_STEP_EXEC(recursionDepth--);
+    }
+    smallSort(arr, low, high, comp);
+}
+
+/**
+ * 内省排序的划分层数上限 2·⌊lg n⌋
+ * @param n 子数组长度
+ */
+inline int introSortDepthLimit(int n) {
+    int depthLimit = 0;
+    for (int m = n; m > 1; m >>= 1) {
+        depthLimit += 2;
+    }
+    return depthLimit;
+}
+
+/**
+ * 内省排序（introsort）
+ * 以快速排序为主体，结合三数/九数取中选基准、小数组排序（排序网络或插入排序）、
+ * 较短侧递归以及深度超过 2·log n 时退化为堆排序，最坏时间复杂度 O(n log n)
+ * @param arr 待排序数组
+ * @param comp 比较器
+ */
+template<typename T, typename Compare = std::less<T>>
+void introSort(std::vector<T>& arr, Compare comp = Compare()) {
+    int n = arr.size();
+    if (n < 2) {
+        return;
+    }
+    int depthLimit = introSortDepthLimit(n);
+    TRACE_SUMMARY("开始内省排序，划分层数上限: " << depthLimit << std::endl);
+    introSortLoop(arr, 0, n - 1, depthLimit, comp);
+}
+
+/**
+ * 三路划分（Dijkstra 的荷兰国旗问题）
+ * 以 arr[high] 为基准，把子数组分成小于、等于、大于基准的三段。
+ * 等于基准的元素一次性归位，不再参与后续递归：重复键很多时快速排序仍为 O(n log n)，
+ * 全部元素相等时一趟扫描即可结束
+ * @param arr 待划分数组
+ * @param low 起始索引
+ * @param high 结束索引
+ * @param comp 比较器
+ * @return 等于基准的区间 [first, second]，其左侧都小于基准，右侧都大于基准
+ */
+template<typename T, typename Compare = std::less<T>>
+std::pair<int, int> threeWayPartition(std::vector<T>& arr, int low, int high, Compare comp = Compare()) {
+    TRACE_STEP("  " << trace::indent(recursionDepth) << "执行三路划分，范围: [" << low << ", " << high << "]，基准: " << arr[high] << std::endl);
+
+    T pivot = arr[high];  // 扫描过程中 arr[high] 会被移动，保存一份基准
+    int lt = low;         // arr[low..lt-1] 小于基准
+    int i = low;          // arr[lt..i-1] 等于基准
+    int gt = high;        // arr[gt+1..high] 大于基准
+
+    while (i <= gt) {
+        TRACE_COUNT("threeWayPartition.comparisons");
+        if (comp(arr[i], pivot)) {
+            std::swap(arr[lt++], arr[i++]);
+        } else if (comp(pivot, arr[i])) {
+            std::swap(arr[i], arr[gt--]);
+        } else {
+            i++;
+        }
+    }
+
+    TRACE_STEP("  " << trace::indent(recursionDepth) << "划分完成，等于基准的区间: [" << lt << ", " << gt << "]" << std::endl);
+    TRACE_COUNT("threeWayPartition.partitions");
+    return {lt, gt};
+}
+
+/**
+ * 三路划分快速排序的主循环
+ * 与内省排序相同，只对较短的一侧递归、短子数组改用 smallSort，
+ * 划分层数超过 depthLimit 时剩余部分改用堆排序
+ * @param arr 待排序数组
+ * @param low 起始索引
+ * @param high 结束索引
+ * @param depthLimit 剩余允许的划分层数
+ * @param comp 比较器
+ */
+template<typename T, typename Compare>
+void threeWayQuickSort(std::vector<T>& arr, int low, int high, int depthLimit, Compare comp) {
+    while (high - low + 1 > smallSortThreshold<T, Compare>()) {
+        if (depthLimit == 0) {
+            TRACE_STEP(trace::indent(recursionDepth) << "划分层数超限，对 [" << low << ", " << high << "] 改用堆排序" << std::endl);
+            TRACE_COUNT("threeWayQuickSort.heapSortFallbacks");
+            heapSort(arr, low, high, comp);
+            return;
+        }
+        depthLimit--;
+
+        std::swap(arr[choosePivot(arr, low, high, comp)], arr[high]);
+        std::pair<int, int> equal = threeWayPartition(arr, low, high, comp);
+
+        TRACE_STEP_EXEC(recursionDepth++);
+        if (equal.first - low < high - equal.second) {
+            threeWayQuickSort(arr, low, equal.first - 1, depthLimit, comp);
+            low = equal.second + 1;
+        } else {
+            threeWayQuickSort(arr, equal.second + 1, high, depthLimit, comp);
+            high = equal.first - 1;
+        }
+        TRACE_STEP_EXEC(recursionDepth--);
+    }
+    smallSort(arr, low, high, comp);
+}
+
+/**
+ * 三路划分快速排序，适用于取值很少、重复键很多的数据
+ * 与内省排序共用划分层数上限，最坏时间复杂度 O(n log n)
+ * @param arr 待排序数组
+ * @param comp 比较器
+ */
+template<typename T, typename Compare = std::less<T>>
+void threeWayQuickSort(std::vector<T>& arr, Compare comp = Compare()) {
+    TRACE_SUMMARY("开始三路划分快速排序..." << std::endl);
+    threeWayQuickSort(arr, 0, (int)arr.size() - 1, introSortDepthLimit((int)arr.size()), comp);
+}
+
+#endif //CLRS_C2_U7_QUICK_SORT_H
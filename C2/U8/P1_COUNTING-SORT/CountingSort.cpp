@@ -6,118 +6,10 @@
 #include <vector>
 #include <algorithm>
 #include <climits>
+#include <string>
+#include <utility>
 
-/**
- * 计数排序算法实现
- * 《算法导论》第八章线性时间排序中的计数排序
- * @param arr 待排序的数组
- * @return 排序后的数组
- */
-std::vector<int> countingSort(const std::vector<int>& arr) {
-    if (arr.empty()) return arr;
-    
-    std::cout << "开始计数排序..." << std::endl;
-    
-    // 找到数组中的最大值和最小值
-    int maxVal = *std::max_element(arr.begin(), arr.end());
-    int minVal = *std::min_element(arr.begin(), arr.end());
-    
-    std::cout << "数组中的最小值: " << minVal << ", 最大值: " << maxVal << std::endl;
-    
-    // 计算计数数组的大小
-    int range = maxVal - minVal + 1;
-    
-    std::cout << "计数数组大小: " << range << std::endl;
-    
-    // 创建计数数组并初始化为0
-    std::vector<int> count(range, 0);
-    
-    // 统计每个元素出现的次数
-    std::cout << "统计每个元素出现的次数:" << std::endl;
-    for (size_t i = 0; i < arr.size(); i++) {
-        count[arr[i] - minVal]++;
-        std::cout << "  元素 " << arr[i] << " 出现，计数数组count[" << (arr[i] - minVal) << "] = " << count[arr[i] - minVal] << std::endl;
-    }
-    
-    std::cout << "计数数组内容: ";
-    for (int i = 0; i < range; i++) {
-        std::cout << count[i] << " ";
-    }
-    std::cout << std::endl;
-    
-    // 将计数数组转换为累积计数数组
-    // count[i]现在表示小于等于(i + minVal)的元素个数
-    std::cout << "计算累积计数数组:" << std::endl;
-    for (int i = 1; i < range; i++) {
-        count[i] += count[i - 1];
-        std::cout << "  count[" << i << "] = count[" << i << "] + count[" << (i-1) << "] = " << count[i] << std::endl;
-    }
-    
-    std::cout << "累积计数数组内容: ";
-    for (int i = 0; i < range; i++) {
-        std::cout << count[i] << " ";
-    }
-    std::cout << std::endl;
-    
-    // 创建输出数组
-    std::vector<int> output(arr.size());
-    
-    // 从右到左遍历原数组，构建排序后的数组
-    // 这样可以保证排序的稳定性
-    std::cout << "构建输出数组:" << std::endl;
-    for (int i = arr.size() - 1; i >= 0; i--) {
-        int pos = count[arr[i] - minVal] - 1;
-        output[pos] = arr[i];
-        count[arr[i] - minVal]--;
-        std::cout << "  元素 " << arr[i] << " 放置在位置 " << pos << std::endl;
-    }
-    
-    return output;
-}
-
-/**
- * 计数排序算法实现（针对非负整数）
- * 简化版本，假设所有元素都是非负整数
- * @param arr 待排序的数组
- * @param k 数组中元素的最大值
- */
-void countingSort(std::vector<int>& arr, int k) {
-    int n = arr.size();
-    
-    std::cout << "开始简化版计数排序，k = " << k << std::endl;
-    
-    // 创建计数数组和输出数组
-    std::vector<int> count(k + 1, 0);
-    std::vector<int> output(n);
-    
-    // 统计每个元素出现的次数
-    std::cout << "统计每个元素出现的次数:" << std::endl;
-    for (int i = 0; i < n; i++) {
-        count[arr[i]]++;
-        std::cout << "  元素 " << arr[i] << " 出现，count[" << arr[i] << "] = " << count[arr[i]] << std::endl;
-    }
-    
-    // 将计数数组转换为累积计数数组
-    std::cout << "计算累积计数数组:" << std::endl;
-    for (int i = 1; i <= k; i++) {
-        count[i] += count[i - 1];
-        std::cout << "  count[" << i << "] = count[" << i << "] + count[" << (i-1) << "] = " << count[i] << std::endl;
-    }
-    
-    // 构建输出数组（从右到左遍历保证稳定性）
-    std::cout << "构建输出数组:" << std::endl;
-    for (int i = n - 1; i >= 0; i--) {
-        int pos = count[arr[i]] - 1;
-        output[pos] = arr[i];
-        count[arr[i]]--;
-        std::cout << "  元素 " << arr[i] << " 放置在位置 " << pos << std::endl;
-    }
-    
-    // 将排序结果复制回原数组
-    for (int i = 0; i < n; i++) {
-        arr[i] = output[i];
-    }
-}
+#include "CountingSort.h"
 
 /**
  * 打印数组元素
@@ -172,6 +64,22 @@ int main() {
     
     countingSort(arr3, 5);
     printArray(arr3, "排序后: ");
+    std::cout << std::endl;
+    
+    // 测试用例4：按键排序带负载的记录，键相同的记录保持原有顺序
+    std::vector<std::pair<int, std::string>> students = {
+        {3, "张三"}, {1, "李四"}, {2, "王五"}, {1, "赵六"}, {3, "孙七"}, {2, "周八"}
+    };
+    std::cout << "测试用例4（按年级稳定排序学生记录）:" << std::endl;
+    std::cout << "排序前: ";
+    for (const auto& s : students) std::cout << s.first << ":" << s.second << " ";
+    std::cout << std::endl;
+    
+    CountingSortScratch<std::pair<int, std::string>> scratch;
+    countingSortByKey(students, [](const std::pair<int, std::string>& s) { return s.first; }, scratch);
+    std::cout << "排序后: ";
+    for (const auto& s : students) std::cout << s.first << ":" << s.second << " ";
+    std::cout << std::endl;
     
     std::cout << std::endl << "========================================" << std::endl;
     std::cout << "计数排序算法演示完成!" << std::endl;
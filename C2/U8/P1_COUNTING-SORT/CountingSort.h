@@ -0,0 +1,241 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#ifndef CLRS_C2_U8_COUNTING_SORT_H
+#define CLRS_C2_U8_COUNTING_SORT_H
+
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "C2/U8/P2_RADIX-SORT/RadixSort.h"
+#include "common/Trace.h"
+#include "common/WorkStealingPool.h"
+
+/**
+ * 计数排序算法实现
+ * 《算法导论》第八章线性时间排序中的计数排序
+ * @param arr 待排序的整数数组
+ * @return 排序后的数组
+ */
+template<typename T>
+std::vector<T> countingSort(const std::vector<T>& arr) {
+    static_assert(std::is_integral<T>::value, "countingSort requires integral keys");
+    if (arr.empty()) return arr;
+    
+    TRACE_SUMMARY("开始计数排序..." << std::endl);
+    
+    // 找到数组中的最大值和最小值
+    T maxVal = *std::max_element(arr.begin(), arr.end());
+    T minVal = *std::min_element(arr.begin(), arr.end());
+    
+    TRACE_STEP("数组中的最小值: " << minVal << ", 最大值: " << maxVal << std::endl);
+    
+    // 计算计数数组的大小
+    size_t range = static_cast<size_t>(maxVal - minVal) + 1;
+    
+    TRACE_STEP("计数数组大小: " << range << std::endl);
+    
+    // 创建计数数组并初始化为0
+    std::vector<size_t> count(range, 0);
+    
+    // 统计每个元素出现的次数
+    TRACE_STEP("统计每个元素出现的次数:" << std::endl);
+    for (size_t i = 0; i < arr.size(); i++) {
+        count[arr[i] - minVal]++;
+        TRACE_STEP("  元素 " << arr[i] << " 出现，计数数组count[" << (arr[i] - minVal) << "] = " << count[arr[i] - minVal] << std::endl);
+    }
+    
+    TRACE_STEP("计数数组内容: " << trace::range(count) << std::endl);
+    
+    // 将计数数组转换为累积计数数组
+    // count[i]现在表示小于等于(i + minVal)的元素个数
+    TRACE_STEP("计算累积计数数组:" << std::endl);
+    for (size_t i = 1; i < range; i++) {
+        count[i] += count[i - 1];
+        TRACE_STEP("  count[" << i << "] = count[" << i << "] + count[" << (i-1) << "] = " << count[i] << std::endl);
+    }
+    
+    TRACE_STEP("累积计数数组内容: " << trace::range(count) << std::endl);
+    
+    // 创建输出数组
+    std::vector<T> output(arr.size());
+    
+    // 从右到左遍历原数组，构建排序后的数组
+    // 这样可以保证排序的稳定性
+    TRACE_STEP("构建输出数组:" << std::endl);
+    for (int i = (int)arr.size() - 1; i >= 0; i--) {
+        size_t pos = count[arr[i] - minVal] - 1;
+        output[pos] = arr[i];
+        count[arr[i] - minVal]--;
+        TRACE_STEP("  元素 " << arr[i] << " 放置在位置 " << pos << std::endl);
+    }
+    
+    return output;
+}
+
+/**
+ * 计数排序算法实现（针对非负整数）
+ * 简化版本，假设所有元素都是非负整数
+ * @param arr 待排序的数组
+ * @param k 数组中元素的最大值
+ */
+template<typename T>
+void countingSort(std::vector<T>& arr, typename std::vector<T>::value_type k) {
+    static_assert(std::is_integral<T>::value, "countingSort requires integral keys");
+    int n = arr.size();
+    
+    TRACE_SUMMARY("开始简化版计数排序，k = " << k << std::endl);
+    
+    // 创建计数数组和输出数组
+    std::vector<int> count(static_cast<size_t>(k) + 1, 0);
+    std::vector<T> output(n);
+    
+    // 统计每个元素出现的次数
+    TRACE_STEP("统计每个元素出现的次数:" << std::endl);
+    for (int i = 0; i < n; i++) {
+        count[arr[i]]++;
+        TRACE_STEP("  元素 " << arr[i] << " 出现，count[" << arr[i] << "] = " << count[arr[i]] << std::endl);
+    }
+    
+    // 将计数数组转换为累积计数数组
+    TRACE_STEP("计算累积计数数组:" << std::endl);
+    for (size_t i = 1; i <= static_cast<size_t>(k); i++) {
+        count[i] += count[i - 1];
+        TRACE_STEP("  count[" << i << "] = count[" << i << "] + count[" << (i-1) << "] = " << count[i] << std::endl);
+    }
+    
+    // 构建输出数组（从右到左遍历保证稳定性）
+    TRACE_STEP("构建输出数组:" << std::endl);
+    for (int i = n - 1; i >= 0; i--) {
+        int pos = count[arr[i]] - 1;
+        output[pos] = arr[i];
+        count[arr[i]]--;
+        TRACE_STEP("  元素 " << arr[i] << " 放置在位置 " << pos << std::endl);
+    }
+    
+    // 将排序结果复制回原数组
+    arr.swap(output);
+}
+
+// 计数数组（所有线程的直方图合计）允许占用的默认内存上限，超过时改用基数排序
+inline constexpr size_t kCountingSortMemoryBudget = size_t(1) << 24;
+
+// 并行统计时每个线程至少处理的记录数
+inline constexpr size_t kCountingSortGrain = size_t(1) << 16;
+
+/**
+ * 计数排序的工作区
+ * 在多次排序之间复用计数数组和输出数组，避免每次调用都重新分配内存
+ */
+template<typename Record>
+struct CountingSortScratch {
+    std::vector<size_t> counts;   // 各线程的直方图，按"线程 × 键"连续存放
+    std::vector<Record> output;   // 输出数组，排序后与输入数组交换
+};
+
+/**
+ * 按小整数键对记录做稳定的计数排序（键 + 负载）
+ *
+ * 记录被分成若干块，每块统计自己的直方图（有线程池时并行统计）；
+ * 对"键 × 块"做前缀和后，每块得到在每个键中的写入起点，各块再独立地把记录分配到输出数组。
+ * 键相同的记录按块的顺序、块内按原顺序排列，因此排序是稳定的。
+ * 键的取值范围使计数数组超过 memoryBudget 时，改用按键的 LSD 基数排序（同样稳定）。
+ * @param records 待排序的记录
+ * @param keyOf keyOf(r) 返回记录 r 的整数键
+ * @param scratch 可复用的工作区
+ * @param pool 线程池，为空时在当前线程上顺序执行
+ * @param memoryBudget 计数数组允许占用的字节数
+ */
+template<typename Record, typename KeyOf>
+void countingSortByKey(std::vector<Record>& records, KeyOf keyOf, CountingSortScratch<Record>& scratch,
+                       WorkStealingPool* pool = nullptr, size_t memoryBudget = kCountingSortMemoryBudget) {
+    using Key = std::decay_t<decltype(keyOf(records[0]))>;
+    static_assert(std::is_integral<Key>::value, "countingSortByKey requires integral keys");
+    const size_t n = records.size();
+    if (n < 2) return;
+
+    size_t chunks = 1;
+    if (pool != nullptr) {
+        chunks = std::max<size_t>(1, std::min(pool->size(), n / kCountingSortGrain));
+    }
+    const size_t chunkSize = (n + chunks - 1) / chunks;
+    auto forEachChunk = [&](auto work) {
+        if (chunks == 1) {
+            work(0, 0, n);
+            return;
+        }
+        for (size_t c = 0; c < chunks; c++) {
+            pool->submit([&work, c, chunkSize, n] {
+                work(c, c * chunkSize, std::min(n, (c + 1) * chunkSize));
+            });
+        }
+        pool->wait();
+    };
+
+    // 键的取值范围
+    std::vector<Key> mins(chunks), maxs(chunks);
+    forEachChunk([&](size_t c, size_t begin, size_t end) {
+        Key lo = keyOf(records[begin]), hi = lo;
+        for (size_t i = begin + 1; i < end; i++) {
+            Key k = keyOf(records[i]);
+            lo = std::min(lo, k);
+            hi = std::max(hi, k);
+        }
+        mins[c] = lo;
+        maxs[c] = hi;
+    });
+    const Key minKey = *std::min_element(mins.begin(), mins.end());
+    const Key maxKey = *std::max_element(maxs.begin(), maxs.end());
+
+    // 按补码相减得到跨度，对 64 位有符号键也不会溢出
+    const uint64_t span = static_cast<uint64_t>(maxKey) - static_cast<uint64_t>(minKey);
+    const uint64_t budgetEntries = memoryBudget / (sizeof(size_t) * chunks);
+    if (span >= budgetEntries) {
+        TRACE_SUMMARY("键的范围 " << span + 1 << " 超出计数数组的内存上限，改用基数排序" << std::endl);
+        TRACE_COUNT("countingSort.radixFallbacks");
+        lsdRadixSortBy(records, keyOf, scratch.output);
+        return;
+    }
+    const size_t range = static_cast<size_t>(span) + 1;
+    auto slot = [&](const Record& r) {
+        return static_cast<size_t>(static_cast<uint64_t>(keyOf(r)) - static_cast<uint64_t>(minKey));
+    };
+
+    // 各块统计自己的直方图
+    scratch.counts.assign(chunks * range, 0);
+    forEachChunk([&](size_t c, size_t begin, size_t end) {
+        size_t* count = scratch.counts.data() + c * range;
+        for (size_t i = begin; i < end; i++) {
+            count[slot(records[i])]++;
+        }
+    });
+
+    // 前缀和：键 k 在块 c 中的写入起点 = 所有更小的键的记录数 + 更靠前的块中键为 k 的记录数
+    size_t offset = 0;
+    for (size_t k = 0; k < range; k++) {
+        for (size_t c = 0; c < chunks; c++) {
+            size_t& count = scratch.counts[c * range + k];
+            size_t bucketSize = count;
+            count = offset;
+            offset += bucketSize;
+        }
+    }
+
+    // 各块按原顺序分配，保证稳定
+    scratch.output.resize(n);
+    forEachChunk([&](size_t c, size_t begin, size_t end) {
+        size_t* next = scratch.counts.data() + c * range;
+        for (size_t i = begin; i < end; i++) {
+            scratch.output[next[slot(records[i])]++] = records[i];
+        }
+    });
+
+    // 交换后原输入数组的存储留在工作区中，供下次调用复用
+    records.swap(scratch.output);
+}
+
+#endif //CLRS_C2_U8_COUNTING_SORT_H
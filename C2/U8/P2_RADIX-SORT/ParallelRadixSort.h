@@ -0,0 +1,205 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#ifndef CLRS_C2_U8_PARALLEL_RADIX_SORT_H
+#define CLRS_C2_U8_PARALLEL_RADIX_SORT_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "C1/U2/INSERTION-SORT/InsertionSort.h"
+#include "C2/U8/P2_RADIX-SORT/RadixSort.h"
+#include "common/Trace.h"
+#include "common/WorkStealingPool.h"
+
+// 桶中元素不超过该值时改用插入排序
+inline constexpr size_t kRadixInsertionThreshold = 32;
+
+// 桶中元素超过该值时作为独立任务提交给线程池，否则在当前线程上递归
+inline constexpr size_t kParallelRadixGrain = 1 << 14;
+
+/**
+ * 取键的第 byte 个字节（0 为最低字节）
+ */
+template<typename Key>
+size_t radixDigit(Key key, int byte) {
+    return static_cast<size_t>((key >> (8 * byte)) & 0xFF);
+}
+
+/**
+ * MSD 基数排序中对一个桶的递归处理：按第 byte 个字节分配到另一个数组，再对每个子桶递归处理下一个字节
+ * 元素在 arr 与 buffer 之间来回分配，inBuffer 表示该桶当前位于哪一个数组，
+ * 到达递归底层时若位于 buffer 则复制回 arr
+ * @param pool 工作窃取线程池
+ * @param arr 待排序数组，也是最终结果所在的数组
+ * @param buffer 与 arr 等长的缓冲区
+ * @param inBuffer 桶的元素当前是否位于 buffer 中
+ * @param begin 桶的起始位置
+ * @param end 桶的结束位置（不包含）
+ * @param byte 本层处理的字节，小于 0 表示所有字节已处理完
+ */
+template<typename T>
+void msdRadixSortBucket(WorkStealingPool& pool, std::vector<T>& arr, std::vector<T>& buffer,
+                        bool inBuffer, size_t begin, size_t end, int byte) {
+    std::vector<T>& src = inBuffer ? buffer : arr;
+    std::vector<T>& dst = inBuffer ? arr : buffer;
+    const size_t n = end - begin;
+
+    // 小桶或所有字节都已处理：插入排序后放回 arr
+    if (n <= kRadixInsertionThreshold || byte < 0) {
+        if (n > 1) {
+            insertionSort(src, (int)begin, (int)end - 1, [](const T& a, const T& b) {
+                return RadixKey<T>::encode(a) < RadixKey<T>::encode(b);
+            });
+        }
+        if (inBuffer) {
+            std::copy(src.begin() + begin, src.begin() + end, arr.begin() + begin);
+        }
+        return;
+    }
+
+    std::array<size_t, 256> count {};
+    for (size_t i = begin; i < end; i++) {
+        count[radixDigit(RadixKey<T>::encode(src[i]), byte)]++;
+    }
+
+    // 该字节在桶内全部相同，不必分配，直接处理下一个字节
+    if (count[radixDigit(RadixKey<T>::encode(src[begin]), byte)] == n) {
+        TRACE_COUNT("msdRadixSort.skippedPasses");
+        msdRadixSortBucket(pool, arr, buffer, inBuffer, begin, end, byte - 1);
+        return;
+    }
+
+    std::array<size_t, 256> start {};
+    size_t offset = begin;
+    for (size_t b = 0; b < 256; b++) {
+        start[b] = offset;
+        offset += count[b];
+    }
+    std::array<size_t, 256> next = start;
+    for (size_t i = begin; i < end; i++) {
+        dst[next[radixDigit(RadixKey<T>::encode(src[i]), byte)]++] = src[i];
+    }
+    TRACE_COUNT("msdRadixSort.passes");
+
+    for (size_t b = 0; b < 256; b++) {
+        size_t bucketBegin = start[b];
+        size_t bucketEnd = start[b] + count[b];
+        if (count[b] > kParallelRadixGrain) {
+            pool.submit([&pool, &arr, &buffer, inBuffer, bucketBegin, bucketEnd, byte] {
+                msdRadixSortBucket(pool, arr, buffer, !inBuffer, bucketBegin, bucketEnd, byte - 1);
+            });
+        } else if (count[b] > 0) {
+            msdRadixSortBucket(pool, arr, buffer, !inBuffer, bucketBegin, bucketEnd, byte - 1);
+        }
+    }
+}
+
+/**
+ * 在给定线程池上做并行 MSD 基数排序
+ *
+ * 第一层按最高的非常量字节分配，分三步并行完成：
+ *   1. 数组切成与线程数相同的块，各线程统计自己块的直方图；
+ *   2. 对"桶 × 块"做前缀和，得到每个线程在每个桶中的写入起点；
+ *   3. 各线程把自己的块分配到缓冲区，彼此写入的区间互不重叠。
+ * 之后每个桶是独立的子问题，较大的桶作为任务提交给线程池，由工作窃取在线程间均衡。
+ * 支持的键类型与 lsdRadixSort 相同
+ * @param pool 工作窃取线程池
+ * @param arr 待排序数组
+ */
+template<typename T>
+void parallelMsdRadixSort(WorkStealingPool& pool, std::vector<T>& arr) {
+    using Key = typename RadixKey<T>::type;
+    const size_t n = arr.size();
+    if (n < 2) return;
+
+    const size_t chunks = std::min(pool.size(), (n + kParallelRadixGrain - 1) / kParallelRadixGrain);
+    const size_t chunkSize = (n + chunks - 1) / chunks;
+    TRACE_SUMMARY("开始并行MSD基数排序，线程数: " << pool.size() << "，分块数: " << chunks << std::endl);
+
+    // 找出最高的、在元素之间有差异的字节
+    const Key first = RadixKey<T>::encode(arr[0]);
+    std::vector<Key> diffs(chunks, 0);
+    for (size_t c = 0; c < chunks; c++) {
+        pool.submit([&, c] {
+            Key diff = 0;
+            for (size_t i = c * chunkSize; i < std::min(n, (c + 1) * chunkSize); i++) {
+                diff |= RadixKey<T>::encode(arr[i]) ^ first;
+            }
+            diffs[c] = diff;
+        });
+    }
+    pool.wait();
+    Key diff = 0;
+    for (Key d : diffs) diff |= d;
+    if (diff == 0) return;  // 所有元素的键都相同
+    int byte = (int)sizeof(Key) - 1;
+    while (radixDigit(diff, byte) == 0) byte--;
+
+    // 每个线程统计自己块的直方图
+    std::vector<std::array<size_t, 256>> histograms(chunks);
+    for (size_t c = 0; c < chunks; c++) {
+        pool.submit([&, c] {
+            std::array<size_t, 256>& count = histograms[c];
+            count.fill(0);
+            for (size_t i = c * chunkSize; i < std::min(n, (c + 1) * chunkSize); i++) {
+                count[radixDigit(RadixKey<T>::encode(arr[i]), byte)]++;
+            }
+        });
+    }
+    pool.wait();
+
+    // 前缀和：桶 b 在块 c 中的写入起点 = 所有更小桶的总数 + 更靠前的块在桶 b 中的元素数
+    std::array<size_t, 257> bucketStart {};
+    std::vector<std::array<size_t, 256>> next(chunks);
+    size_t offset = 0;
+    for (size_t b = 0; b < 256; b++) {
+        bucketStart[b] = offset;
+        for (size_t c = 0; c < chunks; c++) {
+            next[c][b] = offset;
+            offset += histograms[c][b];
+        }
+    }
+    bucketStart[256] = offset;
+
+    // 各线程把自己的块分配到缓冲区
+    std::vector<T> buffer(n);
+    for (size_t c = 0; c < chunks; c++) {
+        pool.submit([&, c] {
+            std::array<size_t, 256>& pos = next[c];
+            for (size_t i = c * chunkSize; i < std::min(n, (c + 1) * chunkSize); i++) {
+                buffer[pos[radixDigit(RadixKey<T>::encode(arr[i]), byte)]++] = arr[i];
+            }
+        });
+    }
+    pool.wait();
+    TRACE_COUNT("msdRadixSort.passes");
+
+    // 每个桶作为独立任务递归处理下一个字节
+    for (size_t b = 0; b < 256; b++) {
+        size_t bucketBegin = bucketStart[b];
+        size_t bucketEnd = bucketStart[b + 1];
+        if (bucketEnd > bucketBegin) {
+            pool.submit([&pool, &arr, &buffer, bucketBegin, bucketEnd, byte] {
+                msdRadixSortBucket(pool, arr, buffer, true, bucketBegin, bucketEnd, byte - 1);
+            });
+        }
+    }
+    pool.wait();
+}
+
+/**
+ * 并行 MSD 基数排序
+ * @param arr 待排序数组
+ * @param threads 线程数（包括调用线程），0 表示使用硬件线程数
+ */
+template<typename T>
+void parallelMsdRadixSort(std::vector<T>& arr, size_t threads = 0) {
+    WorkStealingPool pool(threads);
+    parallelMsdRadixSort(pool, arr);
+}
+
+#endif //CLRS_C2_U8_PARALLEL_RADIX_SORT_H
@@ -6,6 +6,9 @@
 #include <vector>
 #include <algorithm>
 
+#include "ParallelRadixSort.h"
+#include "RadixSort.h"
+
 /**
  * 打印数组元素
  * @param arr 要打印的数组
@@ -21,113 +24,6 @@ void printArray(const std::vector<int>& arr, const std::string& msg = "") {
     std::cout << std::endl;
 }
 
-/**
- * 获取数字中指定位上的数字
- * @param num 数字
- * @param digit 位数（从右往左数，从1开始）
- * @return 指定位上的数字
- */
-int getDigit(int num, int digit) {
-    for (int i = 1; i < digit; i++) {
-        num /= 10;
-    }
-    return num % 10;
-}
-
-/**
- * 获取数组中最大数的位数
- * @param arr 数组
- * @return 最大数的位数
- */
-int getMaxDigits(const std::vector<int>& arr) {
-    int maxVal = *std::max_element(arr.begin(), arr.end());
-    int digits = 0;
-    while (maxVal > 0) {
-        maxVal /= 10;
-        digits++;
-    }
-    return digits;
-}
-
-/**
- * 计数排序（针对指定位）
- * @param arr 待排序数组
- * @param digit 位数（从右往左数，从1开始）
- */
-void countingSortForRadix(std::vector<int>& arr, int digit) {
-    int n = arr.size();
-    std::vector<int> output(n);
-    std::vector<int> count(10, 0); // 0-9十个数字
-    
-    std::cout << "    对第 " << digit << " 位进行计数排序" << std::endl;
-    
-    // 统计当前位上各数字出现的次数
-    std::cout << "    统计各数字出现次数: ";
-    for (int i = 0; i < n; i++) {
-        int d = getDigit(arr[i], digit);
-        count[d]++;
-        std::cout << "arr[" << i << "]=" << arr[i] << "(第" << digit << "位是" << d << ") ";
-    }
-    std::cout << std::endl;
-    
-    std::cout << "    计数数组: ";
-    for (int i = 0; i < 10; i++) {
-        std::cout << count[i] << " ";
-    }
-    std::cout << std::endl;
-    
-    // 计算累积计数
-    std::cout << "    计算累积计数: ";
-    for (int i = 1; i < 10; i++) {
-        count[i] += count[i - 1];
-    }
-    for (int i = 0; i < 10; i++) {
-        std::cout << count[i] << " ";
-    }
-    std::cout << std::endl;
-    
-    // 构建输出数组（从右到左遍历保证稳定性）
-    std::cout << "    构建输出数组: ";
-    for (int i = n - 1; i >= 0; i--) {
-        int d = getDigit(arr[i], digit);
-        int pos = count[d] - 1;
-        output[pos] = arr[i];
-        count[d]--;
-        std::cout << "arr[" << i << "]=" << arr[i] << " 放置在位置 " << pos << " ";
-    }
-    std::cout << std::endl;
-    
-    // 将排序结果复制回原数组
-    for (int i = 0; i < n; i++) {
-        arr[i] = output[i];
-    }
-}
-
-/**
- * 基数排序算法实现
- * 《算法导论》第八章线性时间排序中的基数排序
- * @param arr 待排序的数组
- */
-void radixSort(std::vector<int>& arr) {
-    if (arr.empty()) return;
-    
-    std::cout << "开始基数排序..." << std::endl;
-    
-    // 获取最大数的位数
-    int maxDigits = getMaxDigits(arr);
-    std::cout << "数组中最大数的位数: " << maxDigits << std::endl;
-    printArray(arr, "原数组: ");
-    std::cout << std::endl;
-    
-    // 对每一位进行计数排序
-    for (int digit = 1; digit <= maxDigits; digit++) {
-        std::cout << "正在对第 " << digit << " 位进行排序:" << std::endl;
-        countingSortForRadix(arr, digit);
-        printArray(arr, "    排序后: ");
-        std::cout << std::endl;
-    }
-}
-
 /**
  * 主函数，用于测试基数排序算法
  */
@@ -151,6 +47,35 @@ int main() {
     
     std::cout << "========================================" << std::endl;
     printArray(arr, "最终排序结果: ");
+    
+    // 按字节的基数排序通过键变换支持负数和浮点数
+    std::cout << std::endl << "按字节的LSD基数排序:" << std::endl;
+    std::vector<int> signedArr = {329, -457, 657, -839, 0, 720, -1};
+    printArray(signedArr, "排序前: ");
+    lsdRadixSort(signedArr);
+    printArray(signedArr, "排序后: ");
+    
+    std::vector<double> doubles = {3.5, -0.25, 1e10, -7.0, 0.0, 2.75};
+    std::cout << "排序前: ";
+    for (double d : doubles) std::cout << d << " ";
+    std::cout << std::endl;
+    lsdRadixSort(doubles);
+    std::cout << "排序后: ";
+    for (double d : doubles) std::cout << d << " ";
+    std::cout << std::endl << std::endl;
+    
+    // 并行MSD基数排序：第一层按最高字节并行分配，各个桶再作为独立任务递归排序
+    std::cout << "并行MSD基数排序:" << std::endl;
+    std::vector<int> large(100000);
+    unsigned int seed = 12345;
+    for (int& x : large) {
+        seed = seed * 1103515245 + 12345;
+        x = static_cast<int>(seed >> 1) - (1 << 30);
+    }
+    parallelMsdRadixSort(large, 4);
+    std::cout << "元素个数: " << large.size() << "，线程数: 4，是否有序: "
+              << (std::is_sorted(large.begin(), large.end()) ? "是" : "否") << std::endl << std::endl;
+    
     std::cout << "基数排序算法演示完成!" << std::endl;
     
     return 0;
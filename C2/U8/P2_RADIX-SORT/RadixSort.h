@@ -0,0 +1,229 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#ifndef CLRS_C2_U8_RADIX_SORT_H
+#define CLRS_C2_U8_RADIX_SORT_H
+
+#include <vector>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include "common/Trace.h"
+
+/**
+ * 获取数字中指定位上的数字
+ * @param num 数字
+ * @param digit 位数（从右往左数，从1开始）
+ * @return 指定位上的数字
+ */
+template<typename T>
+int getDigit(T num, int digit) {
+    for (int i = 1; i < digit; i++) {
+        num /= 10;
+    }
+    return static_cast<int>(num % 10);
+}
+
+/**
+ * 获取数组中最大数的位数
+ * @param arr 数组
+ * @return 最大数的位数
+ */
+template<typename T>
+int getMaxDigits(const std::vector<T>& arr) {
+    T maxVal = *std::max_element(arr.begin(), arr.end());
+    int digits = 0;
+    while (maxVal > 0) {
+        maxVal /= 10;
+        digits++;
+    }
+    return digits;
+}
+
+/**
+ * 计数排序（针对指定位）
+ * @param arr 待排序数组
+ * @param digit 位数（从右往左数，从1开始）
+ */
+template<typename T>
+void countingSortForRadix(std::vector<T>& arr, int digit) {
+    int n = arr.size();
+    std::vector<T> output(n);
+    std::vector<int> count(10, 0); // 0-9十个数字
+    
+    TRACE_STEP("    对第 " << digit << " 位进行计数排序" << std::endl);
+    
+    // 统计当前位上各数字出现的次数
+    TRACE_STEP("    统计各数字出现次数: ");
+    for (int i = 0; i < n; i++) {
+        int d = getDigit(arr[i], digit);
+        count[d]++;
+        TRACE_STEP("arr[" << i << "]=" << arr[i] << "(第" << digit << "位是" << d << ") ");
+    }
+    TRACE_STEP(std::endl);
+    
+    TRACE_STEP("    计数数组: " << trace::range(count) << std::endl);
+    
+    // 计算累积计数
+    for (int i = 1; i < 10; i++) {
+        count[i] += count[i - 1];
+    }
+    TRACE_STEP("    计算累积计数: " << trace::range(count) << std::endl);
+    
+    // 构建输出数组（从右到左遍历保证稳定性）
+    TRACE_STEP("    构建输出数组: ");
+    for (int i = n - 1; i >= 0; i--) {
+        int d = getDigit(arr[i], digit);
+        int pos = count[d] - 1;
+        output[pos] = arr[i];
+        count[d]--;
+        TRACE_STEP("arr[" << i << "]=" << arr[i] << " 放置在位置 " << pos << " ");
+    }
+    TRACE_STEP(std::endl);
+    
+    // 将排序结果复制回原数组
+    arr.swap(output);
+}
+
+/**
+ * 基数排序算法实现
+ * 《算法导论》第八章线性时间排序中的基数排序
+ * @param arr 待排序的数组，元素为非负整数
+ */
+template<typename T>
+void radixSort(std::vector<T>& arr) {
+    static_assert(std::is_integral<T>::value, "radixSort requires integral keys");
+    if (arr.empty()) return;
+    
+    TRACE_SUMMARY("开始基数排序..." << std::endl);
+    
+    // 获取最大数的位数
+    int maxDigits = getMaxDigits(arr);
+    TRACE_SUMMARY("数组中最大数的位数: " << maxDigits << std::endl);
+    TRACE_STEP("原数组: " << trace::range(arr) << std::endl << std::endl);
+    
+    // 对每一位进行计数排序
+    for (int digit = 1; digit <= maxDigits; digit++) {
+        TRACE_STEP("正在对第 " << digit << " 位进行排序:" << std::endl);
+        countingSortForRadix(arr, digit);
+        TRACE_STEP("    排序后: " << trace::range(arr) << std::endl << std::endl);
+    }
+}
+
+/**
+ * 基数排序的键变换：把元素映射为按字节比较即可保持原有顺序的无符号整数
+ *   无符号整数：原样使用
+ *   有符号整数：翻转符号位，负数排到非负数之前
+ *   浮点数：    按位解释后，负数按位取反、非负数翻转符号位（NaN 按符号排在两端）
+ */
+template<typename T, typename Enable = void>
+struct RadixKey;
+
+template<typename T>
+struct RadixKey<T, std::enable_if_t<std::is_integral<T>::value>> {
+    using type = std::make_unsigned_t<T>;
+
+    static type encode(T value) {
+        type bits = static_cast<type>(value);
+        if (std::is_signed<T>::value) {
+            bits ^= type(1) << (std::numeric_limits<type>::digits - 1);
+        }
+        return bits;
+    }
+};
+
+template<typename T>
+struct RadixKey<T, std::enable_if_t<std::is_floating_point<T>::value>> {
+    static_assert(sizeof(T) == 4 || sizeof(T) == 8, "radix keys support 32-bit and 64-bit floating point");
+    using type = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+
+    static type encode(T value) {
+        type bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        const type sign = type(1) << (std::numeric_limits<type>::digits - 1);
+        return (bits & sign) ? ~bits : (bits | sign);
+    }
+};
+
+/**
+ * 按字节的 LSD 基数排序，按 keyOf 取出的键对元素（记录）排序
+ * 每趟按键的一个字节（256 个桶）做稳定的计数排序，从最低字节到最高字节：
+ *   一次遍历同时统计所有字节的直方图；
+ *   某个字节在所有元素上都相同时整趟跳过；
+ *   在原数组与缓冲区之间来回分配（ping-pong），不必每趟把结果复制回去。
+ * 排序是稳定的，键相同的记录保持原有的相对顺序
+ * @param arr 待排序的数组
+ * @param keyOf keyOf(x) 返回元素 x 的键，可以是有符号、无符号整数（包括 64 位）或 float / double
+ * @param buffer 缓冲区，大小会被调整为 arr.size()，可在多次调用之间复用以避免重复分配
+ */
+template<typename T, typename KeyOf>
+void lsdRadixSortBy(std::vector<T>& arr, KeyOf keyOf, std::vector<T>& buffer) {
+    using KeyType = std::decay_t<decltype(keyOf(arr[0]))>;
+    using Key = typename RadixKey<KeyType>::type;
+    constexpr int passes = sizeof(Key);
+    const size_t n = arr.size();
+    if (n < 2) return;
+
+    TRACE_SUMMARY("开始按字节的LSD基数排序，共 " << passes << " 个字节..." << std::endl);
+
+    // 一次遍历统计每个字节的直方图
+    std::array<std::array<size_t, 256>, passes> histograms {};
+    for (size_t i = 0; i < n; i++) {
+        Key key = RadixKey<KeyType>::encode(keyOf(arr[i]));
+        for (int p = 0; p < passes; p++) {
+            histograms[p][(key >> (8 * p)) & 0xFF]++;
+        }
+    }
+
+    buffer.resize(n);
+    T* src = arr.data();
+    T* dst = buffer.data();
+    for (int p = 0; p < passes; p++) {
+        std::array<size_t, 256>& count = histograms[p];
+
+        // 所有元素在该字节上相同，这一趟不会改变顺序
+        if (count[(RadixKey<KeyType>::encode(keyOf(src[0])) >> (8 * p)) & 0xFF] == n) {
+            TRACE_STEP("    第 " << p << " 个字节全部相同，跳过" << std::endl);
+            TRACE_COUNT("lsdRadixSort.skippedPasses");
+            continue;
+        }
+
+        // 直方图转为各桶的起始位置
+        size_t offset = 0;
+        for (size_t& c : count) {
+            size_t bucketSize = c;
+            c = offset;
+            offset += bucketSize;
+        }
+
+        for (size_t i = 0; i < n; i++) {
+            dst[count[(RadixKey<KeyType>::encode(keyOf(src[i])) >> (8 * p)) & 0xFF]++] = src[i];
+        }
+        std::swap(src, dst);
+        TRACE_COUNT("lsdRadixSort.passes");
+    }
+
+    // 最后一趟写到了缓冲区中，交换两个 vector 的存储即可，无需复制
+    if (src != arr.data()) {
+        arr.swap(buffer);
+    }
+}
+
+/**
+ * 按字节的 LSD 基数排序
+ * 支持有符号、无符号整数（包括 64 位）和 float / double，详见 lsdRadixSortBy
+ * @param arr 待排序的数组
+ */
+template<typename T>
+void lsdRadixSort(std::vector<T>& arr) {
+    std::vector<T> buffer;
+    lsdRadixSortBy(arr, [](const T& x) { return x; }, buffer);
+}
+
+#endif //CLRS_C2_U8_RADIX_SORT_H
@@ -7,6 +7,8 @@
 #include <algorithm>
 #include <list>
 
+#include "BucketSort.h"
+
 /**
  * 打印数组元素
  * @param arr 要打印的数组
@@ -22,64 +24,6 @@ void printArray(const std::vector<float>& arr, const std::string& msg = "") {
     std::cout << std::endl;
 }
 
-/**
- * 桶排序算法实现
- * 《算法导论》第八章线性时间排序中的桶排序
- * @param arr 待排序的数组，假设元素都在[0, 1)区间内
- */
-void bucketSort(std::vector<float>& arr) {
-    if (arr.empty()) return;
-    
-    std::cout << "开始桶排序..." << std::endl;
-    printArray(arr, "原数组: ");
-    
-    int n = arr.size();
-    
-    // 创建n个空桶
-    std::vector<std::list<float>> buckets(n);
-    
-    // 将数组元素分配到各个桶中
-    std::cout << "将元素分配到桶中:" << std::endl;
-    for (int i = 0; i < n; i++) {
-        // 计算元素应该放入哪个桶
-        int bucketIndex = n * arr[i];
-        buckets[bucketIndex].push_back(arr[i]);
-        std::cout << "  元素 " << arr[i] << " 放入桶 " << bucketIndex << std::endl;
-    }
-    
-    // 显示每个桶的内容
-    std::cout << "各桶内容:" << std::endl;
-    for (int i = 0; i < n; i++) {
-        std::cout << "  桶 " << i << ": ";
-        for (float val : buckets[i]) {
-            std::cout << val << " ";
-        }
-        std::cout << std::endl;
-    }
-    
-    // 对每个桶内的元素进行排序
-    std::cout << "对每个桶内元素进行排序:" << std::endl;
-    for (int i = 0; i < n; i++) {
-        if (!buckets[i].empty()) {
-            buckets[i].sort(); // 使用list自带的sort方法
-            std::cout << "  桶 " << i << " 排序后: ";
-            for (float val : buckets[i]) {
-                std::cout << val << " ";
-            }
-            std::cout << std::endl;
-        }
-    }
-    
-    // 按顺序将各桶中的元素放回原数组
-    std::cout << "合并各桶元素到结果数组:" << std::endl;
-    int index = 0;
-    for (int i = 0; i < n; i++) {
-        for (float val : buckets[i]) {
-            arr[index++] = val;
-        }
-    }
-}
-
 /**
  * 主函数，用于测试桶排序算法
  */
@@ -104,6 +48,23 @@ int main() {
     std::cout << std::endl;
     std::cout << "========================================" << std::endl;
     printArray(arr, "最终排序结果: ");
+    std::cout << std::endl;
+    
+    // 任意取值范围（包括负数和区间端点）与偏斜分布
+    std::vector<float> ranged = {12.5, -3.0, 7.25, 100.0, -3.0, 0.0, 42.0, 99.5};
+    printArray(ranged, "任意范围 排序前: ");
+    bucketSort(ranged);
+    printArray(ranged, "任意范围 排序后: ");
+    
+    std::vector<float> skewed;
+    for (int i = 1; i <= 12; i++) {
+        float x = static_cast<float>((i * 5) % 12 + 1) / 12.0f;
+        skewed.push_back(x * x * x * x * 1000.0f);
+    }
+    printArray(skewed, "偏斜分布 排序前: ");
+    bucketSort(skewed, BucketSplitters::Sampled);
+    printArray(skewed, "偏斜分布 排序后（抽样分位点）: ");
+    std::cout << std::endl;
     std::cout << "桶排序算法演示完成!" << std::endl;
     
     return 0;
@@ -0,0 +1,184 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#ifndef CLRS_C2_U8_BUCKET_SORT_H
+#define CLRS_C2_U8_BUCKET_SORT_H
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include "C1/U2/SORTING-NETWORK/SortingNetwork.h"
+#include "common/Trace.h"
+
+/**
+ * 桶边界的确定方式
+ */
+enum class BucketSplitters {
+    MinMax,  // 扫描最小、最大值，把 [min, max] 等分成 n 个桶，适合均匀分布
+    Sampled  // 抽样估计分位点，在相邻分位点之间线性插值，适合偏斜分布
+};
+
+// Sampled 方式使用的分位点段数与每段的抽样数
+inline constexpr size_t kBucketSplitterSegments = 256;
+inline constexpr size_t kBucketSamplesPerSegment = 16;
+
+/**
+ * 桶排序的核心：计数、分配、桶内排序
+ * 所有桶在一个连续数组中依次排列：先统计每个桶的元素个数，前缀和得到每个桶的起点，
+ * 再把元素分配到各自的位置。整个过程只分配固定的几块内存，与元素个数无关，不会为每个元素单独分配
+ * @param arr 待排序数组
+ * @param buckets 桶的个数
+ * @param bucketOf bucketOf(x) 返回元素 x 所在的桶，必须在 [0, buckets) 内且随 x 单调不减
+ */
+template<typename T, typename BucketOf>
+void bucketSortWith(std::vector<T>& arr, size_t buckets, BucketOf bucketOf) {
+    const size_t n = arr.size();
+
+    // 记下每个元素的桶号，分配时不必重新计算
+    std::vector<uint32_t> index(n);
+    std::vector<size_t> start(buckets + 1, 0);
+    TRACE_STEP("将元素分配到桶中:" << std::endl);
+    for (size_t i = 0; i < n; i++) {
+        index[i] = static_cast<uint32_t>(bucketOf(arr[i]));
+        start[index[i] + 1]++;
+        TRACE_STEP("  元素 " << arr[i] << " 放入桶 " << index[i] << std::endl);
+    }
+    for (size_t b = 0; b < buckets; b++) {
+        start[b + 1] += start[b];
+    }
+
+    std::vector<T> output(n);
+    std::vector<size_t> next(start.begin(), start.end() - 1);
+    for (size_t i = 0; i < n; i++) {
+        output[next[index[i]]++] = arr[i];
+    }
+
+    // 对每个桶内的元素排序，较大的桶由 smallSort 交给排序网络
+    TRACE_STEP("对每个桶内元素进行排序:" << std::endl);
+    for (size_t b = 0; b < buckets; b++) {
+        if (start[b + 1] - start[b] > 1) {
+            smallSort(output, (int)start[b], (int)start[b + 1] - 1);
+            TRACE_STEP("  桶 " << b << " 排序后: " << trace::range(output, start[b], (long)start[b + 1] - 1) << std::endl);
+            TRACE_COUNT("bucketSort.nonTrivialBuckets");
+        }
+    }
+
+    arr.swap(output);
+}
+
+/**
+ * 桶排序算法实现
+ * 《算法导论》第八章线性时间排序中的桶排序，推广到任意取值范围：
+ *   MinMax  先扫描出 [min, max]，元素 x 放入第 ⌊(x - min) / (max - min) · n⌋ 个桶（x = max 时归入最后一个桶）；
+ *   Sampled 抽样排序后取 kBucketSplitterSegments 段分位点，x 先二分查找所在的段，
+ *           再在段内线性插值，相当于用分段线性函数近似分布函数，偏斜数据也能均匀地落入各桶。
+ * 浮点数的 ±∞ 不参与确定 [min, max]，分别放入首尾两个额外的桶。
+ * 输入分布与估计的分布一致时，每个桶的期望元素个数为常数，期望运行时间为 O(n)
+ * @param arr 待排序的数组，元素为整数或浮点数（不能包含 NaN）
+ * @param splitters 桶边界的确定方式
+ * @throws std::invalid_argument 如果数组中含有 NaN
+ */
+template<typename T>
+void bucketSort(std::vector<T>& arr, BucketSplitters splitters = BucketSplitters::MinMax) {
+    static_assert(std::is_arithmetic<T>::value, "bucketSort requires arithmetic keys");
+    const size_t n = arr.size();
+    if (n < 2) return;
+
+    TRACE_SUMMARY("开始桶排序..." << std::endl);
+    TRACE_STEP("原数组: " << trace::range(arr) << std::endl);
+
+    // 有限元素的取值范围；浮点数同时检查 NaN、统计 ±∞ 的个数
+    double lo;
+    double hi;
+    size_t infinities = 0;
+    if constexpr (std::is_floating_point<T>::value) {
+        lo = std::numeric_limits<double>::infinity();
+        hi = -lo;
+        for (const T& x : arr) {
+            if (std::isnan(x)) {
+                throw std::invalid_argument("bucketSort does not accept NaN keys");
+            }
+            if (std::isinf(x)) {
+                infinities++;
+                continue;
+            }
+            lo = std::min(lo, static_cast<double>(x));
+            hi = std::max(hi, static_cast<double>(x));
+        }
+    } else {
+        auto bounds = std::minmax_element(arr.begin(), arr.end());
+        lo = static_cast<double>(*bounds.first);
+        hi = static_cast<double>(*bounds.second);
+    }
+    if (!(lo < hi) && infinities == 0) return;  // 所有元素相等
+
+    // 有 ±∞ 时在首尾各加一个桶，有限元素的桶号整体后移一位
+    const size_t offset = infinities > 0 ? 1 : 0;
+    const size_t buckets = n + 2 * offset;
+    auto sortFinite = [&](auto finiteBucket) {
+        bucketSortWith(arr, buckets, [&](const T& x) -> size_t {
+            if constexpr (std::is_floating_point<T>::value) {
+                if (x == -std::numeric_limits<T>::infinity()) return 0;
+                if (x == std::numeric_limits<T>::infinity()) return buckets - 1;
+            }
+            return offset + finiteBucket(x);
+        });
+    };
+
+    // 有限元素全部相等（或没有有限元素）时只需把 ±∞ 移到两端
+    if (splitters == BucketSplitters::MinMax || !(lo < hi)) {
+        // 差值先各自除以 2（对正规数是精确的），hi - lo 超出 double 的范围时也不会溢出
+        const double scale = lo < hi ? static_cast<double>(n) / (hi * 0.5 - lo * 0.5) : 0.0;
+        sortFinite([&](const T& x) {
+            size_t b = static_cast<size_t>((static_cast<double>(x) * 0.5 - lo * 0.5) * scale);
+            return std::min(b, n - 1);
+        });
+        return;
+    }
+
+    // 等间隔抽样并排序，取出各段的分位点，首尾分别是真实的最小、最大值
+    const size_t segments = std::min(kBucketSplitterSegments, n);
+    const size_t sampleCount = std::min(n, segments * kBucketSamplesPerSegment);
+    std::vector<double> samples(sampleCount);
+    for (size_t i = 0; i < sampleCount; i++) {
+        // 抽到的 ±∞ 截断为有限元素的最小、最大值
+        samples[i] = std::min(hi, std::max(lo, static_cast<double>(arr[i * n / sampleCount])));
+    }
+    std::sort(samples.begin(), samples.end());
+    std::vector<double> quantiles(segments + 1);
+    for (size_t j = 0; j <= segments; j++) {
+        quantiles[j] = samples[j * (sampleCount - 1) / segments];
+    }
+    quantiles.front() = lo;
+    quantiles.back() = hi;
+    TRACE_STEP("抽样得到的分位点: " << trace::range(quantiles) << std::endl);
+
+    const double bucketsPerSegment = static_cast<double>(n) / static_cast<double>(segments);
+    sortFinite([&](const T& x) {
+        const double v = static_cast<double>(x);
+        // 无分支的二分查找：j 为 quantiles[1..segments] 中不大于 v 的个数
+        const double* base = quantiles.data() + 1;
+        size_t len = segments;
+        while (len > 1) {
+            size_t half = len / 2;
+            base = base[half] <= v ? base + half : base;
+            len -= half;
+        }
+        size_t j = static_cast<size_t>(base - (quantiles.data() + 1)) + (*base <= v);
+        j = std::min(j, segments - 1);
+        const double width = quantiles[j + 1] - quantiles[j];
+        double fraction = width > 0 ? (v - quantiles[j]) / width : 0.0;
+        fraction = std::min(1.0, std::max(0.0, fraction));
+        size_t b = static_cast<size_t>((static_cast<double>(j) + fraction) * bucketsPerSegment);
+        return std::min(b, n - 1);
+    });
+}
+
+#endif //CLRS_C2_U8_BUCKET_SORT_H
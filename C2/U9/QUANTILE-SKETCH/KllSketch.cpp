@@ -0,0 +1,93 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "KllSketch.h"
+#include "C2/U9/RANDOMIZED-SELECT/RandomizedSelect.h"
+
+/**
+ * 主函数，用于测试 KLL 分位数草图
+ */
+int main() {
+#ifdef ACM_LOCAL
+    freopen("data.in", "r", stdin);
+    freopen("data.out", "w", stdout);
+#endif
+
+    std::cout << "========================================" << std::endl;
+    std::cout << "      KLL分位数草图演示" << std::endl;
+    std::cout << "========================================" << std::endl << std::endl;
+
+    // 模拟请求延迟（微秒）：对数正态分布，长尾
+    const int n = 200000;
+    const int threads = 4;
+    std::vector<int> latencies(n);
+    std::mt19937 rng(2026);
+    std::lognormal_distribution<double> dist(6.0, 0.8);
+    for (int& x : latencies) {
+        x = (int)dist(rng);
+    }
+
+    // 每个线程各用一个草图处理一段数据流，最后合并
+    std::vector<KllSketch<int>> sketches;
+    for (int t = 0; t < threads; t++) {
+        sketches.emplace_back(kKllDefaultK, 100 + t);
+    }
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++) {
+        workers.emplace_back([&, t] {
+            for (int i = t; i < n; i += threads) {
+                sketches[t].update(latencies[i]);
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    KllSketch<int> sketch = sketches[0];
+    for (int t = 1; t < threads; t++) {
+        sketch.merge(sketches[t]);
+    }
+
+    std::cout << "元素个数: " << sketch.size() << "，线程数: " << threads << std::endl;
+    std::cout << "草图保存的元素个数: " << sketch.retained() << "（k = " << sketch.k() << "）" << std::endl;
+    std::cout << "归一化秩误差上界（99% 置信度）: " << std::fixed << std::setprecision(2)
+              << sketch.normalizedRankError() * 100 << "%" << std::endl << std::endl;
+
+    // 与精确的顺序统计量比较：秩误差 = 估计值的真实秩与目标秩之差
+    std::vector<int> sorted = latencies;
+    std::sort(sorted.begin(), sorted.end());
+    std::vector<double> qs = {0.01, 0.25, 0.5, 0.75, 0.9, 0.99, 0.999};
+    std::vector<int> estimates = sketch.quantiles(qs);
+    double worst = 0;
+    std::cout << "分位数    精确值    估计值    秩误差" << std::endl;
+    for (size_t i = 0; i < qs.size(); i++) {
+        int rank = std::max(1, (int)std::ceil(qs[i] * n));
+        std::vector<int> copy = latencies;
+        int exact = threeWayRandomizedSelect(copy, rank);
+
+        // 估计值对应的真实秩是一个区间（有重复值），取与目标秩最近的一端
+        long lo = std::lower_bound(sorted.begin(), sorted.end(), estimates[i]) - sorted.begin() + 1;
+        long hi = std::upper_bound(sorted.begin(), sorted.end(), estimates[i]) - sorted.begin();
+        double error = rank < lo ? (double)(lo - rank) / n : rank > hi ? (double)(rank - hi) / n : 0.0;
+        worst = std::max(worst, error);
+        std::cout << std::left << std::defaultfloat << std::setprecision(4) << std::setw(10) << qs[i]
+                  << std::setw(10) << exact << std::setw(10) << estimates[i]
+                  << std::fixed << std::setprecision(2) << error * 100 << "%" << std::endl;
+    }
+    std::cout << std::endl << "最大秩误差: " << worst * 100 << "%，"
+              << (worst <= sketch.normalizedRankError() ? "在误差上界之内" : "超出误差上界") << std::endl;
+
+    std::cout << std::endl << "========================================" << std::endl;
+    std::cout << "KLL分位数草图演示完成!" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,269 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#ifndef CLRS_C2_U9_KLL_SKETCH_H
+#define CLRS_C2_U9_KLL_SKETCH_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "common/Trace.h"
+
+// 默认精度参数 k，对应约 1.3% 的归一化秩误差
+inline constexpr int kKllDefaultK = 200;
+
+// 每层压缩器的最小容量
+inline constexpr int kKllMinCapacity = 8;
+
+/**
+ * KLL 分位数草图（Karnin、Lang、Liberty，2016）
+ *
+ * 以有限内存逐个接收元素，估计任意值的秩与任意分位数：
+ * - 第 h 层压缩器中的每个元素代表 2^h 个原始元素。新元素进入第 0 层；
+ * - 某层装满时排序，随机取奇数位或偶数位上的一半元素升入上一层，其余丢弃，总权重不变；
+ * - 越高的层容量越大，第 h 层（共 H 层）的容量约为 k·(2/3)^(H-1-h)，总元素数为 O(k)，
+ *   与输入长度几乎无关（另加 O(log(n/k)) 层各至少 kKllMinCapacity 个元素）。
+ * 估计的秩的误差 ε 与 n 无关，只取决于 k，见 normalizedRankError()。
+ * 两个草图可以合并：同层元素拼在一起再压缩，误差保证不变，因此每个线程可以各用一个草图，最后合并。
+ *
+ * 用法：
+ *   KllSketch<double> sketch;
+ *   for (double x : stream) sketch.update(x);
+ *   double p99 = sketch.quantile(0.99);
+ */
+template<typename T, typename Compare = std::less<T>>
+class KllSketch {
+public:
+    /**
+     * @param k 精度参数，越大越精确，内存约为 3k 个元素
+     * @param seed 压缩时随机选择奇偶位的种子
+     * @throws std::invalid_argument 如果k小于kKllMinCapacity
+     */
+    explicit KllSketch(int k = kKllDefaultK, uint32_t seed = std::random_device()(), Compare comp = Compare())
+            : k_(k), levels_(1), rng_(seed), comp_(comp) {
+        if (k < kKllMinCapacity) {
+            throw std::invalid_argument("KLL parameter k is too small");
+        }
+        updateCapacities();
+    }
+
+    /**
+     * 接收一个元素，均摊 O(log k) 时间
+     */
+    void update(const T& x) {
+        if (n_ == 0 || comp_(x, min_)) min_ = x;
+        if (n_ == 0 || comp_(max_, x)) max_ = x;
+        n_++;
+        levels_[0].push_back(x);
+        retained_++;
+        if (retained_ >= totalCapacity_) {
+            compress();
+        }
+    }
+
+    /**
+     * 把另一个草图合并进来，合并后的误差保证与一次性接收全部元素相同
+     * 两者的 k 不同时取较小的一个
+     */
+    void merge(const KllSketch& other) {
+        if (other.n_ == 0) {
+            return;
+        }
+        if (&other == this) {
+            KllSketch copy(other);
+            merge(copy);
+            return;
+        }
+        TRACE_SUMMARY("合并 KLL 草图，元素数: " << n_ << " + " << other.n_ << std::endl);
+        if (n_ == 0 || comp_(other.min_, min_)) min_ = other.min_;
+        if (n_ == 0 || comp_(max_, other.max_)) max_ = other.max_;
+        n_ += other.n_;
+        k_ = std::min(k_, other.k_);
+        if (levels_.size() < other.levels_.size()) {
+            levels_.resize(other.levels_.size());
+        }
+        for (size_t h = 0; h < other.levels_.size(); h++) {
+            levels_[h].insert(levels_[h].end(), other.levels_[h].begin(), other.levels_[h].end());
+            retained_ += other.levels_[h].size();
+        }
+        updateCapacities();
+        compress();
+    }
+
+    /**
+     * 已接收的元素个数
+     */
+    uint64_t size() const {
+        return n_;
+    }
+
+    bool empty() const {
+        return n_ == 0;
+    }
+
+    /**
+     * 草图当前保存的元素个数，即内存占用
+     */
+    size_t retained() const {
+        return retained_;
+    }
+
+    int k() const {
+        return k_;
+    }
+
+    /**
+     * 归一化秩误差：以 99% 的置信度，rank() 与 quantile() 的秩误差不超过 ε·n
+     * 采用 Apache DataSketches 对同一压缩方案实测拟合的 ε ≈ 2.296 / k^0.9723，k = 200 时约为 1.33%
+     */
+    double normalizedRankError() const {
+        return 2.296 / std::pow((double)k_, 0.9723);
+    }
+
+    /**
+     * 估计不大于 x 的元素所占的比例
+     * @return [0, 1] 内的归一化秩
+     * @throws std::out_of_range 如果草图为空
+     */
+    double rank(const T& x) const {
+        if (n_ == 0) {
+            throw std::out_of_range("Rank of empty sketch");
+        }
+        uint64_t weight = 0;
+        for (size_t h = 0; h < levels_.size(); h++) {
+            for (const T& y : levels_[h]) {
+                if (!comp_(x, y)) {
+                    weight += uint64_t(1) << h;
+                }
+            }
+        }
+        return (double)weight / (double)n_;
+    }
+
+    /**
+     * 估计 q 分位数：排好序后累计权重首次达到 q·n 的元素，q = 0、1 时分别返回精确的最小值、最大值
+     * @throws std::out_of_range 如果草图为空
+     * @throws std::invalid_argument 如果q不在[0, 1]内
+     */
+    T quantile(double q) const {
+        return quantiles({q}).front();
+    }
+
+    /**
+     * 一次估计多个分位数，只排序一次
+     * @param qs 分位数，取值在 [0, 1] 内
+     * @return 与 qs 一一对应的估计值
+     * @throws std::out_of_range 如果草图为空
+     * @throws std::invalid_argument 如果某个分位数不在[0, 1]内
+     */
+    std::vector<T> quantiles(const std::vector<double>& qs) const {
+        if (n_ == 0) {
+            throw std::out_of_range("Quantile of empty sketch");
+        }
+        std::vector<std::pair<T, uint64_t>> weighted;
+        weighted.reserve(retained_);
+        for (size_t h = 0; h < levels_.size(); h++) {
+            for (const T& y : levels_[h]) {
+                weighted.emplace_back(y, uint64_t(1) << h);
+            }
+        }
+        std::sort(weighted.begin(), weighted.end(),
+                  [this](const std::pair<T, uint64_t>& a, const std::pair<T, uint64_t>& b) {
+                      return comp_(a.first, b.first);
+                  });
+        // 原地改成累计权重，便于二分查找
+        for (size_t i = 1; i < weighted.size(); i++) {
+            weighted[i].second += weighted[i - 1].second;
+        }
+
+        std::vector<T> result;
+        result.reserve(qs.size());
+        for (double q : qs) {
+            if (!(q >= 0.0 && q <= 1.0)) {
+                throw std::invalid_argument("Quantile must be in [0, 1]");
+            }
+            if (q == 0.0) {
+                result.push_back(min_);
+            } else if (q == 1.0) {
+                result.push_back(max_);
+            } else {
+                uint64_t target = (uint64_t)std::ceil(q * (double)n_);
+                auto it = std::lower_bound(weighted.begin(), weighted.end(), target,
+                                           [](const std::pair<T, uint64_t>& a, uint64_t w) { return a.second < w; });
+                result.push_back(it == weighted.end() ? max_ : it->first);
+            }
+        }
+        return result;
+    }
+
+private:
+    /**
+     * 层数或 k 变化后重新计算各层容量：最高层为 k，往下每层乘以 2/3，但不小于 kKllMinCapacity
+     */
+    void updateCapacities() {
+        capacities_.resize(levels_.size());
+        totalCapacity_ = 0;
+        double c = k_;
+        for (size_t h = levels_.size(); h-- > 0; c *= 2.0 / 3.0) {
+            capacities_[h] = std::max<size_t>(kKllMinCapacity, (size_t)std::ceil(c));
+            totalCapacity_ += capacities_[h];
+        }
+    }
+
+    /**
+     * 从低到高压缩已满的层，直到总元素数低于总容量
+     */
+    void compress() {
+        while (retained_ >= totalCapacity_) {
+            size_t h = 0;
+            while (levels_[h].size() < capacities_[h]) {
+                h++;
+            }
+            compact(h);
+        }
+    }
+
+    /**
+     * 压缩第 h 层：排序后随机取奇数位或偶数位上的元素升入第 h + 1 层，
+     * 元素个数为奇数时最小的一个留在本层
+     */
+    void compact(size_t h) {
+        if (h + 1 == levels_.size()) {
+            levels_.emplace_back();
+            updateCapacities();
+            TRACE_STEP("  KLL 草图增加第 " << levels_.size() - 1 << " 层，元素数: " << n_ << std::endl);
+        }
+        std::vector<T>& level = levels_[h];
+        std::sort(level.begin(), level.end(), comp_);
+        size_t odd = level.size() % 2;
+        size_t offset = rng_() & 1;
+        std::vector<T>& above = levels_[h + 1];
+        for (size_t i = odd + offset; i < level.size(); i += 2) {
+            above.push_back(level[i]);
+        }
+        retained_ -= (level.size() - odd) / 2;
+        level.resize(odd);
+        TRACE_COUNT("kllSketch.compactions");
+    }
+
+    int k_;
+    uint64_t n_ = 0;
+    size_t retained_ = 0;
+    std::vector<std::vector<T>> levels_;  // levels_[h] 中每个元素的权重为 2^h
+    std::vector<size_t> capacities_;      // 各层容量
+    size_t totalCapacity_ = 0;
+    T min_{};
+    T max_{};
+    std::mt19937 rng_;
+    Compare comp_;
+};
+
+#endif //CLRS_C2_U9_KLL_SKETCH_H
@@ -0,0 +1,262 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#ifndef CLRS_C2_U9_INTRO_SELECT_H
+#define CLRS_C2_U9_INTRO_SELECT_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "C2/U7/QUICK-SORT/QuickSort.h"
+#include "common/Trace.h"
+
+// 子数组长度超过该值时用 Floyd–Rivest 抽样选基准，否则用三数/九数取中
+inline constexpr int kFloydRivestThreshold = 600;
+
+/**
+ * 按 k 收窄选择范围：k 落在等于基准的区间内时返回 true，否则把 [low, high] 缩到 k 所在的一侧
+ * @param equal threeWayPartition 返回的等于基准的区间
+ */
+inline bool narrowToRank(std::pair<int, int> equal, int k, int& low, int& high) {
+    if (k < equal.first) {
+        high = equal.first - 1;
+    } else if (k > equal.second) {
+        low = equal.second + 1;
+    } else {
+        return true;
+    }
+    return false;
+}
+
+/**
+ * 中位数的中位数选择（BFPRT，《算法导论》9.3 节的 SELECT）
+ * 每 5 个元素一组排序，把各组中位数移到子数组前部，递归求出它们的中位数作为基准。
+ * 至少约 3/10 的元素落在基准的每一侧，最坏时间复杂度 O(n)，但常数较大，只作为兜底
+ * 结束后 arr[k] 为 arr[low..high] 中第 k - low + 1 小的元素，其左侧不大于它、右侧不小于它
+ * @param arr 待处理数组
+ * @param low 起始索引
+ * @param high 结束索引
+ * @param k 目标位置（0-based 的数组下标，low ≤ k ≤ high）
+ * @param comp 比较器
+ */
+template<typename T, typename Compare>
+void medianOfMediansSelect(std::vector<T>& arr, int low, int high, int k, Compare comp) {
+    while (high - low + 1 > kIntroSortThreshold) {
+        // 各组中位数依次换到 arr[low..low+groups-1]，写入位置总在尚未处理的组之前
+        int groups = 0;
+        for (int g = low; g + 4 <= high; g += 5) {
+            insertionSort(arr, g, g + 4, comp);
+            std::swap(arr[low + groups], arr[g + 2]);
+            groups++;
+        }
+        int mid = low + groups / 2;
+        medianOfMediansSelect(arr, low, low + groups - 1, mid, comp);
+
+        std::swap(arr[mid], arr[high]);
+        std::pair<int, int> equal = threeWayPartition(arr, low, high, comp);
+        TRACE_COUNT("introSelect.medianOfMediansPartitions");
+        if (narrowToRank(equal, k, low, high)) {
+            return;
+        }
+    }
+    smallSort(arr, low, high, comp);
+}
+
+/**
+ * 内省选择（introselect）：Floyd–Rivest 抽样作为快速路径，中位数的中位数作为最坏情况的兜底
+ *
+ * 1. 子数组较长时，按 Floyd–Rivest 取出以 k 为中心、长度约 n^(2/3) 的一段作为样本，
+ *    先递归地在样本内把第 k 个元素选出来，再用它做基准三路划分。
+ *    这个基准离真正的第 k 小元素很近，划分后 k 所在的一侧通常只剩 O(n^(2/3)) 个元素，
+ *    比较次数约为 n + min(k, n - k) + o(n)，接近下界；
+ * 2. 子数组较短时用三数/九数取中选基准；
+ * 3. 每划分两次检查一次范围是否至少缩小一半，没有则说明基准持续选得很差（例如构造的输入），
+ *    剩余部分改用 medianOfMediansSelect，总时间仍为最坏 O(n)。
+ * 结束后 arr[k] 为 arr[low..high] 中第 k - low + 1 小的元素，其左侧不大于它、右侧不小于它
+ * @param arr 待处理数组
+ * @param low 起始索引
+ * @param high 结束索引
+ * @param k 目标位置（0-based 的数组下标，low ≤ k ≤ high）
+ * @param comp 比较器
+ */
+template<typename T, typename Compare>
+void introSelect(std::vector<T>& arr, int low, int high, int k, Compare comp) {
+    int checkpoint = high - low + 1;
+    int rounds = 0;
+    while (high - low + 1 > smallSortThreshold<T, Compare>()) {
+        const int n = high - low + 1;
+        if (rounds > 0 && rounds % 2 == 0) {
+            if (n > checkpoint / 2) {
+                TRACE_STEP("  范围 [" << low << ", " << high << "] 两轮划分后未减半，改用中位数的中位数" << std::endl);
+                TRACE_COUNT("introSelect.medianOfMediansFallbacks");
+                medianOfMediansSelect(arr, low, high, k, comp);
+                return;
+            }
+            checkpoint = n;
+        }
+        rounds++;
+
+        if (n > kFloydRivestThreshold) {
+            // Floyd–Rivest：样本长度 s ≈ 0.5·n^(2/3)，向 k 偏离中点的方向多留 sd 个元素的余量
+            const double z = std::log((double)n);
+            const double s = 0.5 * std::exp(2 * z / 3);
+            const double i = k - low + 1;
+            const double sd = 0.5 * std::sqrt(z * s * (n - s) / n) * (i < n / 2.0 ? -1 : 1);
+            int sampleLow = std::max(low, (int)(k - i * s / n + sd));
+            int sampleHigh = std::min(high, (int)(k + (n - i) * s / n + sd));
+            TRACE_STEP("  范围 [" << low << ", " << high << "]，在样本 [" << sampleLow << ", " << sampleHigh << "] 中选基准" << std::endl);
+            TRACE_COUNT("introSelect.floydRivestSamples");
+            introSelect(arr, sampleLow, sampleHigh, k, comp);
+        } else {
+            std::swap(arr[choosePivot(arr, low, high, comp)], arr[k]);
+        }
+
+        // 基准此时位于 arr[k]，换到末尾后三路划分
+        std::swap(arr[k], arr[high]);
+        std::pair<int, int> equal = threeWayPartition(arr, low, high, comp);
+        TRACE_COUNT("introSelect.partitions");
+        if (narrowToRank(equal, k, low, high)) {
+            return;
+        }
+    }
+    smallSort(arr, low, high, comp);
+}
+
+/**
+ * nth_element 风格的选择：把第 k + 1 小的元素放到 arr[k]，
+ * 其左侧的元素都不大于它，右侧的元素都不小于它，最坏时间复杂度 O(n)
+ * @param arr 待处理数组
+ * @param k 目标位置（0-based）
+ * @param comp 比较器
+ * @return arr[k]
+ * @throws std::out_of_range 如果k不在0到arr.size()-1之间
+ */
+template<typename T, typename Compare = std::less<T>>
+const T& nthElement(std::vector<T>& arr, int k, Compare comp = Compare()) {
+    if (k < 0 || k >= (int)arr.size()) {
+        throw std::out_of_range("Order statistic out of range");
+    }
+    TRACE_SUMMARY("开始内省选择，目标位置: " << k << std::endl);
+    introSelect(arr, 0, (int)arr.size() - 1, k, comp);
+    return arr[k];
+}
+
+/**
+ * Top-k：把最小的 k 个元素移到 arr[0..k-1]
+ * @param arr 待处理数组
+ * @param k 元素个数，0 ≤ k ≤ arr.size()
+ * @param comp 比较器
+ * @param sorted 为 true 时前 k 个元素按升序排列（partial_sort），否则顺序不定
+ * @throws std::out_of_range 如果k不在0到arr.size()之间
+ */
+template<typename T, typename Compare = std::less<T>>
+void selectTopK(std::vector<T>& arr, int k, Compare comp = Compare(), bool sorted = false) {
+    if (k < 0 || k > (int)arr.size()) {
+        throw std::out_of_range("Order statistic out of range");
+    }
+    if (k == 0) {
+        return;
+    }
+    TRACE_SUMMARY("开始选择最小的 " << k << " 个元素..." << std::endl);
+    introSelect(arr, 0, (int)arr.size() - 1, k - 1, comp);
+    if (sorted) {
+        introSortLoop(arr, 0, k - 2, introSortDepthLimit(k), comp);  // arr[k-1] 已经是其中最大的
+    }
+}
+
+/**
+ * 多重选择的递归：ranks[first, last) 为升序且互不相同的目标位置，都落在 [low, high] 内
+ * 每次选出中间的目标位置，左右两侧的目标位置分别只在对应一侧继续选择，
+ * q 个目标位置的总时间为 O(n log q)，而逐个调用 nthElement 为 O(nq)
+ */
+template<typename T, typename Compare>
+void multiSelect(std::vector<T>& arr, int low, int high,
+                 const std::vector<int>& ranks, size_t first, size_t last, Compare comp) {
+    while (first < last) {
+        size_t middle = first + (last - first) / 2;
+        int k = ranks[middle];
+        introSelect(arr, low, high, k, comp);
+        TRACE_COUNT("multiSelect.selections");
+        // 较短的一侧递归，较长的一侧在循环中继续处理
+        if (middle - first < last - middle - 1) {
+            multiSelect(arr, low, k - 1, ranks, first, middle, comp);
+            low = k + 1;
+            first = middle + 1;
+        } else {
+            multiSelect(arr, k + 1, high, ranks, middle + 1, last, comp);
+            high = k - 1;
+            last = middle;
+        }
+    }
+}
+
+/**
+ * 一次求出多个顺序统计量
+ * 结束后对每个目标位置 k，arr[k] 都是第 k + 1 小的元素，相邻两个目标位置之间的元素也已归位到对应区段
+ * @param arr 待处理数组
+ * @param ranks 目标位置（0-based），可以无序、可以重复
+ * @param comp 比较器
+ * @return 与 ranks 一一对应的顺序统计量
+ * @throws std::out_of_range 如果某个目标位置不在0到arr.size()-1之间
+ */
+template<typename T, typename Compare = std::less<T>>
+std::vector<T> multiSelect(std::vector<T>& arr, const std::vector<int>& ranks, Compare comp = Compare()) {
+    std::vector<int> sortedRanks(ranks);
+    std::sort(sortedRanks.begin(), sortedRanks.end());
+    sortedRanks.erase(std::unique(sortedRanks.begin(), sortedRanks.end()), sortedRanks.end());
+    if (!sortedRanks.empty() && (sortedRanks.front() < 0 || sortedRanks.back() >= (int)arr.size())) {
+        throw std::out_of_range("Order statistic out of range");
+    }
+    TRACE_SUMMARY("开始多重选择，目标位置个数: " << sortedRanks.size() << std::endl);
+    multiSelect(arr, 0, (int)arr.size() - 1, sortedRanks, 0, sortedRanks.size(), comp);
+
+    std::vector<T> result;
+    result.reserve(ranks.size());
+    for (int k : ranks) {
+        result.push_back(arr[k]);
+    }
+    return result;
+}
+
+/**
+ * 分位数对应的位置（最近秩法）：第 ⌈q·n⌉ 小的元素，q = 0 时取最小值
+ * q = 0.5 时与《算法导论》的下中位数一致
+ * @throws std::invalid_argument 如果q不在[0, 1]内
+ */
+inline int quantileRank(double q, size_t n) {
+    if (!(q >= 0.0 && q <= 1.0)) {
+        throw std::invalid_argument("Quantile must be in [0, 1]");
+    }
+    double rank = std::ceil(q * (double)n) - 1;
+    return (int)std::min<double>(std::max(rank, 0.0), (double)n - 1);
+}
+
+/**
+ * 一次求出多个分位数，例如 {0.5, 0.9, 0.99, 0.999}，用于百分位统计
+ * @param arr 待处理数组，结束后按各分位数的位置部分划分
+ * @param qs 分位数，取值在 [0, 1] 内
+ * @param comp 比较器
+ * @return 与 qs 一一对应的分位数
+ * @throws std::out_of_range 如果数组为空
+ * @throws std::invalid_argument 如果某个分位数不在[0, 1]内
+ */
+template<typename T, typename Compare = std::less<T>>
+std::vector<T> quantiles(std::vector<T>& arr, const std::vector<double>& qs, Compare comp = Compare()) {
+    if (arr.empty()) {
+        throw std::out_of_range("Order statistic out of range");
+    }
+    std::vector<int> ranks;
+    ranks.reserve(qs.size());
+    for (double q : qs) {
+        ranks.push_back(quantileRank(q, arr.size()));
+    }
+    return multiSelect(arr, ranks, comp);
+}
+
+#endif //CLRS_C2_U9_INTRO_SELECT_H
@@ -0,0 +1,167 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#ifndef CLRS_C2_U9_RANDOMIZED_SELECT_H
+#define CLRS_C2_U9_RANDOMIZED_SELECT_H
+
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <chrono>
+#include <stdexcept>
+
+#include "C2/U7/QUICK-SORT/QuickSort.h"
+#include "common/Trace.h"
+
+/**
+ * 随机化分区函数
+ * @param arr 待处理数组
+ * @param low 起始索引
+ * @param high 结束索引
+ * @param comp 比较器，comp(a, b) 为 true 表示 a 应排在 b 之前
+ * @return 分区点索引
+ */
+template<typename T, typename Compare = std::less<T>>
+int randomizedPartition(std::vector<T>& arr, int low, int high, Compare comp = Compare()) {
+    TRACE_STEP("  对范围 [" << low << ", " << high << "] 进行随机分区" << std::endl);
+    
+    // 随机选择一个元素作为基准
+    static thread_local std::mt19937 rng(std::chrono::steady_clock::now().time_since_epoch().count());
+    int randomIndex = low + rng() % (high - low + 1);
+    TRACE_STEP("  随机选择索引 " << randomIndex << " 的元素 " << arr[randomIndex] << " 作为基准" << std::endl);
+    std::swap(arr[randomIndex], arr[high]);
+    
+    // 使用标准分区算法
+    const T& pivot = arr[high];
+    int i = low - 1;
+    
+    TRACE_STEP("  使用 " << pivot << " 作为基准进行分区" << std::endl);
+    
+    for (int j = low; j < high; j++) {
+        if (!comp(pivot, arr[j])) {
+            i++;
+            if (i != j) {
+                TRACE_STEP("  交换 arr[" << i << "]=" << arr[i] << " 和 arr[" << j << "]=" << arr[j] << std::endl);
+                std::swap(arr[i], arr[j]);
+            }
+        }
+    }
+    
+    TRACE_STEP("  将基准元素放到正确位置，交换 arr[" << (i+1) << "]=" << arr[i+1] << " 和 arr[" << high << "]=" << arr[high] << std::endl);
+    std::swap(arr[i + 1], arr[high]);
+    TRACE_STEP("  分区完成，基准元素位置: " << (i+1) << std::endl);
+    TRACE_COUNT("randomizedSelect.partitions");
+    
+    return i + 1;
+}
+
+/**
+ * 随机选择算法（期望线性时间）
+ * 《算法导论》第九章中位数和顺序统计量中的RANDOMIZED-SELECT算法
+ * @param arr 待处理数组
+ * @param low 起始索引
+ * @param high 结束索引
+ * @param i 查找第i小的元素（1-based）
+ * @param comp 比较器
+ * @return 第i小的元素
+ */
+template<typename T, typename Compare = std::less<T>>
+const T& randomizedSelect(std::vector<T>& arr, int low, int high, int i, Compare comp = Compare()) {
+    TRACE_STEP(std::endl << "查找范围 [" << low << ", " << high << "] 中第 " << i << " 小的元素" << std::endl);
+    
+    // 显示当前子数组状态
+    TRACE_STEP("  当前子数组: " << trace::range(arr, low, high) << std::endl);
+    
+    // 基本情况：数组只有一个元素
+    if (low == high) {
+        TRACE_STEP("  基本情况：返回唯一元素 arr[" << low << "] = " << arr[low] << std::endl);
+        return arr[low];
+    }
+    
+    // 随机化分区
+    int pivotIndex = randomizedPartition(arr, low, high, comp);
+    int k = pivotIndex - low + 1;  // low到pivotIndex的元素个数
+    
+    TRACE_STEP("  分区后基准元素为 arr[" << pivotIndex << "] = " << arr[pivotIndex] << std::endl);
+    TRACE_STEP("  基准元素是当前范围中第 " << k << " 小的元素" << std::endl);
+    
+    // 如果基准元素正好是第i小的元素
+    if (i == k) {
+        TRACE_STEP("  找到了第 " << i << " 小的元素: " << arr[pivotIndex] << std::endl);
+        return arr[pivotIndex];
+    }
+    // 如果第i小的元素在基准元素的左边
+    else if (i < k) {
+        TRACE_STEP("  第 " << i << " 小的元素在左半部分" << std::endl);
+        return randomizedSelect(arr, low, pivotIndex - 1, i, comp);
+    }
+    // 如果第i小的元素在基准元素的右边
+    else {
+        TRACE_STEP("  第 " << i << " 小的元素在右半部分" << std::endl);
+        return randomizedSelect(arr, pivotIndex + 1, high, i - k, comp);
+    }
+}
+
+/**
+ * 随机选择算法包装函数
+ * @param arr 待处理数组
+ * @param i 查找第i小的元素（1-based）
+ * @param comp 比较器
+ * @return 第i小的元素
+ * @throws std::out_of_range 如果i不在1到arr.size()之间
+ */
+template<typename T, typename Compare = std::less<T>>
+const T& randomizedSelect(std::vector<T>& arr, int i, Compare comp = Compare()) {
+    if (i < 1 || i > (int)arr.size()) {
+        throw std::out_of_range("Order statistic out of range");
+    }
+    TRACE_SUMMARY("开始随机选择算法，查找第 " << i << " 小的元素..." << std::endl);
+    TRACE_STEP("原数组: " << trace::range(arr) << std::endl);
+    return randomizedSelect(arr, 0, (int)arr.size() - 1, i, comp);
+}
+
+/**
+ * 使用三路划分的随机选择算法
+ * 每轮随机选基准并划分出小于、等于、大于基准的三段，第i小的元素落在等于段时直接返回。
+ * 重复键不会被反复划分，全部元素相等时一轮即可结束；以循环代替递归，栈空间为 O(1)
+ * @param arr 待处理数组
+ * @param i 查找第i小的元素（1-based）
+ * @param comp 比较器
+ * @return 第i小的元素
+ * @throws std::out_of_range 如果i不在1到arr.size()之间
+ */
+template<typename T, typename Compare = std::less<T>>
+const T& threeWayRandomizedSelect(std::vector<T>& arr, int i, Compare comp = Compare()) {
+    if (i < 1 || i > (int)arr.size()) {
+        throw std::out_of_range("Order statistic out of range");
+    }
+    TRACE_SUMMARY("开始三路划分随机选择算法，查找第 " << i << " 小的元素..." << std::endl);
+
+    static thread_local std::mt19937 rng(std::chrono::steady_clock::now().time_since_epoch().count());
+    int low = 0;
+    int high = (int)arr.size() - 1;
+    while (low < high) {
+        TRACE_STEP(std::endl << "查找范围 [" << low << ", " << high << "] 中第 " << i << " 小的元素" << std::endl);
+        int randomIndex = low + rng() % (high - low + 1);
+        std::swap(arr[randomIndex], arr[high]);
+        std::pair<int, int> equal = threeWayPartition(arr, low, high, comp);
+        TRACE_COUNT("randomizedSelect.partitions");
+
+        int less = equal.first - low;                 // 小于基准的元素个数
+        int notGreater = equal.second - low + 1;      // 不大于基准的元素个数
+        if (i <= less) {
+            high = equal.first - 1;
+        } else if (i <= notGreater) {
+            TRACE_STEP("  第 " << i << " 小的元素等于基准: " << arr[equal.first] << std::endl);
+            return arr[equal.first];
+        } else {
+            i -= notGreater;
+            low = equal.second + 1;
+        }
+    }
+    return arr[low];
+}
+
+#endif //CLRS_C2_U9_RANDOMIZED_SELECT_H
@@ -5,6 +5,8 @@
 #include <iostream>
 #include <stdexcept>
 
+#include "common/Trace.h"
+
 /**
  * 队列的数组实现
  * 队列是一种先进先出（FIFO）的数据结构
@@ -89,7 +91,7 @@ public:
         rearIndex = (rearIndex + 1) % capacity;
         array[rearIndex] = value;
         count++;
-        std::cout << "元素 " << value << " 已入队" << std::endl;
+        TRACE_STEP("元素 " << value << " 已入队" << std::endl);
     }
 
     /**
@@ -103,7 +105,7 @@ public:
         int value = array[frontIndex];
         frontIndex = (frontIndex + 1) % capacity;
         count--;
-        std::cout << "元素 " << value << " 已出队" << std::endl;
+        TRACE_STEP("元素 " << value << " 已出队" << std::endl);
         return value;
     }
 
@@ -6,6 +6,8 @@
 #include <stdexcept>
 #include <vector>
 
+#include "common/Trace.h"
+
 /**
  * 栈的数组实现
  * 栈是一种后进先出（LIFO）的数据结构
@@ -76,7 +78,7 @@ public:
             throw std::overflow_error("栈已满，无法执行入栈操作");
         }
         array[++topIndex] = value;
-        std::cout << "元素 " << value << " 已入栈" << std::endl;
+        TRACE_STEP("元素 " << value << " 已入栈" << std::endl);
     }
 
     /**
@@ -88,7 +90,7 @@ public:
             throw std::underflow_error("栈为空，无法执行出栈操作");
         }
         int value = array[topIndex--];
-        std::cout << "元素 " << value << " 已出栈" << std::endl;
+        TRACE_STEP("元素 " << value << " 已出栈" << std::endl);
         return value;
     }
 
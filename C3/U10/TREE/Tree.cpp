@@ -2,6 +2,8 @@
 #include <vector>
 #include <queue>
 
+#include "common/Trace.h"
+
 /**
  * 有根树的表示
  * 根据《算法导论》第10章内容实现
@@ -63,7 +65,7 @@ public:
      */
     void destroyTree(BinaryTreeNode* node) {
         if (node) {
-            std::cout << "销毁节点: " << node->key << std::endl;
+            TRACE_STEP("销毁节点: " << node->key << std::endl);
             destroyTree(node->left);
             destroyTree(node->right);
             delete node;
@@ -76,7 +78,7 @@ public:
      * @return 指向新创建节点的指针
      */
     BinaryTreeNode* createNode(int key) {
-        std::cout << "创建节点: " << key << std::endl;
+        TRACE_STEP("创建节点: " << key << std::endl);
         return new BinaryTreeNode(key);
     }
     
@@ -85,7 +87,7 @@ public:
      * @param node 新的根节点
      */
     void setRoot(BinaryTreeNode* node) {
-        std::cout << "设置根节点为: " << (node ? std::to_string(node->key) : "nullptr") << std::endl;
+        TRACE_STEP("设置根节点为: " << (node ? std::to_string(node->key) : "nullptr") << std::endl);
         root = node;
         if (root) {
             root->parent = nullptr;
@@ -106,10 +108,10 @@ public:
      */
     void inorderTraversal(BinaryTreeNode* node) const {
         if (node) {
-            std::cout << "进入节点 " << node->key << " 的左子树" << std::endl;
+            TRACE_STEP("进入节点 " << node->key << " 的左子树" << std::endl);
             inorderTraversal(node->left);
             std::cout << "访问节点: " << node->key << std::endl;
-            std::cout << "进入节点 " << node->key << " 的右子树" << std::endl;
+            TRACE_STEP("进入节点 " << node->key << " 的右子树" << std::endl);
             inorderTraversal(node->right);
         }
     }
@@ -121,9 +123,9 @@ public:
     void preorderTraversal(BinaryTreeNode* node) const {
         if (node) {
             std::cout << "访问节点: " << node->key << std::endl;
-            std::cout << "进入节点 " << node->key << " 的左子树" << std::endl;
+            TRACE_STEP("进入节点 " << node->key << " 的左子树" << std::endl);
             preorderTraversal(node->left);
-            std::cout << "进入节点 " << node->key << " 的右子树" << std::endl;
+            TRACE_STEP("进入节点 " << node->key << " 的右子树" << std::endl);
             preorderTraversal(node->right);
         }
     }
@@ -134,9 +136,9 @@ public:
      */
     void postorderTraversal(BinaryTreeNode* node) const {
         if (node) {
-            std::cout << "进入节点 " << node->key << " 的左子树" << std::endl;
+            TRACE_STEP("进入节点 " << node->key << " 的左子树" << std::endl);
             postorderTraversal(node->left);
-            std::cout << "进入节点 " << node->key << " 的右子树" << std::endl;
+            TRACE_STEP("进入节点 " << node->key << " 的右子树" << std::endl);
             postorderTraversal(node->right);
             std::cout << "访问节点: " << node->key << std::endl;
         }
@@ -153,7 +155,7 @@ public:
         
         std::queue<BinaryTreeNode*> q;
         q.push(root);
-        std::cout << "将根节点 " << root->key << " 加入队列" << std::endl;
+        TRACE_STEP("将根节点 " << root->key << " 加入队列" << std::endl);
         
         while (!q.empty()) {
             BinaryTreeNode* current = q.front();
@@ -162,11 +164,11 @@ public:
             
             // 将左右子节点加入队列
             if (current->left) {
-                std::cout << "将节点 " << current->key << " 的左子节点 " << current->left->key << " 加入队列" << std::endl;
+                TRACE_STEP("将节点 " << current->key << " 的左子节点 " << current->left->key << " 加入队列" << std::endl);
                 q.push(current->left);
             }
             if (current->right) {
-                std::cout << "将节点 " << current->key << " 的右子节点 " << current->right->key << " 加入队列" << std::endl;
+                TRACE_STEP("将节点 " << current->key << " 的右子节点 " << current->right->key << " 加入队列" << std::endl);
                 q.push(current->right);
             }
         }
@@ -240,7 +242,7 @@ public:
      */
     void destroyTree(TreeNode* node) {
         if (node) {
-            std::cout << "销毁节点: " << node->key << std::endl;
+            TRACE_STEP("销毁节点: " << node->key << std::endl);
             // 先销毁所有兄弟节点
             destroyTree(node->rightSibling);
             // 再销毁所有子节点
@@ -256,7 +258,7 @@ public:
      * @return 指向新创建节点的指针
      */
     TreeNode* createNode(int key) {
-        std::cout << "创建节点: " << key << std::endl;
+        TRACE_STEP("创建节点: " << key << std::endl);
         return new TreeNode(key);
     }
     
@@ -265,7 +267,7 @@ public:
      * @param node 新的根节点
      */
     void setRoot(TreeNode* node) {
-        std::cout << "设置根节点为: " << (node ? std::to_string(node->key) : "nullptr") << std::endl;
+        TRACE_STEP("设置根节点为: " << (node ? std::to_string(node->key) : "nullptr") << std::endl);
         root = node;
         if (root) {
             root->parent = nullptr;
@@ -290,13 +292,13 @@ public:
             
             // 遍历第一个子节点
             if (node->leftChild) {
-                std::cout << "进入节点 " << node->key << " 的第一个子节点 " << node->leftChild->key << std::endl;
+                TRACE_STEP("进入节点 " << node->key << " 的第一个子节点 " << node->leftChild->key << std::endl);
                 preorderTraversal(node->leftChild);
             }
             
             // 遍历兄弟节点
             if (node->rightSibling) {
-                std::cout << "进入节点 " << node->key << " 的右侧兄弟节点 " << node->rightSibling->key << std::endl;
+                TRACE_STEP("进入节点 " << node->key << " 的右侧兄弟节点 " << node->rightSibling->key << std::endl);
                 preorderTraversal(node->rightSibling);
             }
         }
@@ -310,13 +312,13 @@ public:
         if (node) {
             // 遍历第一个子节点
             if (node->leftChild) {
-                std::cout << "进入节点 " << node->key << " 的第一个子节点 " << node->leftChild->key << std::endl;
+                TRACE_STEP("进入节点 " << node->key << " 的第一个子节点 " << node->leftChild->key << std::endl);
                 postorderTraversal(node->leftChild);
             }
             
             // 遍历兄弟节点
             if (node->rightSibling) {
-                std::cout << "进入节点 " << node->key << " 的右侧兄弟节点 " << node->rightSibling->key << std::endl;
+                TRACE_STEP("进入节点 " << node->key << " 的右侧兄弟节点 " << node->rightSibling->key << std::endl);
                 postorderTraversal(node->rightSibling);
             }
             
@@ -335,7 +337,7 @@ public:
         
         std::queue<TreeNode*> q;
         q.push(root);
-        std::cout << "将根节点 " << root->key << " 加入队列" << std::endl;
+        TRACE_STEP("将根节点 " << root->key << " 加入队列" << std::endl);
         
         while (!q.empty()) {
             TreeNode* current = q.front();
@@ -351,7 +353,7 @@ public:
             
             // 将第一个子节点加入队列
             if (current->leftChild) {
-                std::cout << "将节点 " << current->key << " 的第一个子节点 " << current->leftChild->key << " 加入队列" << std::endl;
+                TRACE_STEP("将节点 " << current->key << " 的第一个子节点 " << current->leftChild->key << " 加入队列" << std::endl);
                 q.push(current->leftChild);
             }
         }
@@ -366,15 +368,15 @@ public:
     int getHeight(TreeNode* node) const {
         if (!node) return -1;
         
-        std::cout << "计算节点 " << node->key << " 的高度" << std::endl;
+        TRACE_STEP("计算节点 " << node->key << " 的高度" << std::endl);
         int maxHeight = -1;
         
         // 遍历所有子节点，找出最大高度
         TreeNode* child = node->leftChild;
         while (child) {
-            std::cout << "检查子节点 " << child->key << std::endl;
+            TRACE_STEP("检查子节点 " << child->key << std::endl);
             int height = getHeight(child);
-            std::cout << "子节点 " << child->key << " 的高度为 " << height << std::endl;
+            TRACE_STEP("子节点 " << child->key << " 的高度为 " << height << std::endl);
             if (height > maxHeight) {
                 maxHeight = height;
             }
@@ -382,7 +384,7 @@ public:
         }
         
         int result = maxHeight + 1;
-        std::cout << "节点 " << node->key << " 的高度为 " << result << std::endl;
+        TRACE_STEP("节点 " << node->key << " 的高度为 " << result << std::endl);
         return result;
     }
     
@@ -394,29 +396,29 @@ public:
     int getNodeCount(TreeNode* node) const {
         if (!node) return 0;
         
-        std::cout << "计算节点 " << node->key << " 为根的子树节点数" << std::endl;
+        TRACE_STEP("计算节点 " << node->key << " 为根的子树节点数" << std::endl);
         int count = 1; // 当前节点
-        std::cout << "当前节点 " << node->key << " 计入统计" << std::endl;
+        TRACE_STEP("当前节点 " << node->key << " 计入统计" << std::endl);
         
         // 计算所有子节点的数量
         TreeNode* child = node->leftChild;
         while (child) {
-            std::cout << "统计子节点 " << child->key << " 为根的子树节点数" << std::endl;
+            TRACE_STEP("统计子节点 " << child->key << " 为根的子树节点数" << std::endl);
             int childCount = getNodeCount(child);
-            std::cout << "子节点 " << child->key << " 为根的子树有 " << childCount << " 个节点" << std::endl;
+            TRACE_STEP("子节点 " << child->key << " 为根的子树有 " << childCount << " 个节点" << std::endl);
             count += childCount;
             child = child->rightSibling;
         }
         
         // 计算所有兄弟节点的数量
         if (node->rightSibling) {
-            std::cout << "统计兄弟节点 " << node->rightSibling->key << " 为根的子树节点数" << std::endl;
+            TRACE_STEP("统计兄弟节点 " << node->rightSibling->key << " 为根的子树节点数" << std::endl);
             int siblingCount = getNodeCount(node->rightSibling);
-            std::cout << "兄弟节点 " << node->rightSibling->key << " 为根的子树有 " << siblingCount << " 个节点" << std::endl;
+            TRACE_STEP("兄弟节点 " << node->rightSibling->key << " 为根的子树有 " << siblingCount << " 个节点" << std::endl);
             count += siblingCount;
         }
         
-        std::cout << "以节点 " << node->key << " 为根的子树共有 " << count << " 个节点" << std::endl;
+        TRACE_STEP("以节点 " << node->key << " 为根的子树共有 " << count << " 个节点" << std::endl);
         return count;
     }
     
@@ -428,25 +430,25 @@ public:
      */
     TreeNode* searchNode(TreeNode* node, int key) const {
         if (!node) {
-            std::cout << "到达空节点，未找到键值 " << key << std::endl;
+            TRACE_STEP("到达空节点，未找到键值 " << key << std::endl);
             return nullptr;
         }
         
-        std::cout << "在节点 " << node->key << " 中查找键值 " << key << std::endl;
+        TRACE_STEP("在节点 " << node->key << " 中查找键值 " << key << std::endl);
         if (node->key == key) {
-            std::cout << "在节点 " << node->key << " 中找到键值 " << key << std::endl;
+            TRACE_STEP("在节点 " << node->key << " 中找到键值 " << key << std::endl);
             return node;
         }
         
         // 在子节点中查找
-        std::cout << "在节点 " << node->key << " 的子节点中查找键值 " << key << std::endl;
+        TRACE_STEP("在节点 " << node->key << " 的子节点中查找键值 " << key << std::endl);
         TreeNode* result = searchNode(node->leftChild, key);
         if (result) {
             return result;
         }
         
         // 在兄弟节点中查找
-        std::cout << "在节点 " << node->key << " 的兄弟节点中查找键值 " << key << std::endl;
+        TRACE_STEP("在节点 " << node->key << " 的兄弟节点中查找键值 " << key << std::endl);
         return searchNode(node->rightSibling, key);
     }
     
@@ -0,0 +1,428 @@
+//
+// Created by HaPpY on 2026/10/17.
+//
+
+#ifndef CLRS_C3_U11_CONCURRENT_HASH_TABLE_H
+#define CLRS_C3_U11_CONCURRENT_HASH_TABLE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "common/Trace.h"
+
+// 默认分片数
+inline constexpr size_t kConcurrentHashDefaultShards = 64;
+
+/**
+ * 分片的并发散列表：写操作按分片加锁，读操作不加锁
+ *
+ * 散列值决定关键字所在的分片，每个分片是一张独立的线性探测散列表：
+ * - 写（put / remove）获取分片的互斥锁，不同分片上的写互不阻塞；
+ * - 每个分片带一个顺序锁（seqlock）计数器，写入期间为奇数。读操作先读计数器，
+ *   再不加锁地探测，最后确认计数器没有变化，否则重试。读者从不写共享内存，
+ *   大量读者同时访问同一分片也不会争抢缓存行；
+ * - 槽中的关键字和值保存在 std::atomic 中，读者与写者并发访问不构成数据竞争，
+ *   因此要求 K、V 可平凡复制（整数、指针、POD 结构体等）；
+ * - 分片装满 3/4 时换成两倍大的新表，旧表不立即释放（可能仍有读者在访问），
+ *   留到 reclaim() 或析构时释放，翻倍增长使旧表的总大小不超过当前表；
+ * - putBatch / getBatch 先按分片分组，每个分片只加一次锁或只做一次顺序锁校验。
+ *
+ * 用法：
+ *   ConcurrentHashTable<uint64_t, uint64_t> table;
+ *   // 任意多个线程
+ *   table.put(key, value);
+ *   std::optional<uint64_t> v = table.find(key);
+ */
+template<typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+class ConcurrentHashTable {
+    static_assert(std::is_trivially_copyable<K>::value && std::is_trivially_copyable<V>::value,
+                  "ConcurrentHashTable requires trivially copyable keys and values");
+
+private:
+    struct Slot {
+        std::atomic<uint8_t> full;
+        std::atomic<K> key;
+        std::atomic<V> value;
+    };
+
+    struct Table {
+        size_t capacity;  // 槽数，2 的幂
+        std::unique_ptr<Slot[]> slots;
+
+        // 值初始化：全部槽清零，读者不会读到未初始化的原子变量
+        explicit Table(size_t c) : capacity(c), slots(new Slot[c]()) {}
+    };
+
+    // 分片按缓存行对齐，相邻分片的锁与计数器不会伪共享
+    struct alignas(64) Shard {
+        std::atomic<uint64_t> seq{0};       // 顺序锁计数器，奇数表示正在写入
+        std::atomic<Table*> table{nullptr}; // 当前的表
+        std::atomic<size_t> size{0};        // 元素数量
+        std::mutex mutex;                   // 写者互斥锁
+        std::vector<std::unique_ptr<Table>> tables;  // 当前表与被替换的旧表，只在持有锁时访问
+    };
+
+    std::unique_ptr<Shard[]> shards_;
+    size_t shardMask_;
+    Hash hashFunction;
+    KeyEqual keyEqual;
+
+    // murmur3 的 64 位终结函数：分片取低位，起始槽取高位，两者都均匀
+    uint64_t mix(const K& key) const {
+        uint64_t h = static_cast<uint64_t>(hashFunction(key));
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ull;
+        h ^= h >> 33;
+        return h;
+    }
+
+    Shard& shardOf(uint64_t h) const {
+        return shards_[h & shardMask_];
+    }
+
+    static size_t home(const Table& t, uint64_t h) {
+        return static_cast<size_t>(h >> 32) & (t.capacity - 1);
+    }
+
+    /**
+     * 探测关键字所在的槽，读者与写者共用。最多探测 capacity 个槽，
+     * 读者看到写到一半的表时也不会陷入死循环（随后顺序锁校验失败，重试）
+     * @return 槽下标，不存在时返回 capacity
+     */
+    size_t findSlot(const Table& t, const K& key, uint64_t h) const {
+        size_t mask = t.capacity - 1;
+        size_t i = home(t, h);
+        for (size_t probes = 0; probes < t.capacity; probes++, i = (i + 1) & mask) {
+            const Slot& slot = t.slots[i];
+            if (slot.full.load(std::memory_order_relaxed) == 0) {
+                break;
+            }
+            if (keyEqual(slot.key.load(std::memory_order_relaxed), key)) {
+                return i;
+            }
+        }
+        return t.capacity;
+    }
+
+    /**
+     * 在顺序锁保护下不加锁地读：读到的计数器为奇数或前后不一致时重试
+     * @param read 读操作，参数为当前的表
+     */
+    template<typename Read>
+    auto optimisticRead(const Shard& shard, Read read) const {
+        while (true) {
+            uint64_t before = shard.seq.load(std::memory_order_acquire);
+            if (before & 1) {
+                std::this_thread::yield();
+                continue;
+            }
+            auto result = read(*shard.table.load(std::memory_order_acquire));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (shard.seq.load(std::memory_order_relaxed) == before) {
+                return result;
+            }
+            TRACE_COUNT("concurrentHashTable.readRetries");
+        }
+    }
+
+    // 写入开始：计数器变为奇数，之后的写入不会被排到这一步之前
+    static void beginWrite(Shard& shard) {
+        shard.seq.store(shard.seq.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    // 写入结束：计数器变回偶数，之前的写入对看到新计数器的读者可见
+    static void endWrite(Shard& shard) {
+        shard.seq.store(shard.seq.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    // 放入关键字不存在的元素，调用者持有分片的锁
+    static void insertSlot(Table& t, const K& key, const V& value, size_t start) {
+        size_t mask = t.capacity - 1;
+        size_t i = start;
+        while (t.slots[i].full.load(std::memory_order_relaxed) != 0) {
+            i = (i + 1) & mask;
+        }
+        t.slots[i].key.store(key, std::memory_order_relaxed);
+        t.slots[i].value.store(value, std::memory_order_relaxed);
+        t.slots[i].full.store(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * 把分片换成两倍大的新表：新表填好后才发布，此前的读者继续读旧表，结果仍然正确
+     * 调用者持有分片的锁
+     */
+    void grow(Shard& shard) {
+        Table& old = *shard.table.load(std::memory_order_relaxed);
+        shard.tables.push_back(std::make_unique<Table>(old.capacity * 2));
+        Table& bigger = *shard.tables.back();
+        for (size_t i = 0; i < old.capacity; i++) {
+            if (old.slots[i].full.load(std::memory_order_relaxed) != 0) {
+                K key = old.slots[i].key.load(std::memory_order_relaxed);
+                insertSlot(bigger, key, old.slots[i].value.load(std::memory_order_relaxed), home(bigger, mix(key)));
+            }
+        }
+        shard.table.store(&bigger, std::memory_order_release);
+        TRACE_COUNT("concurrentHashTable.grows");
+    }
+
+    // 插入或更新，调用者持有分片的锁
+    void putLocked(Shard& shard, const K& key, const V& value, uint64_t h) {
+        Table* t = shard.table.load(std::memory_order_relaxed);
+        size_t i = findSlot(*t, key, h);
+        if (i != t->capacity) {
+            beginWrite(shard);
+            t->slots[i].value.store(value, std::memory_order_relaxed);
+            endWrite(shard);
+            return;
+        }
+        size_t size = shard.size.load(std::memory_order_relaxed);
+        if (4 * (size + 1) > 3 * t->capacity) {
+            grow(shard);
+            t = shard.table.load(std::memory_order_relaxed);
+        }
+        beginWrite(shard);
+        insertSlot(*t, key, value, home(*t, h));
+        endWrite(shard);
+        shard.size.store(size + 1, std::memory_order_relaxed);
+    }
+
+    /**
+     * 把下标按所在分片分组（计数排序）
+     * @param hashes 各元素的散列值
+     * @param begin 输出：第 s 个分片的下标为 order[begin[s], begin[s + 1])
+     * @return 分组后的下标
+     */
+    std::vector<size_t> groupByShard(const std::vector<uint64_t>& hashes, std::vector<size_t>& begin) const {
+        begin.assign(shardMask_ + 2, 0);
+        for (uint64_t h : hashes) {
+            begin[(h & shardMask_) + 1]++;
+        }
+        for (size_t s = 1; s < begin.size(); s++) {
+            begin[s] += begin[s - 1];
+        }
+        std::vector<size_t> order(hashes.size());
+        std::vector<size_t> next(begin.begin(), begin.end() - 1);
+        for (size_t i = 0; i < hashes.size(); i++) {
+            order[next[hashes[i] & shardMask_]++] = i;
+        }
+        return order;
+    }
+
+public:
+    /**
+     * 构造函数
+     * @param capacity 初始总槽数，平均分给各个分片
+     * @param shards 分片数，向上取到 2 的幂
+     * @param hasher 散列函数对象
+     * @param equal 关键字相等比较对象
+     */
+    explicit ConcurrentHashTable(size_t capacity = 1024, size_t shards = kConcurrentHashDefaultShards,
+                                 const Hash& hasher = Hash(), const KeyEqual& equal = KeyEqual())
+        : hashFunction(hasher), keyEqual(equal) {
+        size_t count = 1;
+        while (count < shards) {
+            count *= 2;
+        }
+        size_t perShard = 16;
+        while (perShard * count < capacity) {
+            perShard *= 2;
+        }
+        shards_.reset(new Shard[count]);
+        shardMask_ = count - 1;
+        for (size_t s = 0; s < count; s++) {
+            shards_[s].tables.push_back(std::make_unique<Table>(perShard));
+            shards_[s].table.store(shards_[s].tables.back().get(), std::memory_order_relaxed);
+        }
+        TRACE_SUMMARY("创建并发散列表，分片数: " << count << "，每个分片的槽数: " << perShard << std::endl);
+    }
+
+    ConcurrentHashTable(const ConcurrentHashTable&) = delete;
+    ConcurrentHashTable& operator=(const ConcurrentHashTable&) = delete;
+
+    /**
+     * 获取当前元素数量，有并发写入时是一个近似值
+     * @return 元素数量
+     */
+    size_t size() const {
+        size_t total = 0;
+        for (size_t s = 0; s <= shardMask_; s++) {
+            total += shards_[s].size.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    /**
+     * 获取分片数
+     * @return 分片数
+     */
+    size_t shardCount() const {
+        return shardMask_ + 1;
+    }
+
+    /**
+     * 插入或更新键值对
+     * @param key 键
+     * @param value 值
+     */
+    void put(const K& key, const V& value) {
+        uint64_t h = mix(key);
+        Shard& shard = shardOf(h);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        putLocked(shard, key, value, h);
+    }
+
+    /**
+     * 不加锁地查找
+     * @param key 键
+     * @return 对应的值，不存在时为空
+     */
+    std::optional<V> find(const K& key) const {
+        uint64_t h = mix(key);
+        return optimisticRead(shardOf(h), [&](const Table& t) -> std::optional<V> {
+            size_t i = findSlot(t, key, h);
+            if (i == t.capacity) {
+                return std::nullopt;
+            }
+            return t.slots[i].value.load(std::memory_order_relaxed);
+        });
+    }
+
+    /**
+     * 查找指定键对应的值
+     * @param key 键
+     * @return 对应的值
+     * @throws std::out_of_range 如果键不存在
+     */
+    V get(const K& key) const {
+        std::optional<V> value = find(key);
+        if (!value) {
+            throw std::out_of_range("Key not found");
+        }
+        return *value;
+    }
+
+    /**
+     * 检查是否存在指定的键
+     * @param key 要检查的键
+     * @return 如果存在返回true，否则返回false
+     */
+    bool contains(const K& key) const {
+        return find(key).has_value();
+    }
+
+    /**
+     * 删除指定键值对：与 OpenHashTable 相同，把同一探测段中后面的元素依次前移，不留删除标记
+     * @param key 要删除的键
+     * @return 如果删除成功返回true，否则返回false
+     */
+    bool remove(const K& key) {
+        uint64_t h = mix(key);
+        Shard& shard = shardOf(h);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        Table& t = *shard.table.load(std::memory_order_relaxed);
+        size_t i = findSlot(t, key, h);
+        if (i == t.capacity) {
+            return false;
+        }
+        size_t mask = t.capacity - 1;
+        beginWrite(shard);
+        for (size_t j = (i + 1) & mask; t.slots[j].full.load(std::memory_order_relaxed) != 0; j = (j + 1) & mask) {
+            K moved = t.slots[j].key.load(std::memory_order_relaxed);
+            size_t distance = (j - home(t, mix(moved))) & mask;
+            if (distance >= ((j - i) & mask)) {
+                t.slots[i].key.store(moved, std::memory_order_relaxed);
+                t.slots[i].value.store(t.slots[j].value.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                i = j;
+            }
+        }
+        t.slots[i].full.store(0, std::memory_order_relaxed);
+        endWrite(shard);
+        shard.size.store(shard.size.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /**
+     * 批量插入或更新：按分片分组，每个分片只加一次锁
+     * @param items 键值对
+     */
+    void putBatch(const std::vector<std::pair<K, V>>& items) {
+        std::vector<uint64_t> hashes(items.size());
+        for (size_t i = 0; i < items.size(); i++) {
+            hashes[i] = mix(items[i].first);
+        }
+        std::vector<size_t> begin;
+        std::vector<size_t> order = groupByShard(hashes, begin);
+        for (size_t s = 0; s <= shardMask_; s++) {
+            if (begin[s] == begin[s + 1]) {
+                continue;
+            }
+            Shard& shard = shards_[s];
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            for (size_t k = begin[s]; k < begin[s + 1]; k++) {
+                size_t i = order[k];
+                putLocked(shard, items[i].first, items[i].second, hashes[i]);
+            }
+        }
+    }
+
+    /**
+     * 批量查找：按分片分组，每个分片的一组关键字在同一次顺序锁校验中读取
+     * @param keys 键
+     * @return 与 keys 一一对应的值，不存在时为空
+     */
+    std::vector<std::optional<V>> getBatch(const std::vector<K>& keys) const {
+        std::vector<uint64_t> hashes(keys.size());
+        for (size_t i = 0; i < keys.size(); i++) {
+            hashes[i] = mix(keys[i]);
+        }
+        std::vector<size_t> begin;
+        std::vector<size_t> order = groupByShard(hashes, begin);
+        std::vector<std::optional<V>> result(keys.size());
+        for (size_t s = 0; s <= shardMask_; s++) {
+            if (begin[s] == begin[s + 1]) {
+                continue;
+            }
+            optimisticRead(shards_[s], [&](const Table& t) {
+                for (size_t k = begin[s]; k < begin[s + 1]; k++) {
+                    size_t i = order[k];
+                    size_t slot = findSlot(t, keys[i], hashes[i]);
+                    result[i] = slot == t.capacity ? std::nullopt
+                                                   : std::optional<V>(t.slots[slot].value.load(std::memory_order_relaxed));
+                }
+                return true;
+            });
+        }
+        return result;
+    }
+
+    /**
+     * 释放扩容时被替换的旧表
+     * 只能在没有并发读者时调用（例如写入阶段结束、读取阶段开始之前），否则读者可能访问已释放的内存
+     */
+    void reclaim() {
+        for (size_t s = 0; s <= shardMask_; s++) {
+            Shard& shard = shards_[s];
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            if (shard.tables.size() > 1) {
+                std::unique_ptr<Table> current = std::move(shard.tables.back());
+                shard.tables.clear();
+                shard.tables.push_back(std::move(current));
+            }
+        }
+    }
+};
+
+#endif //CLRS_C3_U11_CONCURRENT_HASH_TABLE_H
@@ -0,0 +1,184 @@
+//
+// Created by HaPpY on 2026/10/17.
+//
+
+#ifndef CLRS_C3_U11_HASH_POLICIES_H
+#define CLRS_C3_U11_HASH_POLICIES_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * 散列函数策略，作为 HashTable 等散列表的 Hash 模板参数
+ *
+ * HashTable 的桶数是 2 的幂，桶下标取散列值的低位（按位与代替取模）。
+ * std::hash<int> 是恒等映射，低位相同的关键字（步长为 2 的幂的编号、对齐的地址等）
+ * 会全部落进同一个桶。下面的策略输出的每一位都与关键字的每一位相关：
+ * - MultiplyShiftHash：乘法移位全域散列（《算法导论》11.3.3 的全域散列族），整数关键字；
+ * - TabulationHash：简单制表散列，按字节查随机表再异或，3 独立，整数关键字；
+ * - FastStringHash：wyhash 风格的字符串散列，每 16 字节做一次 64×64→128 位乘法。
+ * 随机参数由种子生成。默认种子固定，运行结果可以复现；关键字可能由外部构造时，
+ * 应传入随机种子（例如 std::random_device），使攻击者无法预先构造冲突。
+ *
+ * 用法：
+ *   HashTable<uint64_t, int, MultiplyShiftHash<uint64_t>> table;
+ *   HashTable<std::string, int, FastStringHash> names(16, FastStringHash(std::random_device()()));
+ */
+
+// 各策略的默认种子
+inline constexpr uint64_t kHashPolicyDefaultSeed = 0x2545F4914F6CDD1Dull;
+
+/**
+ * splitmix64：由种子依次生成互不相关的 64 位随机参数
+ * @param state 生成器状态，每次调用后前进一步
+ * @return 下一个随机数
+ */
+inline uint64_t splitMix64(uint64_t& state) {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+/**
+ * 乘法移位全域散列（Dietzfelbinger 的向量形式）
+ *
+ * 关键字拆成高、低两个 32 位整数 x1、x0，h(x) = (a0·x0 + a1·x1 + b) mod 2^64 的高 32 位，
+ * a0、a1、b 是随机的 64 位整数。这一散列族是强全域的：任意两个不同的关键字，
+ * 散列值（以及散列值的任意若干位）取每一对取值的概率都相同，
+ * 因此取低位作为桶下标时，冲突概率为 1/m。只需两次乘法，没有除法。
+ */
+template<typename K>
+class MultiplyShiftHash {
+    static_assert(std::is_integral<K>::value || std::is_enum<K>::value, "MultiplyShiftHash requires integer keys");
+    static_assert(sizeof(K) <= sizeof(uint64_t), "MultiplyShiftHash supports keys of at most 64 bits");
+
+    uint64_t a0_;
+    uint64_t a1_;
+    uint64_t b_;
+
+public:
+    /**
+     * 构造函数：从全域散列族中按种子选出一个散列函数
+     * @param seed 随机种子
+     */
+    explicit MultiplyShiftHash(uint64_t seed = kHashPolicyDefaultSeed) {
+        a0_ = splitMix64(seed);
+        a1_ = splitMix64(seed);
+        b_ = splitMix64(seed);
+    }
+
+    size_t operator()(const K& key) const {
+        uint64_t x = static_cast<uint64_t>(key);
+        return static_cast<size_t>((a0_ * (x & 0xFFFFFFFFull) + a1_ * (x >> 32) + b_) >> 32);
+    }
+};
+
+/**
+ * 简单制表散列
+ *
+ * 关键字的每个字节查一张 256 项的随机表，h(x) = T0[x0] ⊕ T1[x1] ⊕ ...。
+ * 这一散列族是 3 独立的，用于线性探测、布谷鸟散列时的表现也接近完全随机的函数；
+ * 查表次数等于关键字的字节数，没有乘法。表共 sizeof(K) × 2 KB，可以放进 L1 缓存。
+ */
+template<typename K>
+class TabulationHash {
+    static_assert(std::is_integral<K>::value || std::is_enum<K>::value, "TabulationHash requires integer keys");
+    static_assert(sizeof(K) <= sizeof(uint64_t), "TabulationHash supports keys of at most 64 bits");
+
+    std::array<std::array<uint64_t, 256>, sizeof(K)> tables_;
+
+public:
+    /**
+     * 构造函数：按种子填充随机表
+     * @param seed 随机种子
+     */
+    explicit TabulationHash(uint64_t seed = kHashPolicyDefaultSeed) {
+        for (auto& table : tables_) {
+            for (uint64_t& entry : table) {
+                entry = splitMix64(seed);
+            }
+        }
+    }
+
+    size_t operator()(const K& key) const {
+        uint64_t x = static_cast<uint64_t>(key);
+        uint64_t h = 0;
+        for (size_t i = 0; i < sizeof(K); i++, x >>= 8) {
+            h ^= tables_[i][x & 0xFF];
+        }
+        return static_cast<size_t>(h);
+    }
+};
+
+/**
+ * wyhash 风格的字符串散列
+ *
+ * 基本运算 mum(a, b) 把两个 64 位整数相乘，再把 128 位乘积的高、低两半异或，
+ * 一次乘法就能让输出的每一位依赖于输入的每一位。长串每 16 字节做一次 mum，
+ * 不超过 16 字节的短串用两次（可能重叠的）读取取出全部字节，没有逐字节循环。
+ * 接受 std::string_view，std::string 与字符串字面量都可以直接使用。
+ */
+class FastStringHash {
+    static constexpr uint64_t kP0 = 0xA0761D6478BD642Full;
+    static constexpr uint64_t kP1 = 0xE7037ED1A0B428DBull;
+
+    uint64_t seed_;
+
+    static uint64_t mum(uint64_t a, uint64_t b) {
+        __uint128_t r = static_cast<__uint128_t>(a) * b;
+        return static_cast<uint64_t>(r) ^ static_cast<uint64_t>(r >> 64);
+    }
+
+    static uint64_t read64(const unsigned char* p) {
+        uint64_t v;
+        std::memcpy(&v, p, sizeof(v));
+        return v;
+    }
+
+    static uint64_t read32(const unsigned char* p) {
+        uint32_t v;
+        std::memcpy(&v, p, sizeof(v));
+        return v;
+    }
+
+public:
+    /**
+     * 构造函数
+     * @param seed 随机种子
+     */
+    explicit FastStringHash(uint64_t seed = kHashPolicyDefaultSeed) : seed_(seed ^ mum(seed ^ kP0, kP1)) {}
+
+    size_t operator()(std::string_view s) const {
+        const unsigned char* p = reinterpret_cast<const unsigned char*>(s.data());
+        size_t n = s.size();
+        uint64_t h = seed_;
+        uint64_t a = 0;
+        uint64_t b = 0;
+        if (n <= 16) {
+            if (n >= 4) {
+                // 4 ~ 16 字节：首尾各读两个 32 位整数，中间的读取位置随长度变化，覆盖全部字节
+                size_t middle = (n >> 3) << 2;
+                a = (read32(p) << 32) | read32(p + middle);
+                b = (read32(p + n - 4) << 32) | read32(p + n - 4 - middle);
+            } else if (n > 0) {
+                a = (static_cast<uint64_t>(p[0]) << 16) | (static_cast<uint64_t>(p[n >> 1]) << 8) | p[n - 1];
+            }
+        } else {
+            size_t i = n;
+            for (; i > 16; i -= 16, p += 16) {
+                h = mum(read64(p) ^ kP1, read64(p + 8) ^ h);
+            }
+            // 最后 16 个字节，可能与上一块重叠
+            a = read64(p + i - 16);
+            b = read64(p + i - 8);
+        }
+        return static_cast<size_t>(mum(kP1 ^ n, mum(a ^ kP1, b ^ h)));
+    }
+};
+
+#endif //CLRS_C3_U11_HASH_POLICIES_H
@@ -1,193 +1,64 @@
+#include <cstdint>
+#include <cstdio>
 #include <iostream>
+#include <optional>
 #include <vector>
-#include <list>
-#include <functional>
 #include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "ConcurrentHashTable.h"
+#include "HashTable.h"
+#include "OpenHashTable.h"
+#include "PerfectHashTable.h"
 
 /**
- * 散列表实现
- * 根据《算法导论》第11章内容实现
+ * 打印散列表的状态
  */
+template<typename K, typename V>
+void printStatus(const HashTable<K, V>& table) {
+    std::cout << "\n=== 散列表状态 ===" << std::endl;
+    std::cout << "容量: " << table.capacity() << std::endl;
+    std::cout << "元素数量: " << table.size() << std::endl;
+    std::cout << "装载因子: " << table.loadFactor() << std::endl;
+    std::cout << "==================" << std::endl;
+}
 
-// 散列表类模板
+/**
+ * 打印散列表内容
+ */
 template<typename K, typename V>
-class HashTable {
-private:
-    // 桶数组，每个桶是一个链表
-    std::vector<std::list<std::pair<K, V>>> buckets;
-    size_t size_;  // 当前元素数量
-    size_t capacity_;  // 桶的数量
-    
-    // 哈希函数
-    std::hash<K> hashFunction;
-    
-    // 计算关键字的哈希值并映射到桶索引
-    size_t hash(const K& key) const {
-        return hashFunction(key) % capacity_;
-    }
-    
-public:
-    /**
-     * 构造函数
-     * @param capacity 散列表的容量（桶的数量）
-     */
-    explicit HashTable(size_t capacity = 16) 
-        : size_(0), capacity_(capacity) {
-        buckets.resize(capacity_);
-        std::cout << "创建散列表，容量: " << capacity_ << std::endl;
-    }
-    
-    /**
-     * 析构函数
-     */
-    ~HashTable() = default;
-    
-    /**
-     * 获取当前元素数量
-     * @return 元素数量
-     */
-    size_t size() const {
-        return size_;
-    }
-    
-    /**
-     * 检查散列表是否为空
-     * @return 如果为空返回true，否则返回false
-     */
-    bool empty() const {
-        return size_ == 0;
-    }
-    
-    /**
-     * 获取装载因子
-     * @return 装载因子 α = n/m，其中n是元素数量，m是桶数量
-     */
-    double loadFactor() const {
-        return static_cast<double>(size_) / capacity_;
-    }
-    
-    /**
-     * 插入或更新键值对
-     * @param key 键
-     * @param value 值
-     */
-    void put(const K& key, const V& value) {
-        size_t index = hash(key);
-        std::cout << "插入键值对: (" << key << ", " << value << ")，哈希值: " << index << std::endl;
-        
-        // 查找是否已存在该键
-        auto& bucket = buckets[index];
-        for (auto& pair : bucket) {
-            if (pair.first == key) {
-                std::cout << "键 " << key << " 已存在，更新值: " << pair.second << " -> " << value << std::endl;
-                pair.second = value;  // 更新值
-                return;
-            }
-        }
-        
-        // 插入新的键值对
-        bucket.emplace_back(key, value);
-        size_++;
-        std::cout << "成功插入键值对: (" << key << ", " << value << ")" << std::endl;
-    }
-    
-    /**
-     * 查找指定键对应的值
-     * @param key 键
-     * @return 对应的值
-     * @throws std::out_of_range 如果键不存在
-     */
-    V get(const K& key) const {
-        size_t index = hash(key);
-        std::cout << "查找键: " << key << "，哈希值: " << index << std::endl;
-        
-        const auto& bucket = buckets[index];
-        for (const auto& pair : bucket) {
-            if (pair.first == key) {
-                std::cout << "找到键 " << key << "，对应值为: " << pair.second << std::endl;
-                return pair.second;
-            }
-        }
-        
-        std::cout << "未找到键: " << key << std::endl;
-        throw std::out_of_range("Key not found");
-    }
-    
-    /**
-     * 删除指定键值对
-     * @param key 要删除的键
-     * @return 如果删除成功返回true，否则返回false
-     */
-    bool remove(const K& key) {
-        size_t index = hash(key);
-        std::cout << "删除键: " << key << "，哈希值: " << index << std::endl;
-        
-        auto& bucket = buckets[index];
-        for (auto it = bucket.begin(); it != bucket.end(); ++it) {
-            if (it->first == key) {
-                std::cout << "找到并删除键值对: (" << it->first << ", " << it->second << ")" << std::endl;
-                bucket.erase(it);
-                size_--;
-                return true;
-            }
-        }
-        
-        std::cout << "未找到要删除的键: " << key << std::endl;
-        return false;
-    }
-    
-    /**
-     * 检查是否存在指定的键
-     * @param key 要检查的键
-     * @return 如果存在返回true，否则返回false
-     */
-    bool contains(const K& key) const {
-        size_t index = hash(key);
-        std::cout << "检查键是否存在: " << key << "，哈希值: " << index << std::endl;
-        
-        const auto& bucket = buckets[index];
-        for (const auto& pair : bucket) {
-            if (pair.first == key) {
-                std::cout << "键 " << key << " 存在" << std::endl;
-                return true;
+void printTable(const HashTable<K, V>& table) {
+    std::cout << "\n=== 散列表内容 ===" << std::endl;
+    for (size_t i = 0; i < table.capacity(); ++i) {
+        std::cout << "桶[" << i << "]: ";
+        const auto& bucket = table.bucket(i);
+        if (bucket.empty()) {
+            std::cout << "(空)";
+        } else {
+            for (const auto& pair : bucket) {
+                std::cout << "(" << pair.first << "," << pair.second << ") ";
             }
         }
-        
-        std::cout << "键 " << key << " 不存在" << std::endl;
-        return false;
+        std::cout << std::endl;
     }
-    
-    /**
-     * 打印散列表的状态
-     */
-    void printStatus() const {
-        std::cout << "\n=== 散列表状态 ===" << std::endl;
-        std::cout << "容量: " << capacity_ << std::endl;
-        std::cout << "元素数量: " << size_ << std::endl;
-        std::cout << "装载因子: " << loadFactor() << std::endl;
-        std::cout << "==================" << std::endl;
-    }
-    
-    /**
-     * 打印散列表内容
-     */
-    void printTable() const {
-        std::cout << "\n=== 散列表内容 ===" << std::endl;
-        for (size_t i = 0; i < buckets.size(); ++i) {
-            std::cout << "桶[" << i << "]: ";
-            const auto& bucket = buckets[i];
-            if (bucket.empty()) {
-                std::cout << "(空)";
-            } else {
-                for (const auto& pair : bucket) {
-                    std::cout << "(" << pair.first << "," << pair.second << ") ";
-                }
-            }
-            std::cout << std::endl;
-        }
-        std::cout << "==================" << std::endl;
+    std::cout << "==================" << std::endl;
+}
+
+/**
+ * 插入 keys 后打印各桶的冲突统计
+ */
+template<typename Table, typename Key>
+void printBucketStats(const char* name, Table table, const std::vector<Key>& keys) {
+    for (size_t i = 0; i < keys.size(); i++) {
+        table.put(keys[i], static_cast<int>(i));
     }
-};
+    HashTableBucketStats stats = table.bucketStats();
+    std::cout << name << ": 空桶 " << stats.emptyBuckets << "/" << stats.buckets
+              << "，冲突 " << stats.collisions << "，最长链表 " << stats.maxChain
+              << "，成功查找平均比较 " << stats.successfulProbes << " 次" << std::endl;
+}
 
 int main() {
 #ifdef ACM_LOCAL
@@ -198,28 +69,28 @@ int main() {
     std::cout << "=== 散列表演示 ===" << std::endl;
     
     // 创建一个整数到字符串的散列表
-    HashTable<int, std::string> hashTable(7);  // 使用7个桶
+    HashTable<int, std::string> hashTable(8);  // 使用8个桶
     
-    hashTable.printStatus();
+    printStatus(hashTable);
     
     // 插入一些键值对
     std::cout << "\n--- 插入操作 ---" << std::endl;
     hashTable.put(1, "one");
     hashTable.put(2, "two");
     hashTable.put(3, "three");
-    hashTable.put(8, "eight");   // 与1冲突 (8 % 7 = 1)
-    hashTable.put(15, "fifteen"); // 与1冲突 (15 % 7 = 1)
-    hashTable.put(9, "nine");    // 与2冲突 (9 % 7 = 2)
+    hashTable.put(9, "nine");    // 与1冲突 (9 & 7 = 1)
+    hashTable.put(17, "seventeen"); // 与1冲突 (17 & 7 = 1)
+    hashTable.put(10, "ten");    // 与2冲突 (10 & 7 = 2)
     
-    hashTable.printStatus();
-    hashTable.printTable();
+    printStatus(hashTable);
+    printTable(hashTable);
     
     // 查找操作
     std::cout << "\n--- 查找操作 ---" << std::endl;
     try {
         std::cout << "查找键1: " << hashTable.get(1) << std::endl;
-        std::cout << "查找键8: " << hashTable.get(8) << std::endl;
-        std::cout << "查找键15: " << hashTable.get(15) << std::endl;
+        std::cout << "查找键9: " << hashTable.get(9) << std::endl;
+        std::cout << "查找键17: " << hashTable.get(17) << std::endl;
         std::cout << "查找键5: " << hashTable.get(5) << std::endl;  // 不存在
     } catch (const std::out_of_range& e) {
         std::cout << "异常: " << e.what() << std::endl;
@@ -235,18 +106,128 @@ int main() {
     hashTable.put(1, "updated_one");  // 更新已存在的键
     std::cout << "更新键1后查找: " << hashTable.get(1) << std::endl;
     
-    hashTable.printTable();
+    printTable(hashTable);
     
     // 删除操作
     std::cout << "\n--- 删除操作 ---" << std::endl;
-    bool removed = hashTable.remove(8);
-    std::cout << "删除键8: " << (removed ? "成功" : "失败") << std::endl;
+    bool removed = hashTable.remove(9);
+    std::cout << "删除键9: " << (removed ? "成功" : "失败") << std::endl;
     
     removed = hashTable.remove(5);
     std::cout << "删除键5: " << (removed ? "成功" : "失败") << std::endl;  // 不存在
     
-    hashTable.printStatus();
-    hashTable.printTable();
+    printStatus(hashTable);
+    printTable(hashTable);
+    
+    // 自动调整桶数：负载因子超过 1 时加倍，低于 1/4 时减半，不低于构造时的桶数
+    std::cout << "\n=== 自动扩容与收缩演示 ===" << std::endl;
+    HashTable<int, int> growing(2);
+    growing.setIncrementalRehash(true);
+    size_t lastCapacity = growing.capacity();
+    for (int key = 0; key < 40; key++) {
+        growing.put(key, key * key);
+        if (growing.capacity() != lastCapacity) {
+            std::cout << "插入第" << key + 1 << "个键后扩容: " << lastCapacity << " -> " << growing.capacity()
+                      << "，增量迁移中: " << (growing.isRehashing() ? "是" : "否") << std::endl;
+            lastCapacity = growing.capacity();
+        }
+    }
+    std::cout << "迁移期间查找键3: " << growing.get(3) << std::endl;
+    for (int key = 0; key < 36; key++) {
+        growing.remove(key);
+        if (growing.capacity() != lastCapacity) {
+            std::cout << "剩余" << growing.size() << "个键时收缩: " << lastCapacity << " -> " << growing.capacity() << std::endl;
+            lastCapacity = growing.capacity();
+        }
+    }
+    growing.finishRehash();
+    printStatus(growing);
+    
+    // 散列函数策略：关键字是 4096 的倍数（低 12 位全为 0），桶下标取散列值的低 10 位
+    std::cout << "\n=== 散列函数策略比较 ===" << std::endl;
+    std::vector<uint64_t> strided;
+    std::vector<std::string> names;
+    for (uint64_t i = 0; i < 1000; i++) {
+        strided.push_back(i << 12);
+        names.push_back("user:" + std::to_string(i));
+    }
+    printBucketStats("std::hash", HashTable<uint64_t, int>(1024), strided);
+    printBucketStats("MultiplyShiftHash", HashTable<uint64_t, int, MultiplyShiftHash<uint64_t>>(1024), strided);
+    printBucketStats("TabulationHash", HashTable<uint64_t, int, TabulationHash<uint64_t>>(1024), strided);
+    printBucketStats("FastStringHash", HashTable<std::string, int, FastStringHash>(1024), names);
+    
+    // 开放寻址散列表：同样的操作，元素直接存放在槽数组中
+    std::cout << "\n=== 开放寻址散列表演示 ===" << std::endl;
+    OpenHashTable<int, std::string> openTable;
+    openTable.put(1, "one");
+    openTable.put(8, "eight");
+    openTable.put(15, "fifteen");
+    openTable.put(1, "updated_one");
+    std::cout << "查找键1: " << openTable.get(1) << std::endl;
+    std::cout << "删除键8: " << (openTable.remove(8) ? "成功" : "失败") << std::endl;
+    std::cout << "键8是否存在: " << (openTable.contains(8) ? "是" : "否") << std::endl;
+    std::cout << "查找键15: " << openTable.get(15) << std::endl;
+    
+    // 装载因子超过 0.875 时容量翻倍
+    for (int key = 100; key < 200; key++) {
+        openTable.put(key, std::to_string(key));
+    }
+    std::cout << "插入100个键后，元素数量: " << openTable.size() << "，容量: " << openTable.capacity()
+              << "，装载因子: " << openTable.loadFactor() << std::endl;
+    
+    // 并发散列表：4 个线程各自插入 1000 个不相交的键，其中后两个线程用批量接口
+    std::cout << "\n=== 并发散列表演示 ===" << std::endl;
+    ConcurrentHashTable<int, int> concurrentTable(64, 8);
+    std::vector<std::thread> writers;
+    for (int t = 0; t < 4; t++) {
+        writers.emplace_back([&concurrentTable, t] {
+            if (t < 2) {
+                for (int key = t * 1000; key < (t + 1) * 1000; key++) {
+                    concurrentTable.put(key, key * 2);
+                }
+            } else {
+                std::vector<std::pair<int, int>> batch;
+                for (int key = t * 1000; key < (t + 1) * 1000; key++) {
+                    batch.emplace_back(key, key * 2);
+                }
+                concurrentTable.putBatch(batch);
+            }
+        });
+    }
+    for (std::thread& writer : writers) {
+        writer.join();
+    }
+    concurrentTable.reclaim();
+    std::cout << "分片数: " << concurrentTable.shardCount() << "，元素数量: " << concurrentTable.size() << std::endl;
+    std::cout << "查找键2500: " << concurrentTable.get(2500) << std::endl;
+    std::cout << "删除键2500: " << (concurrentTable.remove(2500) ? "成功" : "失败") << std::endl;
+    std::vector<std::optional<int>> found = concurrentTable.getBatch({0, 2500, 3999, 4000});
+    std::cout << "批量查找键0、2500、3999、4000:";
+    for (const std::optional<int>& value : found) {
+        std::cout << " " << (value ? std::to_string(*value) : "不存在");
+    }
+    std::cout << std::endl;
+    
+    // 完美散列：静态的关键字集合，构造后写入文件，再映射回来查找
+    std::cout << "\n=== 完美散列演示 ===" << std::endl;
+    std::vector<std::pair<int, int>> items;
+    for (int key : {10, 23, 37, 41, 56, 62, 78, 85, 99, 104}) {
+        items.emplace_back(key, key * key);
+    }
+    PerfectHashTable<int, int> perfect(items);
+    std::cout << "关键字数: " << perfect.size() << "，第一级桶数: " << perfect.bucketCount()
+              << "，占用字节: " << perfect.bytes() << std::endl;
+    std::cout << "各关键字的编号:";
+    for (const auto& item : items) {
+        std::cout << " " << item.first << "->" << perfect.indexOf(item.first);
+    }
+    std::cout << std::endl;
+    const char* path = "perfect_hash.bin";
+    perfect.save(path);
+    PerfectHashTable<int, int> mapped = PerfectHashTable<int, int>::load(path);
+    std::cout << "映射文件后查找键56: " << mapped.get(56) << std::endl;
+    std::cout << "键57是否存在: " << (mapped.contains(57) ? "是" : "否") << std::endl;
+    std::remove(path);
     
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,443 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#ifndef CLRS_C3_U11_HASH_TABLE_H
+#define CLRS_C3_U11_HASH_TABLE_H
+
+#include <algorithm>
+#include <vector>
+#include <list>
+#include <functional>
+#include <stdexcept>
+
+#include "C4/U17/P4_DYNAMIC-TABLE/DynamicTable.h"
+#include "HashPolicies.h"
+#include "common/Trace.h"
+
+/**
+ * 散列表实现
+ * 根据《算法导论》第11章内容实现
+ *
+ * 桶数按动态表的策略（DynamicTablePolicy，《算法导论》17.4）自动调整：
+ * 插入后负载因子将超过上限时桶数加倍，删除后低于下限时减半（不低于构造时的桶数）。
+ * 调整有两种方式：
+ * - 一次性（默认）：立即把全部元素移到新的桶数组中；
+ * - 增量（setIncrementalRehash(true)）：新旧两个桶数组并存，之后每次插入、删除顺带迁移
+ *   kHashTableRehashStep 个旧桶，查找时两个数组都要检查。元素多达上亿时，
+ *   单次操作不会因为重新散列全部元素而停顿数秒。
+ * 迁移只移动链表节点（std::list::splice），不重新分配元素。
+ *
+ * 桶数总是 2 的幂，桶下标取散列值的低位（按位与，不做除法）。std::hash<int> 是恒等映射，
+ * 低位相同的关键字会落进同一个桶；关键字有这类规律时，Hash 应选用 HashPolicies.h 中的
+ * MultiplyShiftHash、TabulationHash 或 FastStringHash，并用 bucketStats() 比较各桶的冲突情况。
+ */
+
+// 增量迁移时每次插入、删除迁移的旧桶数
+inline constexpr size_t kHashTableRehashStep = 8;
+
+/**
+ * 各桶链表长度的统计，用于比较不同散列函数在实际关键字上的冲突情况
+ */
+struct HashTableBucketStats {
+    size_t buckets = 0;             // 桶数 m
+    size_t elements = 0;            // 元素数 n
+    size_t emptyBuckets = 0;        // 空桶数，完全随机的散列函数下约为 m·e^(-n/m)
+    size_t collisions = 0;          // 与同一桶中其他元素冲突的元素数，即 n - 非空桶数
+    size_t maxChain = 0;            // 最长链表的长度
+    double successfulProbes = 0.0;  // 成功查找平均比较的关键字数，完全随机时约为 1 + α/2
+    std::vector<size_t> histogram;  // histogram[k] 为长度为 k 的桶数
+};
+
+// 散列表类模板
+// Hash 计算关键字的散列值，KeyEqual 判断两个关键字是否相等
+template<typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+class HashTable {
+public:
+    // 链接法中的一个桶
+    using Bucket = std::list<std::pair<K, V>>;
+
+private:
+    // 桶数组，每个桶是一个链表
+    std::vector<Bucket> buckets;
+    size_t size_;  // 当前元素数量（包括尚未迁移的元素）
+    size_t capacity_;  // 桶的数量
+
+    // 增量迁移中的旧桶数组，[0, migrated_) 中的桶已经迁移完毕；不在迁移时 oldCapacity_ 为 0
+    std::vector<Bucket> oldBuckets;
+    size_t oldCapacity_;
+    size_t migrated_;
+
+    DynamicTablePolicy policy;  // 扩张与收缩策略
+    bool incremental_;          // 是否增量迁移
+    
+    // 哈希函数
+    Hash hashFunction;
+    KeyEqual keyEqual;
+    
+    // 计算关键字的哈希值并映射到桶索引：桶数是 2 的幂，取低位
+    size_t hash(const K& key) const {
+        return hashFunction(key) & (capacity_ - 1);
+    }
+
+    // 不小于 n 的最小的 2 的幂
+    static size_t roundUpToPowerOfTwo(size_t n) {
+        size_t p = 1;
+        while (p < n) {
+            p *= 2;
+        }
+        return p;
+    }
+
+    /**
+     * 关键字在旧桶数组中所在的桶，该桶尚未迁移时才需要检查
+     * @return 旧桶索引，不需要检查时返回 oldCapacity_
+     */
+    size_t pendingIndex(const K& key) const {
+        if (oldCapacity_ == 0) {
+            return oldCapacity_;
+        }
+        size_t index = hashFunction(key) & (oldCapacity_ - 1);
+        return index >= migrated_ ? index : oldCapacity_;
+    }
+
+    /**
+     * 把桶数调整为 capacity：一次性方式下立即迁移全部元素，增量方式下只建立新的桶数组
+     * 上一次增量迁移尚未完成时先把它做完
+     */
+    void resize(size_t capacity) {
+        finishRehash();
+        TRACE_SUMMARY("散列表桶数调整: " << capacity_ << " -> " << capacity
+                      << (incremental_ ? "（增量迁移）" : "") << std::endl);
+        TRACE_COUNT("hashTable.resizes");
+        oldBuckets.swap(buckets);
+        buckets = std::vector<Bucket>(capacity);
+        oldCapacity_ = capacity_;
+        capacity_ = capacity;
+        migrated_ = 0;
+        if (!incremental_) {
+            finishRehash();
+        }
+    }
+
+    /**
+     * 迁移至多 count 个旧桶，旧桶全部迁移完毕时释放旧桶数组
+     */
+    void migrate(size_t count) {
+        if (oldCapacity_ == 0) {
+            return;
+        }
+        for (; count > 0 && migrated_ < oldCapacity_; count--, migrated_++) {
+            Bucket& from = oldBuckets[migrated_];
+            while (!from.empty()) {
+                Bucket& to = buckets[hash(from.front().first)];
+                to.splice(to.end(), from, from.begin());
+            }
+        }
+        if (migrated_ == oldCapacity_) {
+            std::vector<Bucket>().swap(oldBuckets);
+            oldCapacity_ = 0;
+            migrated_ = 0;
+        }
+    }
+    
+public:
+    /**
+     * 构造函数
+     * @param capacity 散列表的容量（桶的数量），向上取到 2 的幂
+     * @param hasher 散列函数对象
+     * @param equal 关键字相等比较对象
+     */
+    explicit HashTable(size_t capacity = 16, const Hash& hasher = Hash(), const KeyEqual& equal = KeyEqual())
+        : size_(0), capacity_(roundUpToPowerOfTwo(capacity)), oldCapacity_(0), migrated_(0),
+          incremental_(false), hashFunction(hasher), keyEqual(equal) {
+        buckets.resize(capacity_);
+        policy.minCapacity = capacity_;
+        TRACE_SUMMARY("创建散列表，容量: " << capacity_ << std::endl);
+    }
+    
+    /**
+     * 析构函数
+     */
+    ~HashTable() = default;
+    
+    /**
+     * 获取当前元素数量
+     * @return 元素数量
+     */
+    size_t size() const {
+        return size_;
+    }
+    
+    /**
+     * 检查散列表是否为空
+     * @return 如果为空返回true，否则返回false
+     */
+    bool empty() const {
+        return size_ == 0;
+    }
+    
+    /**
+     * 获取装载因子
+     * @return 装载因子 α = n/m，其中n是元素数量，m是桶数量
+     */
+    double loadFactor() const {
+        return static_cast<double>(size_) / capacity_;
+    }
+    
+    /**
+     * 获取自动调整的负载因子下限
+     * @return 删除后负载因子低于该值时桶数减半
+     */
+    double minLoadFactor() const {
+        return policy.minLoad;
+    }
+
+    /**
+     * 获取自动调整的负载因子上限
+     * @return 插入后负载因子将超过该值时桶数加倍
+     */
+    double maxLoadFactor() const {
+        return policy.maxLoad;
+    }
+
+    /**
+     * 设置自动调整桶数的负载因子阈值，默认与动态表相同：上限 1，下限 1/4
+     * @param minLoad 负载因子下限，0 表示从不收缩
+     * @param maxLoad 负载因子上限
+     * @throws std::invalid_argument 如果阈值不满足0 <= 2·minLoad < maxLoad
+     */
+    void setLoadFactorThresholds(double minLoad, double maxLoad) {
+        DynamicTablePolicy updated = policy;
+        updated.minLoad = minLoad;
+        updated.maxLoad = maxLoad;
+        updated.validate();
+        policy = updated;
+    }
+
+    /**
+     * 选择一次性迁移还是增量迁移；关闭增量迁移时立即完成正在进行的迁移
+     * @param incremental 为true时每次插入、删除只迁移kHashTableRehashStep个旧桶
+     */
+    void setIncrementalRehash(bool incremental) {
+        incremental_ = incremental;
+        if (!incremental_) {
+            finishRehash();
+        }
+    }
+
+    /**
+     * 检查是否有尚未完成的增量迁移
+     * @return 如果旧桶数组中还有未迁移的元素返回true，否则返回false
+     */
+    bool isRehashing() const {
+        return oldCapacity_ != 0;
+    }
+
+    /**
+     * 立即完成正在进行的增量迁移
+     */
+    void finishRehash() {
+        migrate(oldCapacity_);
+    }
+
+    /**
+     * 把桶数调整为指定值并立即迁移全部元素，之后收缩不会低于这一桶数
+     * @param capacity 新的桶数，向上取到 2 的幂
+     * @throws std::invalid_argument 如果桶数为0
+     */
+    void rehash(size_t capacity) {
+        if (capacity == 0) {
+            throw std::invalid_argument("Hash table capacity must be positive");
+        }
+        capacity = roundUpToPowerOfTwo(capacity);
+        resize(capacity);
+        finishRehash();
+        policy.minCapacity = capacity;
+    }
+
+    /**
+     * 插入或更新键值对
+     * @param key 键
+     * @param value 值
+     */
+    void put(const K& key, const V& value) {
+        size_t index = hash(key);
+        TRACE_STEP("插入键值对: (" << key << ", " << value << ")，哈希值: " << index << std::endl);
+        
+        // 查找是否已存在该键，增量迁移时还要检查尚未迁移的旧桶
+        auto& bucket = buckets[index];
+        for (auto& pair : bucket) {
+            if (keyEqual(pair.first, key)) {
+                TRACE_STEP("键 " << key << " 已存在，更新值: " << pair.second << " -> " << value << std::endl);
+                pair.second = value;  // 更新值
+                return;
+            }
+        }
+        size_t old = pendingIndex(key);
+        if (old != oldCapacity_) {
+            for (auto& pair : oldBuckets[old]) {
+                if (keyEqual(pair.first, key)) {
+                    TRACE_STEP("键 " << key << " 已存在于旧桶 " << old << "，更新值: " << pair.second << " -> " << value << std::endl);
+                    pair.second = value;
+                    return;
+                }
+            }
+        }
+
+        // 负载因子将超过上限时先扩张
+        if (policy.shouldGrow(size_, capacity_)) {
+            resize(policy.grown(capacity_));
+            index = hash(key);
+        }
+        
+        // 插入新的键值对
+        auto& target = buckets[index];
+        if (!target.empty()) {
+            TRACE_COUNT("hashTable.collisions");
+        }
+        target.emplace_back(key, value);
+        size_++;
+        TRACE_STEP("成功插入键值对: (" << key << ", " << value << ")" << std::endl);
+        migrate(kHashTableRehashStep);
+    }
+    
+    /**
+     * 查找指定键对应的值
+     * @param key 键
+     * @return 对应的值
+     * @throws std::out_of_range 如果键不存在
+     */
+    V get(const K& key) const {
+        size_t index = hash(key);
+        TRACE_STEP("查找键: " << key << "，哈希值: " << index << std::endl);
+        
+        const auto& bucket = buckets[index];
+        for (const auto& pair : bucket) {
+            if (keyEqual(pair.first, key)) {
+                TRACE_STEP("找到键 " << key << "，对应值为: " << pair.second << std::endl);
+                return pair.second;
+            }
+        }
+        size_t old = pendingIndex(key);
+        if (old != oldCapacity_) {
+            for (const auto& pair : oldBuckets[old]) {
+                if (keyEqual(pair.first, key)) {
+                    TRACE_STEP("在旧桶 " << old << " 中找到键 " << key << "，对应值为: " << pair.second << std::endl);
+                    return pair.second;
+                }
+            }
+        }
+        
+        TRACE_STEP("未找到键: " << key << std::endl);
+        throw std::out_of_range("Key not found");
+    }
+    
+    /**
+     * 删除指定键值对，删除后负载因子低于下限时收缩
+     * @param key 要删除的键
+     * @return 如果删除成功返回true，否则返回false
+     */
+    bool remove(const K& key) {
+        size_t index = hash(key);
+        TRACE_STEP("删除键: " << key << "，哈希值: " << index << std::endl);
+        
+        size_t old = pendingIndex(key);
+        for (Bucket* bucket : {&buckets[index], old != oldCapacity_ ? &oldBuckets[old] : nullptr}) {
+            if (bucket == nullptr) {
+                continue;
+            }
+            for (auto it = bucket->begin(); it != bucket->end(); ++it) {
+                if (keyEqual(it->first, key)) {
+                    TRACE_STEP("找到并删除键值对: (" << it->first << ", " << it->second << ")" << std::endl);
+                    bucket->erase(it);
+                    size_--;
+                    if (policy.shouldShrink(size_, capacity_)) {
+                        resize(policy.shrunk(capacity_));
+                    }
+                    migrate(kHashTableRehashStep);
+                    return true;
+                }
+            }
+        }
+        
+        TRACE_STEP("未找到要删除的键: " << key << std::endl);
+        return false;
+    }
+    
+    /**
+     * 检查是否存在指定的键
+     * @param key 要检查的键
+     * @return 如果存在返回true，否则返回false
+     */
+    bool contains(const K& key) const {
+        size_t index = hash(key);
+        TRACE_STEP("检查键是否存在: " << key << "，哈希值: " << index << std::endl);
+        
+        const auto& bucket = buckets[index];
+        for (const auto& pair : bucket) {
+            if (keyEqual(pair.first, key)) {
+                TRACE_STEP("键 " << key << " 存在" << std::endl);
+                return true;
+            }
+        }
+        size_t old = pendingIndex(key);
+        if (old != oldCapacity_) {
+            for (const auto& pair : oldBuckets[old]) {
+                if (keyEqual(pair.first, key)) {
+                    TRACE_STEP("键 " << key << " 存在于旧桶 " << old << std::endl);
+                    return true;
+                }
+            }
+        }
+        
+        TRACE_STEP("键 " << key << " 不存在" << std::endl);
+        return false;
+    }
+    
+    /**
+     * 获取桶的数量
+     * @return 桶数量 m
+     */
+    size_t capacity() const {
+        return capacity_;
+    }
+    
+    /**
+     * 获取指定的桶，用于遍历散列表内容
+     * 增量迁移期间部分元素仍在旧桶数组中，遍历前先调用 finishRehash()
+     * @param i 桶索引，取值范围 [0, capacity())
+     * @return 第i个桶的链表
+     */
+    const Bucket& bucket(size_t i) const {
+        return buckets[i];
+    }
+
+    /**
+     * 统计各桶的链表长度，O(n + m)
+     * 增量迁移期间部分元素仍在旧桶数组中，统计前先调用 finishRehash()
+     * @return 桶数、空桶数、冲突数、最长链表与链表长度的分布
+     */
+    HashTableBucketStats bucketStats() const {
+        HashTableBucketStats stats;
+        stats.buckets = capacity_;
+        size_t probes = 0;
+        for (const Bucket& b : buckets) {
+            size_t length = b.size();
+            if (length >= stats.histogram.size()) {
+                stats.histogram.resize(length + 1, 0);
+            }
+            stats.histogram[length]++;
+            stats.elements += length;
+            stats.maxChain = std::max(stats.maxChain, length);
+            stats.collisions += length > 0 ? length - 1 : 0;
+            // 链表中第 k 个元素需要比较 k 次
+            probes += length * (length + 1) / 2;
+        }
+        stats.emptyBuckets = stats.histogram.empty() ? 0 : stats.histogram[0];
+        stats.successfulProbes = stats.elements == 0 ? 0.0 : static_cast<double>(probes) / stats.elements;
+        return stats;
+    }
+};
+
+#endif //CLRS_C3_U11_HASH_TABLE_H
@@ -0,0 +1,343 @@
+//
+// Created by HaPpY on 2026/10/17.
+//
+
+#ifndef CLRS_C3_U11_OPEN_HASH_TABLE_H
+#define CLRS_C3_U11_OPEN_HASH_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "common/Trace.h"
+
+/**
+ * 开放寻址散列表（线性探测 + 控制字节 + 后移删除）
+ *
+ * 与 HashTable 的接口相同（put / get / remove / contains），但不为每个元素分配链表节点：
+ * - 元素直接存放在槽数组中，另有一个控制字节数组，每个槽一个字节：
+ *   最高位为 1 表示空槽，否则低 7 位是散列值的指纹 H2；
+ * - 查找从散列值决定的起始槽开始线性探测，每次读入 16 个控制字节，用 SSE2 一条比较指令
+ *   找出指纹相同的槽，只对这些槽比较关键字；这 16 个字节中出现空槽即可停止；
+ * - 删除时把后面同一探测段中可以前移的元素依次前移（backward shift），不留"已删除"标记，
+ *   查找长度不会随删除次数退化。
+ * 装载因子超过 maxLoadFactor()（默认 0.875）时容量翻倍并重新插入全部元素。
+ * 没有 SSE2 时退化为逐字节比较，结果相同。
+ */
+
+// 一次探测读入的控制字节数
+inline constexpr size_t kOpenHashGroupWidth = 16;
+
+template<typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+class OpenHashTable {
+public:
+    using value_type = std::pair<K, V>;
+
+private:
+    // 控制字节：空槽为 0x80，已占用的槽为 0 ~ 127 的指纹
+    static constexpr uint8_t kEmpty = 0x80;
+
+    /**
+     * 从 ctrl 开始的 16 个控制字节，match() 与 maskEmpty() 返回位掩码，第 i 位对应第 i 个槽
+     */
+    struct Group {
+#if defined(__SSE2__)
+        __m128i ctrl;
+
+        explicit Group(const uint8_t* p) : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))) {}
+
+        uint32_t match(uint8_t h2) const {
+            return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(static_cast<char>(h2)))));
+        }
+
+        uint32_t maskEmpty() const {
+            return static_cast<uint32_t>(_mm_movemask_epi8(ctrl));
+        }
+#else
+        const uint8_t* ctrl;
+
+        explicit Group(const uint8_t* p) : ctrl(p) {}
+
+        uint32_t match(uint8_t h2) const {
+            uint32_t mask = 0;
+            for (size_t i = 0; i < kOpenHashGroupWidth; i++) {
+                mask |= static_cast<uint32_t>(ctrl[i] == h2) << i;
+            }
+            return mask;
+        }
+
+        uint32_t maskEmpty() const {
+            uint32_t mask = 0;
+            for (size_t i = 0; i < kOpenHashGroupWidth; i++) {
+                mask |= static_cast<uint32_t>(ctrl[i] >> 7) << i;
+            }
+            return mask;
+        }
+#endif
+    };
+
+    /**
+     * 控制字节数组长度为 capacity_ + 15，末尾 15 个字节是开头 15 个字节的副本，
+     * 从任何一个槽开始都能直接读入 16 个字节，探测到表尾时不必拆成两次读取
+     */
+    std::vector<uint8_t> ctrl;
+    std::vector<value_type> slots;
+    size_t size_;       // 当前元素数量
+    size_t capacity_;   // 槽的数量，2 的幂
+    int shift_;         // 64 - log2(capacity_)，散列值的高位决定起始槽
+    double maxLoad_;
+
+    Hash hashFunction;
+    KeyEqual keyEqual;
+
+    /**
+     * 把 hashFunction 的结果乘以 2^64 / phi 打散：std::hash<int> 是恒等映射，
+     * 直接取低位作为起始槽会让连续的关键字挤成一段
+     */
+    uint64_t mix(const K& key) const {
+        return static_cast<uint64_t>(hashFunction(key)) * 0x9E3779B97F4A7C15ull;
+    }
+
+    // 起始槽取打散后的高位
+    size_t home(uint64_t h) const {
+        return static_cast<size_t>(h >> shift_);
+    }
+
+    /**
+     * 指纹取紧挨在起始槽下面的 7 位，与起始槽使用的位不重叠。
+     * 乘积的低位只取决于 hashFunction 结果的低位：关键字按 128 对齐且散列函数是恒等映射时，
+     * 低 7 位全为 0，指纹失去作用；高半部分的每一位都与关键字的全部位相关
+     */
+    uint8_t fingerprint(uint64_t h) const {
+        return static_cast<uint8_t>((h >> (shift_ - 7)) & 0x7F);
+    }
+
+    // 设置第 i 个槽的控制字节，同时维护末尾的副本
+    void setCtrl(size_t i, uint8_t c) {
+        ctrl[i] = c;
+        if (i < kOpenHashGroupWidth - 1) {
+            ctrl[capacity_ + i] = c;
+        }
+    }
+
+    /**
+     * 查找关键字所在的槽
+     * @return 槽下标，不存在时返回 capacity_
+     */
+    size_t find(const K& key) const {
+        uint64_t h = mix(key);
+        uint8_t h2 = fingerprint(h);
+        size_t mask = capacity_ - 1;
+        size_t pos = home(h);
+        while (true) {
+            Group g(&ctrl[pos]);
+            for (uint32_t m = g.match(h2); m != 0; m &= m - 1) {
+                size_t i = (pos + __builtin_ctz(m)) & mask;
+                if (keyEqual(slots[i].first, key)) {
+                    return i;
+                }
+            }
+            if (g.maskEmpty() != 0) {
+                return capacity_;
+            }
+            pos = (pos + kOpenHashGroupWidth) & mask;
+            TRACE_COUNT("openHashTable.groupProbes");
+        }
+    }
+
+    /**
+     * 从起始槽开始找到第一个空槽，放入关键字不存在的元素
+     */
+    void insertNew(uint64_t h, value_type&& item) {
+        size_t mask = capacity_ - 1;
+        size_t pos = home(h);
+        while (true) {
+            uint32_t empty = Group(&ctrl[pos]).maskEmpty();
+            if (empty != 0) {
+                size_t i = (pos + __builtin_ctz(empty)) & mask;
+                setCtrl(i, fingerprint(h));
+                slots[i] = std::move(item);
+                size_++;
+                return;
+            }
+            pos = (pos + kOpenHashGroupWidth) & mask;
+        }
+    }
+
+    /**
+     * 分配 capacity 个空槽，并重新插入原有的元素
+     */
+    void rehash(size_t capacity) {
+        std::vector<uint8_t> oldCtrl = std::move(ctrl);
+        std::vector<value_type> oldSlots = std::move(slots);
+        size_t oldCapacity = capacity_;
+        allocate(capacity);
+        for (size_t i = 0; i < oldCapacity; i++) {
+            if (!(oldCtrl[i] & kEmpty)) {
+                insertNew(mix(oldSlots[i].first), std::move(oldSlots[i]));
+            }
+        }
+        TRACE_SUMMARY("开放寻址散列表扩容: " << oldCapacity << " -> " << capacity_ << std::endl);
+        TRACE_COUNT("openHashTable.rehashes");
+    }
+
+    // 容量向上取到 2 的幂，且不小于 16
+    void allocate(size_t capacity) {
+        capacity_ = kOpenHashGroupWidth;
+        shift_ = 60;
+        while (capacity_ < capacity) {
+            capacity_ *= 2;
+            shift_--;
+        }
+        ctrl.assign(capacity_ + kOpenHashGroupWidth - 1, kEmpty);
+        slots.assign(capacity_, value_type());
+        size_ = 0;
+    }
+
+public:
+    /**
+     * 构造函数
+     * @param capacity 初始槽数，向上取到 2 的幂，且不小于 16
+     * @param hasher 散列函数对象
+     * @param equal 关键字相等比较对象
+     */
+    explicit OpenHashTable(size_t capacity = 16, const Hash& hasher = Hash(), const KeyEqual& equal = KeyEqual())
+        : size_(0), capacity_(0), shift_(0), maxLoad_(0.875), hashFunction(hasher), keyEqual(equal) {
+        allocate(capacity);
+        TRACE_SUMMARY("创建开放寻址散列表，容量: " << capacity_ << std::endl);
+    }
+
+    /**
+     * 获取当前元素数量
+     * @return 元素数量
+     */
+    size_t size() const {
+        return size_;
+    }
+
+    /**
+     * 检查散列表是否为空
+     * @return 如果为空返回true，否则返回false
+     */
+    bool empty() const {
+        return size_ == 0;
+    }
+
+    /**
+     * 获取槽的数量
+     * @return 槽数量 m
+     */
+    size_t capacity() const {
+        return capacity_;
+    }
+
+    /**
+     * 获取装载因子
+     * @return 装载因子 α = n/m，其中n是元素数量，m是槽数量
+     */
+    double loadFactor() const {
+        return static_cast<double>(size_) / capacity_;
+    }
+
+    /**
+     * 获取扩容阈值
+     * @return 插入后装载因子超过该值时容量翻倍
+     */
+    double maxLoadFactor() const {
+        return maxLoad_;
+    }
+
+    /**
+     * 设置扩容阈值。线性探测要求至少留有一个空槽，阈值必须小于 1
+     * @param load 新的阈值，取值范围 (0, 1)
+     * @throws std::invalid_argument 如果阈值不在(0, 1)内
+     */
+    void setMaxLoadFactor(double load) {
+        if (!(load > 0.0 && load < 1.0)) {
+            throw std::invalid_argument("Max load factor must be in (0, 1)");
+        }
+        maxLoad_ = load;
+    }
+
+    /**
+     * 插入或更新键值对
+     * @param key 键
+     * @param value 值
+     */
+    void put(const K& key, const V& value) {
+        size_t i = find(key);
+        if (i != capacity_) {
+            TRACE_STEP("键 " << key << " 已存在于槽 " << i << "，更新值: " << slots[i].second << " -> " << value << std::endl);
+            slots[i].second = value;
+            return;
+        }
+        if (static_cast<double>(size_ + 1) > maxLoad_ * static_cast<double>(capacity_)) {
+            rehash(capacity_ * 2);
+        }
+        insertNew(mix(key), value_type(key, value));
+        TRACE_STEP("成功插入键值对: (" << key << ", " << value << ")" << std::endl);
+    }
+
+    /**
+     * 查找指定键对应的值
+     * @param key 键
+     * @return 对应的值
+     * @throws std::out_of_range 如果键不存在
+     */
+    V get(const K& key) const {
+        size_t i = find(key);
+        if (i == capacity_) {
+            TRACE_STEP("未找到键: " << key << std::endl);
+            throw std::out_of_range("Key not found");
+        }
+        TRACE_STEP("在槽 " << i << " 找到键 " << key << "，对应值为: " << slots[i].second << std::endl);
+        return slots[i].second;
+    }
+
+    /**
+     * 删除指定键值对：之后的元素只要不越过自己的起始槽，就依次前移一格填补空位
+     * @param key 要删除的键
+     * @return 如果删除成功返回true，否则返回false
+     */
+    bool remove(const K& key) {
+        size_t i = find(key);
+        if (i == capacity_) {
+            TRACE_STEP("未找到要删除的键: " << key << std::endl);
+            return false;
+        }
+        TRACE_STEP("找到并删除键值对: (" << slots[i].first << ", " << slots[i].second << ")，槽 " << i << std::endl);
+        size_t mask = capacity_ - 1;
+        for (size_t j = (i + 1) & mask; !(ctrl[j] & kEmpty); j = (j + 1) & mask) {
+            // 槽 j 中的元素离起始槽的距离不小于 i 到 j 的距离时，i 仍在它的探测段内，可以前移到 i
+            size_t distance = (j - home(mix(slots[j].first))) & mask;
+            if (distance >= ((j - i) & mask)) {
+                slots[i] = std::move(slots[j]);
+                setCtrl(i, ctrl[j]);
+                i = j;
+                TRACE_COUNT("openHashTable.shifts");
+            }
+        }
+        setCtrl(i, kEmpty);
+        slots[i] = value_type();
+        size_--;
+        return true;
+    }
+
+    /**
+     * 检查是否存在指定的键
+     * @param key 要检查的键
+     * @return 如果存在返回true，否则返回false
+     */
+    bool contains(const K& key) const {
+        return find(key) != capacity_;
+    }
+};
+
+#endif //CLRS_C3_U11_OPEN_HASH_TABLE_H
@@ -0,0 +1,501 @@
+//
+// Created by HaPpY on 2026/10/17.
+//
+
+#ifndef CLRS_C3_U11_PERFECT_HASH_TABLE_H
+#define CLRS_C3_U11_PERFECT_HASH_TABLE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "HashPolicies.h"
+#include "common/MappedFile.h"
+#include "common/Trace.h"
+
+/**
+ * 静态关键字集合上的完美散列表（《算法导论》11.5）
+ *
+ * 关键字集合在构造时给定，之后只读。采用 CHD（压缩-散列-位移）一类的两级散列：
+ * - 第一级把 n 个关键字散列到 r ≈ n / kPerfectHashBucketSize 个桶，其中 60% 的关键字
+ *   集中在前 30% 的桶里（与 PTHash 相同），大桶多、放得早，之后的小桶更容易找到位置；
+ * - 第二级为每个桶选一个位移值（pilot）p：桶内每个关键字的位置是 g(h(k), p) mod m，
+ *   m ≈ n / kPerfectHashLoad 略大于 n。按桶从大到小依次尝试 p = 0, 1, 2, ...，
+ *   直到桶内关键字全部落在尚未占用的位置上；
+ * - 落在 [n, m) 中的少数位置通过一张重映射表换到 [0, n) 的空位上，最终的位置恰好是
+ *   0 ~ n-1 的一个排列（最小完美散列），关键字与值按位置顺序存放，没有空槽。
+ * 与 11.5 的 FKS 方案相同，查找最坏情况 O(1)：一次第一级散列、读一个位移值、
+ * 一次第二级散列、（约 3% 的关键字）读一次重映射表、比较一次关键字；不同的是第二级不为每个桶
+ * 分配 Θ(桶大小²) 的子表，全部关键字共用一张大小为 n 的表。
+ * 位移值用 16 位整数保存，除关键字与值以外，每个关键字只需约 16 / kPerfectHashBucketSize 位，
+ * 另有 (m - n) 个 32 位的重映射项。
+ *
+ * 构造出的表在内存中是一块连续的字节，布局与文件相同：save() 直接写出，
+ * load() 用 mmap 映射文件后即可查找，不需要重新构造，也不逐个读入元素。
+ * 因此关键字与值必须可平凡复制；文件使用本机字节序，加载时 Hash 必须与构造时相同
+ * （文件中只保存种子）。
+ *
+ * 用法：
+ *   PerfectHashTable<uint64_t, uint32_t> table(items);   // items: std::vector<std::pair<K, V>>
+ *   table.save("ids.bin");
+ *   PerfectHashTable<uint64_t, uint32_t> mapped = PerfectHashTable<uint64_t, uint32_t>::load("ids.bin");
+ *   const uint32_t* v = mapped.find(42);
+ */
+
+// 第一级平均每个桶的关键字数：越大位移值越省空间，构造越慢
+inline constexpr size_t kPerfectHashBucketSize = 4;
+// 第二级的装载因子 n / m：越接近 1 重映射表越小，最后几个桶越难找到位置
+inline constexpr double kPerfectHashLoad = 0.97;
+
+template<typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+class PerfectHashTable {
+    static_assert(std::is_trivially_copyable<K>::value && std::is_trivially_copyable<V>::value,
+                  "PerfectHashTable requires trivially copyable keys and values");
+    static_assert(alignof(K) <= alignof(uint64_t) && alignof(V) <= alignof(uint64_t),
+                  "PerfectHashTable stores keys and values at 8-byte aligned offsets");
+
+    // 关键字与值相邻存放，查找命中时只访问一次内存
+    struct Entry {
+        K key;
+        V value;
+    };
+
+    // 文件头，之后依次是位移值、重映射表、元素，每段按 8 字节对齐
+    struct Header {
+        char magic[8];
+        uint64_t keySize;
+        uint64_t valueSize;
+        uint64_t size;      // 关键字数 n
+        uint64_t slots;     // 第二级的位置数 m
+        uint64_t buckets;   // 第一级的桶数 r
+        uint64_t seed;      // 散列种子
+    };
+
+    static constexpr char kMagic[8] = {'C', 'L', 'R', 'S', 'P', 'H', 'T', '1'};
+    // 构造失败时最多更换的种子数
+    static constexpr int kMaxSeeds = 16;
+    // 单个桶最多尝试的位移值个数（16 位整数能表示的个数），超过后更换种子
+    static constexpr uint32_t kMaxPilot = uint32_t(1) << 16;
+    // 散列值小于该值（2^64 的 60%）的关键字落在前 30% 的桶中
+    static constexpr uint64_t kDenseThreshold = 0x9999999999999999ull;
+
+    // 各段在字节块中的偏移
+    struct Layout {
+        size_t pilots;
+        size_t remap;
+        size_t entries;
+        size_t total;
+    };
+
+    static size_t align8(size_t n) {
+        return (n + 7) & ~size_t(7);
+    }
+
+    static Layout layoutFor(size_t n, size_t m, size_t r) {
+        Layout l;
+        l.pilots = sizeof(Header);
+        l.remap = align8(l.pilots + r * sizeof(uint16_t));
+        l.entries = align8(l.remap + (m - n) * sizeof(uint32_t));
+        l.total = align8(l.entries + n * sizeof(Entry));
+        return l;
+    }
+
+    // murmur3 的 64 位终结函数，是 64 位整数上的双射
+    static uint64_t fmix64(uint64_t h) {
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ull;
+        h ^= h >> 33;
+        return h;
+    }
+
+    // 把 64 位散列值均匀映射到 [0, n)：取 h·n 的高 64 位，不做除法
+    static uint64_t fastRange(uint64_t h, uint64_t n) {
+        return static_cast<uint64_t>((static_cast<__uint128_t>(h) * n) >> 64);
+    }
+
+    // 第二级：位移值为 pilot 时关键字的位置，异或后再乘一个奇数，pilot 不同时位置近似独立
+    static uint64_t position(uint64_t h, uint64_t pilot, uint64_t m) {
+        return fastRange((h ^ (pilot * 0x9E3779B97F4A7C15ull)) * 0xD6E8FEB86659FD93ull, m);
+    }
+
+    // 第一级：前 30% 的桶较密，乘以奇数换一组位，使桶号与上面的判断无关
+    // 密、疏两部分用条件传送选择，不用分支：60% 对 40% 的分支几乎无法预测
+    size_t bucketOf(uint64_t h) const {
+        size_t dense = denseBuckets();
+        uint64_t mixed = h * 0x9E3779B97F4A7C15ull;
+        bool sparse = h >= kDenseThreshold && dense != buckets_;
+        return (sparse ? dense : 0) + fastRange(mixed, sparse ? buckets_ - dense : dense);
+    }
+
+    // 前面较密的桶数：只有一个桶时就是这个桶，否则介于 1 与 r - 1 之间
+    size_t denseBuckets() const {
+        return buckets_ <= 1 ? buckets_ : std::min(buckets_ - 1, std::max<size_t>(1, buckets_ * 3 / 10));
+    }
+
+    uint64_t hashOf(const K& key) const {
+        return fmix64(static_cast<uint64_t>(hashFunction(key)) ^ seed_);
+    }
+
+    Hash hashFunction;
+    KeyEqual keyEqual;
+
+    std::vector<uint64_t> owned_;   // 构造得到的字节块，按 uint64_t 分配以保证对齐
+    MappedFile mapped_;             // load() 映射的文件
+    const unsigned char* data_ = nullptr;
+    size_t bytes_ = 0;
+
+    size_t size_ = 0;
+    size_t slots_ = 0;
+    size_t buckets_ = 0;
+    uint64_t seed_ = 0;
+    const uint16_t* pilots_ = nullptr;
+    const uint32_t* remap_ = nullptr;
+    const Entry* entries_ = nullptr;
+
+    PerfectHashTable(const Hash& hasher, const KeyEqual& equal) : hashFunction(hasher), keyEqual(equal) {}
+
+    // 由文件头设置各段的指针
+    void attach(const unsigned char* data, size_t bytes) {
+        Header header;
+        if (bytes < sizeof(Header)) {
+            throw std::runtime_error("Invalid perfect hash file: truncated header");
+        }
+        std::memcpy(&header, data, sizeof(Header));
+        if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) {
+            throw std::runtime_error("Invalid perfect hash file: bad magic");
+        }
+        if (header.keySize != sizeof(K) || header.valueSize != sizeof(V)) {
+            throw std::runtime_error("Invalid perfect hash file: key or value size mismatch");
+        }
+        // 各段的长度先与文件大小比较，再计算布局，过大的字段不会让 layoutFor 溢出
+        if (header.slots < header.size || (header.size > 0 && header.buckets == 0)
+            || header.size > bytes / sizeof(Entry)
+            || header.slots - header.size > bytes / sizeof(uint32_t)
+            || header.buckets > bytes / sizeof(uint16_t)
+            || layoutFor(header.size, header.slots, header.buckets).total != bytes) {
+            throw std::runtime_error("Invalid perfect hash file: inconsistent sizes");
+        }
+        Layout l = layoutFor(header.size, header.slots, header.buckets);
+        // 查找把重映射表中的值直接用作元素下标，逐项检查，O(m - n)
+        const uint32_t* remap = reinterpret_cast<const uint32_t*>(data + l.remap);
+        for (size_t i = 0; i < header.slots - header.size; i++) {
+            if (remap[i] >= header.size) {
+                throw std::runtime_error("Invalid perfect hash file: remap entry out of range");
+            }
+        }
+        data_ = data;
+        bytes_ = bytes;
+        size_ = header.size;
+        slots_ = header.slots;
+        buckets_ = header.buckets;
+        seed_ = header.seed;
+        pilots_ = reinterpret_cast<const uint16_t*>(data + l.pilots);
+        remap_ = reinterpret_cast<const uint32_t*>(data + l.remap);
+        entries_ = reinterpret_cast<const Entry*>(data + l.entries);
+    }
+
+    /**
+     * 用给定的种子为每个桶寻找位移值
+     * @param slotOf 输出：第 i 个关键字在 [0, m) 中的位置
+     * @return 全部桶都找到位移值时返回true，某个桶尝试 kMaxPilot 次仍失败时返回false
+     */
+    bool searchPilots(const std::vector<std::pair<K, V>>& items, std::vector<uint16_t>& pilots,
+                      std::vector<uint64_t>& slotOf) const {
+        size_t n = items.size();
+        std::vector<uint64_t> hashes(n);
+        for (size_t i = 0; i < n; i++) {
+            hashes[i] = hashOf(items[i].first);
+        }
+
+        // 按桶分组（计数排序）：桶 b 的关键字为 order[start[b], start[b + 1])
+        std::vector<size_t> start(buckets_ + 1, 0);
+        for (uint64_t h : hashes) {
+            start[bucketOf(h) + 1]++;
+        }
+        for (size_t b = 0; b < buckets_; b++) {
+            start[b + 1] += start[b];
+        }
+        std::vector<size_t> order(n);
+        std::vector<size_t> next(start.begin(), start.end() - 1);
+        for (size_t i = 0; i < n; i++) {
+            order[next[bucketOf(hashes[i])]++] = i;
+        }
+
+        // 同一个桶中散列值相同的两个关键字无论位移值取什么都会冲突
+        for (size_t b = 0; b < buckets_; b++) {
+            for (size_t x = start[b]; x < start[b + 1]; x++) {
+                for (size_t y = x + 1; y < start[b + 1]; y++) {
+                    if (hashes[order[x]] != hashes[order[y]]) {
+                        continue;
+                    }
+                    if (keyEqual(items[order[x]].first, items[order[y]].first)) {
+                        throw std::invalid_argument("Duplicate key in perfect hash key set");
+                    }
+                    throw std::invalid_argument("Hash function maps two distinct keys to the same value");
+                }
+            }
+        }
+
+        // 大桶先放：表还空的时候容易为它们找到位移值
+        std::vector<size_t> byBucketSize(buckets_);
+        for (size_t b = 0; b < buckets_; b++) {
+            byBucketSize[b] = b;
+        }
+        std::stable_sort(byBucketSize.begin(), byBucketSize.end(), [&](size_t a, size_t b) {
+            return start[a + 1] - start[a] > start[b + 1] - start[b];
+        });
+
+        std::vector<bool> taken(slots_, false);
+        std::vector<uint64_t> placed;
+        pilots.assign(buckets_, 0);
+        slotOf.assign(n, 0);
+        uint64_t retries = 0;
+        for (size_t b : byBucketSize) {
+            if (start[b] == start[b + 1]) {
+                break;
+            }
+            uint32_t pilot = 0;
+            for (;; pilot++) {
+                if (pilot == kMaxPilot) {
+                    TRACE_COUNT_ADD("perfectHashTable.pilotRetries", retries);
+                    return false;
+                }
+                // 逐个占用位置，遇到冲突时撤销本桶已占用的位置
+                placed.clear();
+                for (size_t x = start[b]; x < start[b + 1]; x++) {
+                    uint64_t pos = position(hashes[order[x]], pilot, slots_);
+                    if (taken[pos]) {
+                        break;
+                    }
+                    taken[pos] = true;
+                    placed.push_back(pos);
+                }
+                if (placed.size() == start[b + 1] - start[b]) {
+                    break;
+                }
+                for (uint64_t pos : placed) {
+                    taken[pos] = false;
+                }
+                retries++;
+            }
+            pilots[b] = static_cast<uint16_t>(pilot);
+            for (size_t x = start[b]; x < start[b + 1]; x++) {
+                slotOf[order[x]] = placed[x - start[b]];
+            }
+        }
+        TRACE_COUNT_ADD("perfectHashTable.pilotRetries", retries);
+        return true;
+    }
+
+public:
+    /**
+     * 构造函数：为给定的关键字集合构造最小完美散列表，期望 O(n) 时间
+     * @param items 键值对，关键字互不相同
+     * @param hasher 散列函数对象
+     * @param equal 关键字相等比较对象
+     * @throws std::invalid_argument 如果有重复的关键字，或 hasher 把两个不同的关键字映射为同一个值
+     * @throws std::length_error 如果关键字数不小于 2^32
+     * @throws std::runtime_error 如果更换 kMaxSeeds 个种子后仍未找到完美散列函数
+     */
+    explicit PerfectHashTable(const std::vector<std::pair<K, V>>& items, const Hash& hasher = Hash(),
+                              const KeyEqual& equal = KeyEqual())
+        : hashFunction(hasher), keyEqual(equal) {
+        size_t n = items.size();
+        if (n >= (uint64_t(1) << 32)) {
+            throw std::length_error("Perfect hash key set must have fewer than 2^32 keys");
+        }
+        size_t m = n == 0 ? 0 : std::max(n + 1, static_cast<size_t>(static_cast<double>(n) / kPerfectHashLoad));
+        size_t r = n == 0 ? 0 : (n + kPerfectHashBucketSize - 1) / kPerfectHashBucketSize;
+        slots_ = m;
+        buckets_ = r;
+
+        std::vector<uint16_t> pilots;
+        std::vector<uint64_t> slotOf;
+        uint64_t seedState = kHashPolicyDefaultSeed;
+        int attempt = 0;
+        for (;; attempt++) {
+            if (attempt == kMaxSeeds) {
+                throw std::runtime_error("Failed to build perfect hash function");
+            }
+            seed_ = splitMix64(seedState);
+            if (searchPilots(items, pilots, slotOf)) {
+                break;
+            }
+            TRACE_COUNT("perfectHashTable.reseeds");
+        }
+
+        Layout l = layoutFor(n, m, r);
+        owned_.assign(l.total / sizeof(uint64_t), 0);
+        unsigned char* data = reinterpret_cast<unsigned char*>(owned_.data());
+        Header header{};
+        std::memcpy(header.magic, kMagic, sizeof(kMagic));
+        header.keySize = sizeof(K);
+        header.valueSize = sizeof(V);
+        header.size = n;
+        header.slots = m;
+        header.buckets = r;
+        header.seed = seed_;
+        std::memcpy(data, &header, sizeof(Header));
+        if (r > 0) {
+            std::memcpy(data + l.pilots, pilots.data(), r * sizeof(uint16_t));
+        }
+
+        // [n, m) 中被占用的位置依次换到 [0, n) 中的空位，两者个数相等
+        std::vector<uint8_t> taken(m, 0);
+        for (uint64_t pos : slotOf) {
+            taken[pos] = 1;
+        }
+        uint32_t* remap = reinterpret_cast<uint32_t*>(data + l.remap);
+        size_t hole = 0;
+        for (size_t pos = n; pos < m; pos++) {
+            if (taken[pos]) {
+                while (taken[hole]) {
+                    hole++;
+                }
+                remap[pos - n] = static_cast<uint32_t>(hole++);
+            }
+        }
+
+        Entry* entries = reinterpret_cast<Entry*>(data + l.entries);
+        for (size_t i = 0; i < n; i++) {
+            uint64_t pos = slotOf[i] < n ? slotOf[i] : remap[slotOf[i] - n];
+            ::new (&entries[pos]) Entry{items[i].first, items[i].second};
+        }
+        attach(data, l.total);
+        TRACE_SUMMARY("构造完美散列表，关键字数: " << n << "，桶数: " << r << "，位置数: " << m
+                      << "，更换种子 " << attempt << " 次，共 " << bytes_ << " 字节" << std::endl);
+    }
+
+    PerfectHashTable(const PerfectHashTable&) = delete;
+    PerfectHashTable& operator=(const PerfectHashTable&) = delete;
+    // 移动时字节块（vector 的缓冲区或映射的内存）的地址不变，各段的指针仍然有效
+    PerfectHashTable(PerfectHashTable&&) noexcept = default;
+    PerfectHashTable& operator=(PerfectHashTable&&) noexcept = default;
+
+    /**
+     * 映射 save() 写出的文件，只检查文件头与 (m - n) 项重映射表，
+     * 元素与位移值的页面在查找时才由操作系统按需载入
+     * @param path 文件路径
+     * @param hasher 散列函数对象，必须与构造时相同
+     * @param equal 关键字相等比较对象
+     * @return 只读的完美散列表
+     * @throws std::runtime_error 如果文件无法打开、不是同一类型的表写出的文件，或者已被截断、损坏
+     */
+    static PerfectHashTable load(const std::string& path, const Hash& hasher = Hash(), const KeyEqual& equal = KeyEqual()) {
+        PerfectHashTable table(hasher, equal);
+        table.mapped_ = MappedFile(path);
+        table.attach(table.mapped_.data(), table.mapped_.size());
+        TRACE_SUMMARY("映射完美散列表: " << path << "，关键字数: " << table.size_ << std::endl);
+        return table;
+    }
+
+    /**
+     * 把表写入文件
+     * @param path 文件路径
+     * @throws std::runtime_error 如果文件无法写入
+     */
+    void save(const std::string& path) const {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(data_), static_cast<std::streamsize>(bytes_));
+        if (!out) {
+            throw std::runtime_error("Cannot write perfect hash file: " + path);
+        }
+    }
+
+    /**
+     * 获取关键字数量
+     * @return 关键字数量
+     */
+    size_t size() const {
+        return size_;
+    }
+
+    /**
+     * 检查散列表是否为空
+     * @return 如果为空返回true，否则返回false
+     */
+    bool empty() const {
+        return size_ == 0;
+    }
+
+    /**
+     * 获取第一级的桶数
+     * @return 桶数 r
+     */
+    size_t bucketCount() const {
+        return buckets_;
+    }
+
+    /**
+     * 获取表占用的字节数，即 save() 写出的文件大小
+     * @return 字节数
+     */
+    size_t bytes() const {
+        return bytes_;
+    }
+
+    /**
+     * 关键字在 [0, size()) 中的编号（最小完美散列函数的值），不检查关键字是否在集合中
+     * @param key 集合中的关键字
+     * @return 编号，集合中不同的关键字编号不同
+     */
+    size_t indexOf(const K& key) const {
+        uint64_t h = hashOf(key);
+        uint64_t pos = position(h, pilots_[bucketOf(h)], slots_);
+        return static_cast<size_t>(pos < size_ ? pos : remap_[pos - size_]);
+    }
+
+    /**
+     * 查找，最坏情况 O(1)
+     * @param key 键
+     * @return 指向对应值的指针，键不在集合中时返回nullptr
+     */
+    const V* find(const K& key) const {
+        if (size_ == 0) {
+            return nullptr;
+        }
+        size_t i = indexOf(key);
+        if (!keyEqual(entries_[i].key, key)) {
+            TRACE_STEP("未找到键: " << key << std::endl);
+            return nullptr;
+        }
+        TRACE_STEP("在位置 " << i << " 找到键 " << key << "，对应值为: " << entries_[i].value << std::endl);
+        return &entries_[i].value;
+    }
+
+    /**
+     * 查找指定键对应的值
+     * @param key 键
+     * @return 对应的值
+     * @throws std::out_of_range 如果键不存在
+     */
+    V get(const K& key) const {
+        const V* value = find(key);
+        if (value == nullptr) {
+            throw std::out_of_range("Key not found");
+        }
+        return *value;
+    }
+
+    /**
+     * 检查是否存在指定的键
+     * @param key 要检查的键
+     * @return 如果存在返回true，否则返回false
+     */
+    bool contains(const K& key) const {
+        return find(key) != nullptr;
+    }
+};
+
+#endif //CLRS_C3_U11_PERFECT_HASH_TABLE_H
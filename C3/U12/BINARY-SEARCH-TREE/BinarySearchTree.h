@@ -0,0 +1,460 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#ifndef CLRS_C3_U12_BINARY_SEARCH_TREE_H
+#define CLRS_C3_U12_BINARY_SEARCH_TREE_H
+
+#include <queue>
+#include <stack>
+#include <climits>
+
+#include "common/Trace.h"
+
+/**
+ * 二叉搜索树实现
+ * 根据《算法导论》第12章内容实现
+ */
+
+// 二叉搜索树节点结构
+struct TreeNode {
+    int key;              // 节点存储的数据
+    TreeNode* parent;     // 指向父节点的指针
+    TreeNode* left;       // 指向左子节点的指针
+    TreeNode* right;      // 指向右子节点的指针
+    
+    /**
+     * 构造函数
+     * @param k 节点的键值
+     */
+    TreeNode(int k) : key(k), parent(nullptr), left(nullptr), right(nullptr) {}
+};
+
+// 二叉搜索树类
+class BinarySearchTree {
+private:
+    TreeNode* root;  // 指向根节点的指针
+    
+public:
+    /**
+     * 构造函数，初始化空树
+     */
+    BinarySearchTree() : root(nullptr) {
+        TRACE_SUMMARY("创建二叉搜索树" << std::endl);
+    }
+    
+    /**
+     * 析构函数，释放整棵树的内存
+     */
+    ~BinarySearchTree() {
+        destroyTree(root);
+    }
+    
+    /**
+     * 递归销毁整棵树
+     * @param node 要销毁的节点
+     */
+    void destroyTree(TreeNode* node) {
+        if (node) {
+            TRACE_STEP("销毁节点: " << node->key << std::endl);
+            destroyTree(node->left);
+            destroyTree(node->right);
+            delete node;
+        }
+    }
+    
+    /**
+     * 获取根节点
+     * @return 指向根节点的指针
+     */
+    TreeNode* getRoot() const {
+        return root;
+    }
+    
+    /**
+     * 检查树是否为空
+     * @return 如果为空返回true，否则返回false
+     */
+    bool isEmpty() const {
+        return root == nullptr;
+    }
+    
+    /**
+     * 创建一个新的树节点
+     * @param key 节点的键值
+     * @return 指向新创建节点的指针
+     */
+    TreeNode* createNode(int key) {
+        TRACE_STEP("创建节点: " << key << std::endl);
+        return new TreeNode(key);
+    }
+    
+    /**
+     * 设置根节点
+     * @param node 新的根节点
+     */
+    void setRoot(TreeNode* node) {
+        TRACE_STEP("设置根节点为: " << (node ? std::to_string(node->key) : "nullptr") << std::endl);
+        root = node;
+        if (root) {
+            root->parent = nullptr;
+        }
+    }
+    
+    /**
+     * 在二叉搜索树中搜索指定键值的节点
+     * @param key 要搜索的键值
+     * @return 找到的节点指针，未找到返回nullptr
+     */
+    TreeNode* search(int key) const {
+        TRACE_STEP("在二叉搜索树中搜索键值: " << key << std::endl);
+        TreeNode* current = root;
+        
+        while (current != nullptr && current->key != key) {
+            if (key < current->key) {
+                TRACE_STEP("键值 " << key << " 小于当前节点 " << current->key << "，向左子树搜索" << std::endl);
+                current = current->left;
+            } else {
+                TRACE_STEP("键值 " << key << " 大于等于当前节点 " << current->key << "，向右子树搜索" << std::endl);
+                current = current->right;
+            }
+        }
+        
+        if (current) {
+            TRACE_STEP("找到键值 " << key << "，位于节点 " << current->key << std::endl);
+        } else {
+            TRACE_STEP("未找到键值 " << key << std::endl);
+        }
+        
+        return current;
+    }
+    
+    /**
+     * 递归版本的搜索操作
+     * @param node 搜索起始节点
+     * @param key 要搜索的键值
+     * @return 找到的节点指针，未找到返回nullptr
+     */
+    TreeNode* searchRecursive(TreeNode* node, int key) const {
+        if (node == nullptr || node->key == key) {
+            if (node) {
+                TRACE_STEP("递归搜索找到键值 " << key << "，位于节点 " << node->key << std::endl);
+            } else {
+                TRACE_STEP("递归搜索未找到键值 " << key << std::endl);
+            }
+            return node;
+        }
+        
+        if (key < node->key) {
+            TRACE_STEP("递归搜索: 键值 " << key << " 小于当前节点 " << node->key << "，向左子树搜索" << std::endl);
+            return searchRecursive(node->left, key);
+        } else {
+            TRACE_STEP("递归搜索: 键值 " << key << " 大于等于当前节点 " << node->key << "，向右子树搜索" << std::endl);
+            return searchRecursive(node->right, key);
+        }
+    }
+    
+    /**
+     * 查找最小关键字元素
+     * @param node 搜索起始节点
+     * @return 最小关键字节点指针
+     */
+    TreeNode* minimum(TreeNode* node) const {
+        if (node == nullptr) {
+            TRACE_STEP("树为空，无法查找最小元素" << std::endl);
+            return nullptr;
+        }
+        
+        TRACE_STEP("查找最小关键字元素，从节点 " << node->key << " 开始" << std::endl);
+        while (node->left != nullptr) {
+            TRACE_STEP("向左子树移动到节点 " << node->left->key << std::endl);
+            node = node->left;
+        }
+        
+        TRACE_STEP("找到最小关键字元素: " << node->key << std::endl);
+        return node;
+    }
+    
+    /**
+     * 查找最大关键字元素
+     * @param node 搜索起始节点
+     * @return 最大关键字节点指针
+     */
+    TreeNode* maximum(TreeNode* node) const {
+        if (node == nullptr) {
+            TRACE_STEP("树为空，无法查找最大元素" << std::endl);
+            return nullptr;
+        }
+        
+        TRACE_STEP("查找最大关键字元素，从节点 " << node->key << " 开始" << std::endl);
+        while (node->right != nullptr) {
+            TRACE_STEP("向右子树移动到节点 " << node->right->key << std::endl);
+            node = node->right;
+        }
+        
+        TRACE_STEP("找到最大关键字元素: " << node->key << std::endl);
+        return node;
+    }
+    
+    /**
+     * 查找节点的后继
+     * @param node 要查找后继的节点
+     * @return 后继节点指针，不存在返回nullptr
+     */
+    TreeNode* successor(TreeNode* node) const {
+        if (node == nullptr) {
+            TRACE_STEP("节点为空，无法查找后继" << std::endl);
+            return nullptr;
+        }
+        
+        TRACE_STEP("查找节点 " << node->key << " 的后继" << std::endl);
+        
+        // 如果右子树不为空，则后继是右子树中的最小节点
+        if (node->right != nullptr) {
+            TRACE_STEP("节点 " << node->key << " 有右子树，后继为其右子树中的最小节点" << std::endl);
+            return minimum(node->right);
+        }
+        
+        // 如果右子树为空，则后继是最低的祖先节点，使得该节点在此祖先节点的左子树中
+        TreeNode* successorNode = node->parent;
+        while (successorNode != nullptr && node == successorNode->right) {
+            TRACE_STEP("节点 " << node->key << " 是其父节点 " << successorNode->key << " 的右子节点，继续向上查找" << std::endl);
+            node = successorNode;
+            successorNode = successorNode->parent;
+        }
+        
+        if (successorNode) {
+            TRACE_STEP("节点 " << node->key << " 的后继是 " << successorNode->key << std::endl);
+        } else {
+            TRACE_STEP("节点 " << node->key << " 没有后继（它是树中的最大节点）" << std::endl);
+        }
+        
+        return successorNode;
+    }
+    
+    /**
+     * 查找节点的前驱
+     * @param node 要查找前驱的节点
+     * @return 前驱节点指针，不存在返回nullptr
+     */
+    TreeNode* predecessor(TreeNode* node) const {
+        if (node == nullptr) {
+            TRACE_STEP("节点为空，无法查找前驱" << std::endl);
+            return nullptr;
+        }
+        
+        TRACE_STEP("查找节点 " << node->key << " 的前驱" << std::endl);
+        
+        // 如果左子树不为空，则前驱是左子树中的最大节点
+        if (node->left != nullptr) {
+            TRACE_STEP("节点 " << node->key << " 有左子树，前驱为其左子树中的最大节点" << std::endl);
+            return maximum(node->left);
+        }
+        
+        // 如果左子树为空，则前驱是最低的祖先节点，使得该节点在此祖先节点的右子树中
+        TreeNode* predecessorNode = node->parent;
+        while (predecessorNode != nullptr && node == predecessorNode->left) {
+            TRACE_STEP("节点 " << node->key << " 是其父节点 " << predecessorNode->key << " 的左子节点，继续向上查找" << std::endl);
+            node = predecessorNode;
+            predecessorNode = predecessorNode->parent;
+        }
+        
+        if (predecessorNode) {
+            TRACE_STEP("节点 " << node->key << " 的前驱是 " << predecessorNode->key << std::endl);
+        } else {
+            TRACE_STEP("节点 " << node->key << " 没有前驱（它是树中的最小节点）" << std::endl);
+        }
+        
+        return predecessorNode;
+    }
+    
+    /**
+     * 在二叉搜索树中插入节点
+     * @param key 要插入的键值
+     */
+    void insert(int key) {
+        TRACE_STEP("\n插入键值: " << key << std::endl);
+        
+        TreeNode* newNode = createNode(key);
+        TreeNode* parentNode = nullptr;
+        TreeNode* currentNode = root;
+        
+        // 查找插入位置
+        while (currentNode != nullptr) {
+            parentNode = currentNode;
+            if (key < currentNode->key) {
+                TRACE_STEP("键值 " << key << " 小于当前节点 " << currentNode->key << "，向左子树移动" << std::endl);
+                currentNode = currentNode->left;
+            } else {
+                TRACE_STEP("键值 " << key << " 大于等于当前节点 " << currentNode->key << "，向右子树移动" << std::endl);
+                currentNode = currentNode->right;
+            }
+        }
+        
+        // 设置新节点的父节点
+        newNode->parent = parentNode;
+        
+        // 如果树为空，则新节点成为根节点
+        if (parentNode == nullptr) {
+            setRoot(newNode);
+        }
+        // 否则将新节点作为父节点的左子节点或右子节点
+        else if (key < parentNode->key) {
+            TRACE_STEP("将新节点 " << key << " 作为父节点 " << parentNode->key << " 的左子节点" << std::endl);
+            parentNode->left = newNode;
+        } else {
+            TRACE_STEP("将新节点 " << key << " 作为父节点 " << parentNode->key << " 的右子节点" << std::endl);
+            parentNode->right = newNode;
+        }
+        
+        TRACE_STEP("成功插入节点 " << key << std::endl);
+    }
+    
+    /**
+     * 删除二叉搜索树中的节点
+     * @param node 要删除的节点
+     */
+    void remove(TreeNode* node) {
+        if (node == nullptr) {
+            TRACE_STEP("节点为空，无法删除" << std::endl);
+            return;
+        }
+        
+        TRACE_STEP("\n删除节点: " << node->key << std::endl);
+        
+        // 情况1：节点没有左子节点
+        if (node->left == nullptr) {
+            TRACE_STEP("节点 " << node->key << " 没有左子节点，用其右子树替换它" << std::endl);
+            transplant(node, node->right);
+        }
+        // 情况2：节点没有右子节点但有左子节点
+        else if (node->right == nullptr) {
+            TRACE_STEP("节点 " << node->key << " 没有右子节点，用其左子树替换它" << std::endl);
+            transplant(node, node->left);
+        }
+        // 情况3：节点既有左子节点又有右子节点
+        else {
+            TRACE_STEP("节点 " << node->key << " 既有左子节点又有右子节点" << std::endl);
+            TreeNode* successorNode = minimum(node->right);  // 找到后继节点
+            TRACE_STEP("节点 " << node->key << " 的后继是 " << successorNode->key << std::endl);
+            
+            // 如果后继节点不是要删除节点的直接子节点
+            if (successorNode->parent != node) {
+                TRACE_STEP("后继节点 " << successorNode->key << " 不是要删除节点 " << node->key << " 的直接子节点" << std::endl);
+                transplant(successorNode, successorNode->right);
+                successorNode->right = node->right;
+                successorNode->right->parent = successorNode;
+            }
+            
+            transplant(node, successorNode);
+            successorNode->left = node->left;
+            successorNode->left->parent = successorNode;
+        }
+        
+        TRACE_STEP("成功删除节点 " << node->key << std::endl);
+        delete node;
+    }
+    
+    /**
+     * 用另一棵子树替换一棵子树
+     * @param u 被替换的子树的根节点
+     * @param v 替换的子树的根节点
+     */
+    void transplant(TreeNode* u, TreeNode* v) {
+        TRACE_STEP("用节点 " << (v ? std::to_string(v->key) : "nullptr")
+                   << " 替换节点 " << (u ? std::to_string(u->key) : "nullptr") << std::endl);
+        
+        if (u->parent == nullptr) {
+            setRoot(v);
+        } else if (u == u->parent->left) {
+            u->parent->left = v;
+        } else {
+            u->parent->right = v;
+        }
+        
+        if (v != nullptr) {
+            v->parent = u->parent;
+        }
+    }
+    
+    /**
+     * 中序遍历（左-根-右）
+     * @param node 遍历的起始节点
+     * @param visit 对每个节点调用的访问函数
+     */
+    template<typename Visitor>
+    void inorderTraversal(TreeNode* node, Visitor&& visit) const {
+        if (node) {
+            TRACE_STEP("进入节点 " << node->key << " 的左子树" << std::endl);
+            inorderTraversal(node->left, visit);
+            visit(node);
+            TRACE_STEP("进入节点 " << node->key << " 的右子树" << std::endl);
+            inorderTraversal(node->right, visit);
+        }
+    }
+    
+    /**
+     * 前序遍历（根-左-右）
+     * @param node 遍历的起始节点
+     * @param visit 对每个节点调用的访问函数
+     */
+    template<typename Visitor>
+    void preorderTraversal(TreeNode* node, Visitor&& visit) const {
+        if (node) {
+            visit(node);
+            TRACE_STEP("进入节点 " << node->key << " 的左子树" << std::endl);
+            preorderTraversal(node->left, visit);
+            TRACE_STEP("进入节点 " << node->key << " 的右子树" << std::endl);
+            preorderTraversal(node->right, visit);
+        }
+    }
+    
+    /**
+     * 后序遍历（左-右-根）
+     * @param node 遍历的起始节点
+     * @param visit 对每个节点调用的访问函数
+     */
+    template<typename Visitor>
+    void postorderTraversal(TreeNode* node, Visitor&& visit) const {
+        if (node) {
+            TRACE_STEP("进入节点 " << node->key << " 的左子树" << std::endl);
+            postorderTraversal(node->left, visit);
+            TRACE_STEP("进入节点 " << node->key << " 的右子树" << std::endl);
+            postorderTraversal(node->right, visit);
+            visit(node);
+        }
+    }
+    
+    /**
+     * 层序遍历（广度优先遍历）
+     * @param visit 对每个节点调用的访问函数
+     */
+    template<typename Visitor>
+    void levelOrderTraversal(Visitor&& visit) const {
+        if (!root) {
+            return;
+        }
+        
+        std::queue<TreeNode*> q;
+        q.push(root);
+        TRACE_STEP("将根节点 " << root->key << " 加入队列" << std::endl);
+        
+        while (!q.empty()) {
+            TreeNode* current = q.front();
+            q.pop();
+            visit(current);
+            
+            // 将左右子节点加入队列
+            if (current->left) {
+                TRACE_STEP("将节点 " << current->key << " 的左子节点 " << current->left->key << " 加入队列" << std::endl);
+                q.push(current->left);
+            }
+            if (current->right) {
+                TRACE_STEP("将节点 " << current->key << " 的右子节点 " << current->right->key << " 加入队列" << std::endl);
+                q.push(current->right);
+            }
+        }
+    }
+};
+
+#endif //CLRS_C3_U12_BINARY_SEARCH_TREE_H
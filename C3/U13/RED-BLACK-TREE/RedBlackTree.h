@@ -0,0 +1,327 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#ifndef CLRS_C3_U13_RED_BLACK_TREE_H
+#define CLRS_C3_U13_RED_BLACK_TREE_H
+
+#include <string>
+#include <utility>
+
+#include "common/Trace.h"
+
+// 红黑树节点颜色枚举
+enum Color { RED, BLACK };
+
+// 红黑树节点结构
+struct Node {
+    int data;
+    Color color;
+    Node *left, *right, *parent;
+    
+    // 初始化节点
+    Node(int data) {
+        this->data = data;
+        left = right = parent = nullptr;
+        this->color = RED; // 新节点默认为红色
+    }
+};
+
+// 红黑树类
+class RedBlackTree {
+private:
+    Node *root;
+    
+    // 输出节点信息的追踪辅助函数
+    void printNodeInfo(Node *node, [[maybe_unused]] const std::string &description) {
+        if (node == nullptr) {
+            TRACE_STEP("  " << description << ": nullptr" << std::endl);
+            return;
+        }
+        
+        TRACE_STEP("  " << description << ": " << node->data 
+             << " (" << (node->color == RED ? "R" : "B") << ")");
+        if (node->parent) {
+            TRACE_STEP(", Parent: " << node->parent->data);
+        } else {
+            TRACE_STEP(", Parent: nullptr");
+        }
+        TRACE_STEP(std::endl);
+    }
+    
+    // 左旋操作
+    void rotateLeft(Node *&node) {
+        TRACE_STEP("  Left rotate at node " << node->data << std::endl);
+        TRACE_COUNT("redBlackTree.rotations");
+        
+        Node *rightChild = node->right;
+        node->right = rightChild->left;
+        
+        if (node->right != nullptr)
+            node->right->parent = node;
+            
+        rightChild->parent = node->parent;
+        
+        if (node->parent == nullptr)
+            root = rightChild;
+        else if (node == node->parent->left)
+            node->parent->left = rightChild;
+        else
+            node->parent->right = rightChild;
+            
+        rightChild->left = node;
+        node->parent = rightChild;
+    }
+    
+    // 右旋操作
+    void rotateRight(Node *&node) {
+        TRACE_STEP("  Right rotate at node " << node->data << std::endl);
+        TRACE_COUNT("redBlackTree.rotations");
+        
+        Node *leftChild = node->left;
+        node->left = leftChild->right;
+        
+        if (node->left != nullptr)
+            node->left->parent = node;
+            
+        leftChild->parent = node->parent;
+        
+        if (node->parent == nullptr)
+            root = leftChild;
+        else if (node == node->parent->left)
+            node->parent->left = leftChild;
+        else
+            node->parent->right = leftChild;
+            
+        leftChild->right = node;
+        node->parent = leftChild;
+    }
+    
+    // 修复插入后违反的红黑树性质
+    void fixInsertViolation(Node *&node) {
+        TRACE_STEP("\n开始修复红黑树性质，当前节点: " << node->data << std::endl);
+        
+        Node *parent = nullptr;
+        Node *grandparent = nullptr;
+        
+        while ((node != root) && (node->color != BLACK) && 
+               (node->parent->color == RED)) {
+            
+            parent = node->parent;
+            grandparent = parent->parent;
+            
+            TRACE_STEP_EXEC(printNodeInfo(parent, "Parent"));
+            TRACE_STEP_EXEC(printNodeInfo(grandparent, "Grandparent"));
+            
+            /*  Case : 当父节点是祖父节点的左孩子 */
+            if (parent == grandparent->left) {
+                Node *uncle = grandparent->right;
+                TRACE_STEP_EXEC(printNodeInfo(uncle, "Uncle"));
+                
+                /* Case 1: 叔叔节点是红色，只需要重新着色 */
+                if (uncle != nullptr && uncle->color == RED) {
+                    TRACE_STEP("  情况1: 叔叔节点是红色，重新着色" << std::endl);
+                    grandparent->color = RED;
+                    parent->color = BLACK;
+                    uncle->color = BLACK;
+                    node = grandparent;
+                }
+                
+                else {
+                    /* Case 2: node是父节点的右孩子，需要左旋 */
+                    if (node == parent->right) {
+                        TRACE_STEP("  情况2: 当前节点是父节点的右孩子，对父节点左旋" << std::endl);
+                        rotateLeft(parent);
+                        node = parent;
+                        parent = node->parent;
+                    }
+                    
+                    /* Case 3: node是父节点的左孩子，需要右旋 */
+                    TRACE_STEP("  情况3: 对祖父节点右旋" << std::endl);
+                    rotateRight(grandparent);
+                    std::swap(parent->color, grandparent->color);
+                    node = parent;
+                }
+            }
+            
+            /* Case : 当父节点是祖父节点的右孩子 */
+            else {
+                Node *uncle = grandparent->left;
+                TRACE_STEP_EXEC(printNodeInfo(uncle, "Uncle"));
+                
+                /* Case 1: 叔叔节点是红色，只需要重新着色 */
+                if ((uncle != nullptr) && (uncle->color == RED)) {
+                    TRACE_STEP("  情况1: 叔叔节点是红色，重新着色" << std::endl);
+                    grandparent->color = RED;
+                    parent->color = BLACK;
+                    uncle->color = BLACK;
+                    node = grandparent;
+                }
+                
+                else {
+                    /* Case 2: node是父节点的左孩子，需要右旋 */
+                    if (node == parent->left) {
+                        TRACE_STEP("  情况2: 当前节点是父节点的左孩子，对父节点右旋" << std::endl);
+                        rotateRight(parent);
+                        node = parent;
+                        parent = node->parent;
+                    }
+                    
+                    /* Case 3: node是父节点的右孩子，需要左旋 */
+                    TRACE_STEP("  情况3: 对祖父节点左旋" << std::endl);
+                    rotateLeft(grandparent);
+                    std::swap(parent->color, grandparent->color);
+                    node = parent;
+                }
+            }
+            
+            TRACE_STEP("  完成本轮修复\n" << std::endl);
+        }
+        
+        TRACE_STEP("设置根节点为黑色" << std::endl);
+        root->color = BLACK;
+        TRACE_COUNT("redBlackTree.inserts");
+        TRACE_STEP("红黑树性质修复完成\n" << std::endl);
+    }
+    
+public:
+    // 构造函数
+    RedBlackTree() { 
+        root = nullptr; 
+    }
+
+    // 析构函数，释放所有节点
+    ~RedBlackTree() {
+        destroyTree(root);
+    }
+
+    // 后序遍历释放以node为根的子树
+    void destroyTree(Node *node) {
+        if (node == nullptr) return;
+        destroyTree(node->left);
+        destroyTree(node->right);
+        delete node;
+    }
+    
+    // 插入新节点
+    void insert(const int &data) {
+        TRACE_SUMMARY("----------------------------------------" << std::endl);
+        TRACE_SUMMARY("插入节点: " << data << std::endl);
+        TRACE_SUMMARY("----------------------------------------" << std::endl);
+        
+        Node *node = new Node(data);
+        
+        // 执行正常的BST插入
+        root = bstInsert(root, node);
+        
+        // 关键字已存在时节点已被释放，树没有变化
+        if (node == nullptr)
+            return;
+        
+        // 修复可能违反的红黑树性质
+        fixInsertViolation(node);
+        
+        TRACE_STEP("最终树结构:" << std::endl);
+        TRACE_STEP_EXEC(printTree(std::cout));
+        TRACE_STEP("\n" << std::endl);
+    }
+    
+    // BST插入的辅助函数，关键字已存在时释放node并将其置为nullptr
+    Node* bstInsert(Node *root, Node *&node) {
+        TRACE_STEP("BST插入过程:" << std::endl);
+        
+        // 如果树为空，返回新节点
+        if (root == nullptr) {
+            TRACE_STEP("  树为空，直接插入根节点" << std::endl);
+            return node;
+        }
+            
+        // 否则递归向下查找位置
+        if (node->data < root->data) {
+            TRACE_STEP("  节点 " << node->data << " 小于 " << root->data << "，向左子树插入" << std::endl);
+            root->left = bstInsert(root->left, node);
+            root->left->parent = root;
+        }
+        else if (node->data > root->data) {
+            TRACE_STEP("  节点 " << node->data << " 大于 " << root->data << "，向右子树插入" << std::endl);
+            root->right = bstInsert(root->right, node);
+            root->right->parent = root;
+        }
+        else {
+            TRACE_STEP("  节点 " << node->data << " 已存在，不插入重复节点" << std::endl);
+            // 释放已分配的内存
+            delete node;
+            node = nullptr;
+            return root;
+        }
+        
+        return root;
+    }
+    
+    // 获取根节点
+    Node* getRoot() const {
+        return root;
+    }
+    
+    // 打印树结构（使用标准的树形结构展示）
+    // 输出流以模板参数传入，头文件本身不依赖 <iostream>
+    template<typename OStream>
+    void printTree(OStream &os) const {
+        if (root == nullptr) {
+            os << "空树" << "\n";
+            return;
+        }
+
+        printTreeHelper(os, root, "", true);
+    }
+
+    // 树结构打印辅助函数
+    template<typename OStream>
+    void printTreeHelper(OStream &os, Node *node, std::string indent, bool last) const {
+        if (node != nullptr) {
+            os << indent;
+            if (last) {
+                os << "+-";
+                indent += "  ";
+            } else {
+                os << "|-";
+                indent += "| ";
+            }
+
+            os << node->data << "(" << (node->color == RED ? "R" : "B") << ")" << "\n";
+
+            if (node->left != nullptr || node->right != nullptr) {
+                if (node->left)
+                    printTreeHelper(os, node->left, indent, node->right == nullptr);
+                else if (node->right)
+                    os << indent << "+-nullptr" << "\n";
+
+                if (node->right)
+                    printTreeHelper(os, node->right, indent, true);
+                else if (node->left)
+                    os << indent << "+-nullptr" << "\n";
+            }
+        }
+    }
+    
+    // 搜索节点
+    bool search(const int &data) const {
+        return searchHelper(root, data);
+    }
+    
+    // 搜索辅助函数
+    bool searchHelper(Node *node, const int &data) const {
+        if (node == nullptr)
+            return false;
+            
+        if (node->data == data)
+            return true;
+            
+        if (data < node->data)
+            return searchHelper(node->left, data);
+        else
+            return searchHelper(node->right, data);
+    }
+};
+
+#endif //CLRS_C3_U13_RED_BLACK_TREE_H
@@ -1,6 +1,8 @@
 #include <iostream>
 #include <queue>
 #include <vector>
+
+#include "common/Trace.h"
 using namespace std;
 
 // 红黑树节点颜色枚举
@@ -34,12 +36,12 @@ private:
         int leftSize = (node->left != nullptr) ? node->left->size : 0;
         int rightSize = (node->right != nullptr) ? node->right->size : 0;
         node->size = 1 + leftSize + rightSize;
-        cout << "    更新节点 " << node->data << " 的size为 " << node->size << endl;
+        TRACE_STEP("    更新节点 " << node->data << " 的size为 " << node->size << endl);
     }
     
     // 左旋操作
     void rotateLeft(Node *&node) {
-        cout << "  执行左旋操作，以节点 " << node->data << " 为中心" << endl;
+        TRACE_STEP("  执行左旋操作，以节点 " << node->data << " 为中心" << endl);
         
         Node *rightChild = node->right;
         node->right = rightChild->left;
@@ -63,12 +65,12 @@ private:
         updateSize(node);
         updateSize(rightChild);
         
-        cout << "  左旋完成" << endl;
+        TRACE_STEP("  左旋完成" << endl);
     }
     
     // 右旋操作
     void rotateRight(Node *&node) {
-        cout << "  执行右旋操作，以节点 " << node->data << " 为中心" << endl;
+        TRACE_STEP("  执行右旋操作，以节点 " << node->data << " 为中心" << endl);
         
         Node *leftChild = node->left;
         node->left = leftChild->right;
@@ -92,12 +94,12 @@ private:
         updateSize(node);
         updateSize(leftChild);
         
-        cout << "  右旋完成" << endl;
+        TRACE_STEP("  右旋完成" << endl);
     }
     
     // 修复插入后违反的红黑树性质
     void fixInsertViolation(Node *&node) {
-        cout << "\n开始修复红黑树性质，当前节点: " << node->data << endl;
+        TRACE_STEP("\n开始修复红黑树性质，当前节点: " << node->data << endl);
         
         Node *parent = nullptr;
         Node *grandparent = nullptr;
@@ -108,50 +110,45 @@ private:
             parent = node->parent;
             grandparent = parent->parent;
             
-            cout << "  当前节点: " << node->data << "(" << (node->color == RED ? "R" : "B") << ")" << endl;
-            cout << "  父节点: " << parent->data << "(" << (parent->color == RED ? "R" : "B") << ")" << endl;
-            cout << "  祖父节点: " << grandparent->data << "(" << (grandparent->color == RED ? "R" : "B") << ")" << endl;
+            TRACE_STEP("  当前节点: " << node->data << "(" << (node->color == RED ? "R" : "B") << ")" << endl);
+            TRACE_STEP("  父节点: " << parent->data << "(" << (parent->color == RED ? "R" : "B") << ")" << endl);
+            TRACE_STEP("  祖父节点: " << grandparent->data << "(" << (grandparent->color == RED ? "R" : "B") << ")" << endl);
             
             /*  Case : 当父节点是祖父节点的左孩子 */
             if (parent == grandparent->left) {
                 Node *uncle = grandparent->right;
                 
-                cout << "  叔叔节点: ";
-                if (uncle != nullptr) {
-                    cout << uncle->data << "(" << (uncle->color == RED ? "R" : "B") << ")" << endl;
-                } else {
-                    cout << "nullptr" << endl;
-                }
+                TRACE_STEP("  叔叔节点: " << (uncle != nullptr ? to_string(uncle->data) + (uncle->color == RED ? "(R)" : "(B)") : "nullptr") << endl);
                 
                 /* Case 1: 叔叔节点是红色，只需要重新着色 */
                 if (uncle != nullptr && uncle->color == RED) {
-                    cout << "  情况1: 叔叔节点是红色，执行重新着色" << endl;
+                    TRACE_STEP("  情况1: 叔叔节点是红色，执行重新着色" << endl);
                     grandparent->color = RED;
                     parent->color = BLACK;
                     uncle->color = BLACK;
-                    cout << "    祖父节点 " << grandparent->data << " 设为红色" << endl;
-                    cout << "    父节点 " << parent->data << " 设为黑色" << endl;
-                    cout << "    叔叔节点 " << uncle->data << " 设为黑色" << endl;
+                    TRACE_STEP("    祖父节点 " << grandparent->data << " 设为红色" << endl);
+                    TRACE_STEP("    父节点 " << parent->data << " 设为黑色" << endl);
+                    TRACE_STEP("    叔叔节点 " << uncle->data << " 设为黑色" << endl);
                     node = grandparent;
                 }
                 
                 else {
                     /* Case 2: node是父节点的右孩子，需要左旋 */
                     if (node == parent->right) {
-                        cout << "  情况2: 当前节点是父节点的右孩子，先对父节点执行左旋" << endl;
+                        TRACE_STEP("  情况2: 当前节点是父节点的右孩子，先对父节点执行左旋" << endl);
                         rotateLeft(parent);
                         node = parent;
                         parent = node->parent;
-                        cout << "    旋转后的新节点: " << node->data << endl;
+                        TRACE_STEP("    旋转后的新节点: " << node->data << endl);
                         if (parent) {
-                            cout << "    旋转后的新父节点: " << parent->data << endl;
+                            TRACE_STEP("    旋转后的新父节点: " << parent->data << endl);
                         }
                     }
                     
                     /* Case 3: node是父节点的左孩子，需要右旋 */
-                    cout << "  情况3: 对祖父节点执行右旋" << endl;
+                    TRACE_STEP("  情况3: 对祖父节点执行右旋" << endl);
                     rotateRight(grandparent);
-                    cout << "  交换父节点和祖父节点的颜色" << endl;
+                    TRACE_STEP("  交换父节点和祖父节点的颜色" << endl);
                     swap(parent->color, grandparent->color);
                     node = parent;
                 }
@@ -161,59 +158,54 @@ private:
             else {
                 Node *uncle = grandparent->left;
                 
-                cout << "  叔叔节点: ";
-                if (uncle != nullptr) {
-                    cout << uncle->data << "(" << (uncle->color == RED ? "R" : "B") << ")" << endl;
-                } else {
-                    cout << "nullptr" << endl;
-                }
+                TRACE_STEP("  叔叔节点: " << (uncle != nullptr ? to_string(uncle->data) + (uncle->color == RED ? "(R)" : "(B)") : "nullptr") << endl);
                 
                 /* Case 1: 叔叔节点是红色，只需要重新着色 */
                 if ((uncle != nullptr) && (uncle->color == RED)) {
-                    cout << "  情况1: 叔叔节点是红色，执行重新着色" << endl;
+                    TRACE_STEP("  情况1: 叔叔节点是红色，执行重新着色" << endl);
                     grandparent->color = RED;
                     parent->color = BLACK;
                     uncle->color = BLACK;
-                    cout << "    祖父节点 " << grandparent->data << " 设为红色" << endl;
-                    cout << "    父节点 " << parent->data << " 设为黑色" << endl;
-                    cout << "    叔叔节点 " << uncle->data << " 设为黑色" << endl;
+                    TRACE_STEP("    祖父节点 " << grandparent->data << " 设为红色" << endl);
+                    TRACE_STEP("    父节点 " << parent->data << " 设为黑色" << endl);
+                    TRACE_STEP("    叔叔节点 " << uncle->data << " 设为黑色" << endl);
                     node = grandparent;
                 }
                 
                 else {
                     /* Case 2: node是父节点的左孩子，需要右旋 */
                     if (node == parent->left) {
-                        cout << "  情况2: 当前节点是父节点的左孩子，先对父节点执行右旋" << endl;
+                        TRACE_STEP("  情况2: 当前节点是父节点的左孩子，先对父节点执行右旋" << endl);
                         rotateRight(parent);
                         node = parent;
                         parent = node->parent;
-                        cout << "    旋转后的新节点: " << node->data << endl;
+                        TRACE_STEP("    旋转后的新节点: " << node->data << endl);
                         if (parent) {
-                            cout << "    旋转后的新父节点: " << parent->data << endl;
+                            TRACE_STEP("    旋转后的新父节点: " << parent->data << endl);
                         }
                     }
                     
                     /* Case 3: node是父节点的右孩子，需要左旋 */
-                    cout << "  情况3: 对祖父节点执行左旋" << endl;
+                    TRACE_STEP("  情况3: 对祖父节点执行左旋" << endl);
                     rotateLeft(grandparent);
-                    cout << "  交换父节点和祖父节点的颜色" << endl;
+                    TRACE_STEP("  交换父节点和祖父节点的颜色" << endl);
                     swap(parent->color, grandparent->color);
                     node = parent;
                 }
             }
             
-            cout << "  完成本轮修复，进入下一轮检查\n" << endl;
+            TRACE_STEP("  完成本轮修复，进入下一轮检查\n" << endl);
         }
         
-        cout << "将根节点设置为黑色" << endl;
+        TRACE_STEP("将根节点设置为黑色" << endl);
         root->color = BLACK;
-        cout << "红黑树性质修复完成\n" << endl;
+        TRACE_STEP("红黑树性质修复完成\n" << endl);
     }
     
     // 递归更新从指定节点到根节点路径上所有节点的size
     void updateSizeToRoot(Node *node) {
         if (node == nullptr) return;
-        cout << "  更新从节点 " << node->data << " 到根节点路径上的size值" << endl;
+        TRACE_STEP("  更新从节点 " << node->data << " 到根节点路径上的size值" << endl);
         updateSize(node);
         updateSizeToRoot(node->parent);
     }
@@ -263,53 +255,58 @@ public:
     
     // 插入新节点
     void insert(const int &data) {
-        cout << "========================================" << endl;
-        cout << "插入节点: " << data << endl;
-        cout << "========================================" << endl;
+        TRACE_SUMMARY("========================================" << endl);
+        TRACE_SUMMARY("插入节点: " << data << endl);
+        TRACE_SUMMARY("========================================" << endl);
         
         Node *node = new Node(data);
-        cout << "创建新节点 " << data << "，颜色为红色，初始size为1" << endl;
+        TRACE_STEP("创建新节点 " << data << "，颜色为红色，初始size为1" << endl);
         
         // 执行正常的BST插入
-        cout << "执行BST插入过程:" << endl;
+        TRACE_STEP("执行BST插入过程:" << endl);
         root = bstInsert(root, node);
         
+        // 关键字已存在时节点已被释放，树没有变化
+        if (node == nullptr)
+            return;
+        
         // 更新从插入节点到根节点路径上所有节点的size
-        cout << "更新节点size:" << endl;
+        TRACE_STEP("更新节点size:" << endl);
         updateSizeToRoot(node);
         
         // 修复可能违反的红黑树性质
-        cout << "修复红黑树性质:" << endl;
+        TRACE_STEP("修复红黑树性质:" << endl);
         fixInsertViolation(node);
         
-        cout << "最终树结构:" << endl;
-        printTree();
-        cout << "\n" << endl;
+        TRACE_STEP("最终树结构:" << endl);
+        TRACE_STEP_EXEC(printTree());
+        TRACE_STEP("\n" << endl);
     }
     
-    // BST插入的辅助函数
-    Node* bstInsert(Node *root, Node *node) {
+    // BST插入的辅助函数，关键字已存在时释放node并将其置为nullptr
+    Node* bstInsert(Node *root, Node *&node) {
         // 如果树为空，返回新节点
         if (root == nullptr) {
-            cout << "  树为空，直接插入根节点" << endl;
+            TRACE_STEP("  树为空，直接插入根节点" << endl);
             return node;
         }
             
         // 否则递归向下查找位置
         if (node->data < root->data) {
-            cout << "  节点 " << node->data << " 小于 " << root->data << "，向左子树插入" << endl;
+            TRACE_STEP("  节点 " << node->data << " 小于 " << root->data << "，向左子树插入" << endl);
             root->left = bstInsert(root->left, node);
             root->left->parent = root;
         }
         else if (node->data > root->data) {
-            cout << "  节点 " << node->data << " 大于 " << root->data << "，向右子树插入" << endl;
+            TRACE_STEP("  节点 " << node->data << " 大于 " << root->data << "，向右子树插入" << endl);
             root->right = bstInsert(root->right, node);
             root->right->parent = root;
         }
         else {
-            cout << "  节点 " << node->data << " 已存在，不插入重复节点" << endl;
+            TRACE_STEP("  节点 " << node->data << " 已存在，不插入重复节点" << endl);
             // 释放已分配的内存
             delete node;
+            node = nullptr;
             return root;
         }
         
@@ -395,13 +392,13 @@ public:
     
     // 查找第k小的元素（顺序统计）
     int select(int k) {
-        cout << "查找第 " << k << " 小的元素:" << endl;
+        TRACE_SUMMARY("查找第 " << k << " 小的元素:" << endl);
         if (root == nullptr || k <= 0 || k > root->size) {
-            cout << "  无效的秩 k=" << k << "，树的总大小为 " << (root ? root->size : 0) << endl;
+            TRACE_STEP("  无效的秩 k=" << k << "，树的总大小为 " << (root ? root->size : 0) << endl);
             throw invalid_argument("Invalid rank k");
         }
         int result = selectHelper(root, k);
-        cout << "  第 " << k << " 小的元素是: " << result << endl;
+        TRACE_SUMMARY("  第 " << k << " 小的元素是: " << result << endl);
         return result;
     }
     
@@ -412,48 +409,48 @@ public:
         }
         
         int leftSize = (node->left != nullptr) ? node->left->size : 0;
-        cout << "  当前节点: " << node->data << ", 左子树大小: " << leftSize << ", 查找第 " << k << " 小" << endl;
+        TRACE_STEP("  当前节点: " << node->data << ", 左子树大小: " << leftSize << ", 查找第 " << k << " 小" << endl);
         
         if (k == leftSize + 1) {
-            cout << "  找到目标节点: " << node->data << endl;
+            TRACE_STEP("  找到目标节点: " << node->data << endl);
             return node->data;
         } else if (k <= leftSize) {
-            cout << "  目标在左子树中" << endl;
+            TRACE_STEP("  目标在左子树中" << endl);
             return selectHelper(node->left, k);
         } else {
-            cout << "  目标在右子树中" << endl;
+            TRACE_STEP("  目标在右子树中" << endl);
             return selectHelper(node->right, k - leftSize - 1);
         }
     }
     
     // 确定元素的秩（元素在排序顺序中的位置）
     int rank(int data) {
-        cout << "计算元素 " << data << " 的秩:" << endl;
+        TRACE_SUMMARY("计算元素 " << data << " 的秩:" << endl);
         int result = rankHelper(root, data);
-        cout << "  元素 " << data << " 的秩为: " << result << endl;
+        TRACE_SUMMARY("  元素 " << data << " 的秩为: " << result << endl);
         return result;
     }
     
     // 确定元素秩的辅助函数
     int rankHelper(Node *node, int data) {
         if (node == nullptr) {
-            cout << "  到达空节点，返回0" << endl;
+            TRACE_STEP("  到达空节点，返回0" << endl);
             return 0;
         }
         
-        cout << "  当前节点: " << node->data << ", size=" << node->size << endl;
+        TRACE_STEP("  当前节点: " << node->data << ", size=" << node->size << endl);
         
         if (data < node->data) {
-            cout << "  目标值 " << data << " 小于当前节点 " << node->data << "，在左子树中查找" << endl;
+            TRACE_STEP("  目标值 " << data << " 小于当前节点 " << node->data << "，在左子树中查找" << endl);
             return rankHelper(node->left, data);
         } else if (data > node->data) {
             int leftSize = (node->left != nullptr) ? node->left->size : 0;
-            cout << "  目标值 " << data << " 大于当前节点 " << node->data << "，在右子树中查找" << endl;
-            cout << "  左子树大小: " << leftSize << "，返回 1+" << leftSize << "+右子树中的秩" << endl;
+            TRACE_STEP("  目标值 " << data << " 大于当前节点 " << node->data << "，在右子树中查找" << endl);
+            TRACE_STEP("  左子树大小: " << leftSize << "，返回 1+" << leftSize << "+右子树中的秩" << endl);
             return 1 + leftSize + rankHelper(node->right, data);
         } else {
             int leftSize = (node->left != nullptr) ? node->left->size : 0;
-            cout << "  找到目标节点 " << data << "，其秩为 1+" << leftSize << "=" << (1 + leftSize) << endl;
+            TRACE_STEP("  找到目标节点 " << data << "，其秩为 1+" << leftSize << "=" << (1 + leftSize) << endl);
             return 1 + leftSize;
         }
     }
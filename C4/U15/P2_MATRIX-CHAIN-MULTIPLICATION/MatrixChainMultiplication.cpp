@@ -3,76 +3,9 @@
 #include <climits>
 #include <iomanip>
 
-using namespace std;
+#include "MatrixChainMultiplication.h"
 
-/**
- * 矩阵链乘法问题 - 计算最小标量乘法次数
- * 
- * 这个函数使用动态规划来解决矩阵链乘法问题。
- * 
- * 基本思路：
- * 1. 对于n个矩阵的链，我们需要决定在哪里放置括号以最小化标量乘法次数
- * 2. 我们用m[i][j]表示计算矩阵Ai到Aj的最小标量乘法次数
- * 3. 对于每个可能的分割点k，我们将链分成两部分：Ai..Ak 和 Ak+1..Aj
- * 4. 总成本 = 左半部分成本 + 右半部分成本 + 合并两部分的成本
- * 5. 合并成本是dimensions[i] * dimensions[k+1] * dimensions[j+1]
- * 
- * 参数:
- * - dimensions: 矩阵维度数组，长度为n+1
- *   如果有n个矩阵，dimensions[i-1]和dimensions[i]分别是第i个矩阵的行数和列数
- * - splitPoints: 用于记录最优分割点的二维数组
- * 
- * 返回值:
- * - 计算整个矩阵链A1到An的最小标量乘法次数
- */
-int matrixChainOrder(const vector<int>& dimensions, vector<vector<int>>& splitPoints) {
-    int n = dimensions.size() - 1; // 矩阵数量
-    
-    // 创建DP表，m[i][j]表示计算矩阵Ai...Aj所需的最小标量乘法次数
-    // 初始时所有值为0，因为单个矩阵(即i==j时)不需要任何乘法运算
-    vector<vector<int>> m(n, vector<int>(n, 0));
-    
-    cout << "开始填充DP表..." << endl;
-    cout << "链长度从2开始，逐步增加到" << n << endl;
-    
-    // L是链的长度，从2开始（单个矩阵不需要计算）
-    for (int L = 2; L <= n; L++) {
-        cout << "\n--- 计算长度为 " << L << " 的矩阵链 ---" << endl;
-        
-        // i是链的起始矩阵索引
-        for (int i = 0; i < n - L + 1; i++) {
-            int j = i + L - 1; // j是链的结束矩阵索引
-            m[i][j] = INT_MAX; // 初始化为无穷大
-            
-            cout << "  计算 m[" << i << "][" << j << "] (矩阵A" << (i+1) << "到A" << (j+1) << ")" << endl;
-            
-            // 尝试所有可能的分割点k
-            for (int k = i; k < j; k++) {
-                // 计算在k处分割的标量乘法次数
-                // 左半部分：Ai到Ak，成本存储在m[i][k]
-                // 右半部分：Ak+1到Aj，成本存储在m[k+1][j]
-                // 合并成本：dimensions[i] * dimensions[k+1] * dimensions[j+1]
-                int cost = m[i][k] + m[k + 1][j] + dimensions[i] * dimensions[k + 1] * dimensions[j + 1];
-                
-                cout << "    在k=" << k << "处分割: 左半部分成本=" << m[i][k] 
-                     << ", 右半部分成本=" << m[k+1][j] << ", 合并成本=" 
-                     << dimensions[i] << "×" << dimensions[k+1] << "×" << dimensions[j+1] 
-                     << "=" << dimensions[i] * dimensions[k+1] * dimensions[j+1]
-                     << ", 总成本=" << cost << endl;
-                
-                if (cost < m[i][j]) {
-                    m[i][j] = cost;
-                    splitPoints[i][j] = k; // 记录最优分割点
-                    cout << "    找到更优解: 最小成本更新为 " << cost << ", 最优分割点k=" << k << endl;
-                }
-            }
-            cout << "  最终结果: m[" << i << "][" << j << "] = " << m[i][j] 
-                 << ", 最优分割点k=" << splitPoints[i][j] << endl;
-        }
-    }
-    
-    return m[0][n - 1];
-}
+using namespace std;
 
 /**
  * 打印最优括号化方案
@@ -4,6 +4,8 @@
 #include <algorithm>
 #include <iomanip>
 
+#include "LongestCommonSubsequence.h"
+
 using namespace std;
 
 /**
@@ -27,86 +29,6 @@ using namespace std;
  * 空间复杂度：O(m*n)
  */
 
-/**
- * 计算最长公共子序列的长度
- * @param X 第一个序列
- * @param Y 第二个序列
- * @param c DP表，用于存储子问题的解
- * @param b 方向表，用于记录决策路径（便于构造LCS序列）
- */
-void lcsLength(const string& X, const string& Y, vector<vector<int>>& c, vector<vector<char>>& b) {
-    int m = X.length();
-    int n = Y.length();
-    
-    // 初始化DP表和方向表
-    c.assign(m + 1, vector<int>(n + 1, 0));
-    b.assign(m + 1, vector<char>(n + 1, '0'));
-    
-    cout << "开始填充DP表..." << endl;
-    cout << "X序列: \"" << X << "\" (长度: " << m << ")" << endl;
-    cout << "Y序列: \"" << Y << "\" (长度: " << n << ")" << endl;
-    
-    // 填充DP表
-    for (int i = 1; i <= m; i++) {
-        for (int j = 1; j <= n; j++) {
-            // 如果两个字符相同
-            if (X[i - 1] == Y[j - 1]) {
-                c[i][j] = c[i - 1][j - 1] + 1;
-                b[i][j] = '\\';  // 表示从左上角转移而来
-                cout << "  字符匹配: X[" << (i-1) << "]='" << X[i-1] 
-                     << "' == Y[" << (j-1) << "]='" << Y[j-1] 
-                     << "', c[" << i << "][" << j << "]=" << c[i][j] << endl;
-            }
-            // 如果两个字符不同，选择较大的值
-            else if (c[i - 1][j] >= c[i][j - 1]) {
-                c[i][j] = c[i - 1][j];
-                b[i][j] = '|';   // 表示从上方转移而来
-                cout << "  字符不匹配: 选择上方 c[" << (i-1) << "][" << j 
-                     << "]=" << c[i-1][j] << " >= 左方 c[" << i << "][" << (j-1) 
-                     << "]=" << c[i][j-1] << ", c[" << i << "][" << j << "]=" << c[i][j] << endl;
-            }
-            else {
-                c[i][j] = c[i][j - 1];
-                b[i][j] = '-';   // 表示从左方转移而来
-                cout << "  字符不匹配: 选择左方 c[" << i << "][" << (j-1) 
-                     << "]=" << c[i][j-1] << " > 上方 c[" << (i-1) << "][" << j 
-                     << "]=" << c[i-1][j] << ", c[" << i << "][" << j << "]=" << c[i][j] << endl;
-            }
-        }
-    }
-}
-
-/**
- * 通过回溯方向表构造LCS序列
- * @param X 第一个序列
- * @param Y 第二个序列
- * @param b 方向表
- * @param i 当前行索引
- * @param j 当前列索引
- * @param lcs 存储构造的LCS序列
- */
-void printLCS(const string& X, const string& Y, const vector<vector<char>>& b, 
-              int i, int j, string& lcs) {
-    // 基本情况：到达边界
-    if (i == 0 || j == 0) {
-        return;
-    }
-    
-    // 如果字符相同，该字符属于LCS
-    if (b[i][j] == '\\') {
-        printLCS(X, Y, b, i - 1, j - 1, lcs);
-        lcs += X[i - 1];
-        cout << "  添加字符 '" << X[i-1] << "' 到LCS序列" << endl;
-    }
-    // 否则根据方向继续回溯
-    else if (b[i][j] == '|') {
-        printLCS(X, Y, b, i - 1, j, lcs);
-    }
-    else {
-        printLCS(X, Y, b, i, j - 1, lcs);
-    }
-}
-
 /**
  * 打印DP表
  * @param c DP表
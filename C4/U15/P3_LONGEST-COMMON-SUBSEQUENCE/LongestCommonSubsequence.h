@@ -0,0 +1,94 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#ifndef CLRS_C4_U15_LONGEST_COMMON_SUBSEQUENCE_H
+#define CLRS_C4_U15_LONGEST_COMMON_SUBSEQUENCE_H
+
+#include <vector>
+#include <string>
+#include <algorithm>
+
+#include "common/Trace.h"
+
+/**
+ * 计算最长公共子序列的长度
+ * @param X 第一个序列
+ * @param Y 第二个序列
+ * @param c DP表，用于存储子问题的解
+ * @param b 方向表，用于记录决策路径（便于构造LCS序列）
+ */
+inline void lcsLength(const std::string& X, const std::string& Y, std::vector<std::vector<int>>& c, std::vector<std::vector<char>>& b) {
+    int m = X.length();
+    int n = Y.length();
+    
+    // 初始化DP表和方向表
+    c.assign(m + 1, std::vector<int>(n + 1, 0));
+    b.assign(m + 1, std::vector<char>(n + 1, '0'));
+    
+    TRACE_SUMMARY("开始填充DP表..." << std::endl);
+    TRACE_SUMMARY("X序列: \"" << X << "\" (长度: " << m << ")" << std::endl);
+    TRACE_SUMMARY("Y序列: \"" << Y << "\" (长度: " << n << ")" << std::endl);
+    
+    // 填充DP表
+    for (int i = 1; i <= m; i++) {
+        for (int j = 1; j <= n; j++) {
+            // 如果两个字符相同
+            if (X[i - 1] == Y[j - 1]) {
+                c[i][j] = c[i - 1][j - 1] + 1;
+                b[i][j] = '\\';  // 表示从左上角转移而来
+                TRACE_STEP("  字符匹配: X[" << (i-1) << "]='" << X[i-1] 
+                     << "' == Y[" << (j-1) << "]='" << Y[j-1] 
+                     << "', c[" << i << "][" << j << "]=" << c[i][j] << std::endl);
+            }
+            // 如果两个字符不同，选择较大的值
+            else if (c[i - 1][j] >= c[i][j - 1]) {
+                c[i][j] = c[i - 1][j];
+                b[i][j] = '|';   // 表示从上方转移而来
+                TRACE_STEP("  字符不匹配: 选择上方 c[" << (i-1) << "][" << j 
+                     << "]=" << c[i-1][j] << " >= 左方 c[" << i << "][" << (j-1) 
+                     << "]=" << c[i][j-1] << ", c[" << i << "][" << j << "]=" << c[i][j] << std::endl);
+            }
+            else {
+                c[i][j] = c[i][j - 1];
+                b[i][j] = '-';   // 表示从左方转移而来
+                TRACE_STEP("  字符不匹配: 选择左方 c[" << i << "][" << (j-1) 
+                     << "]=" << c[i][j-1] << " > 上方 c[" << (i-1) << "][" << j 
+                     << "]=" << c[i-1][j] << ", c[" << i << "][" << j << "]=" << c[i][j] << std::endl);
+            }
+        }
+    }
+}
+
+/**
+ * 通过回溯方向表构造LCS序列
+ * @param X 第一个序列
+ * @param Y 第二个序列
+ * @param b 方向表
+ * @param i 当前行索引
+ * @param j 当前列索引
+ * @param lcs 存储构造的LCS序列
+ */
+inline void printLCS(const std::string& X, const std::string& Y, const std::vector<std::vector<char>>& b, 
+              int i, int j, std::string& lcs) {
+    // 基本情况：到达边界
+    if (i == 0 || j == 0) {
+        return;
+    }
+    
+    // 如果字符相同，该字符属于LCS
+    if (b[i][j] == '\\') {
+        printLCS(X, Y, b, i - 1, j - 1, lcs);
+        lcs += X[i - 1];
+        TRACE_STEP("  添加字符 '" << X[i-1] << "' 到LCS序列" << std::endl);
+    }
+    // 否则根据方向继续回溯
+    else if (b[i][j] == '|') {
+        printLCS(X, Y, b, i - 1, j, lcs);
+    }
+    else {
+        printLCS(X, Y, b, i, j - 1, lcs);
+    }
+}
+
+#endif //CLRS_C4_U15_LONGEST_COMMON_SUBSEQUENCE_H
@@ -5,6 +5,8 @@
 #include <algorithm>
 #include <string>
 
+#include "common/Trace.h"
+
 using namespace std;
 
 /**
@@ -70,7 +72,7 @@ void printOptimalBST(const vector<vector<int>>& root, const vector<string>& keys
  * @return 最优二叉搜索树的期望搜索代价
  */
 double optimalBST(const vector<double>& p, const vector<double>& q, 
-                  const vector<string>& keys, int n, vector<vector<int>>& root) {
+                  [[maybe_unused]] const vector<string>& keys, int n, vector<vector<int>>& root) {
     // 创建e表存储子树的期望搜索代价
     vector<vector<double>> e(n+2, vector<double>(n+1, 0.0));
     
@@ -80,46 +82,46 @@ double optimalBST(const vector<double>& p, const vector<double>& q,
     // 初始化root表
     root.assign(n+2, vector<int>(n+1, 0));
     
-    cout << "开始计算最优二叉搜索树..." << endl;
-    cout << "关键字数量: " << n << endl;
+    TRACE_SUMMARY("开始计算最优二叉搜索树..." << endl);
+    TRACE_SUMMARY("关键字数量: " << n << endl);
     
     // 初始化边界条件：只包含伪关键字di的子树
     for (int i = 1; i <= n+1; i++) {
         e[i][i-1] = q[i-1];
         w[i][i-1] = q[i-1];
-        cout << "  初始化e[" << i << "][" << (i-1) << "] = " << e[i][i-1] 
-             << " (只有伪关键字d" << (i-1) << ")" << endl;
+        TRACE_STEP("  初始化e[" << i << "][" << (i-1) << "] = " << e[i][i-1] 
+             << " (只有伪关键字d" << (i-1) << ")" << endl);
     }
     
     // 按照子问题规模（关键字数量）从小到大计算
     for (int len = 1; len <= n; len++) {
-        cout << "\n--- 计算包含 " << len << " 个关键字的子树 ---" << endl;
+        TRACE_STEP("\n--- 计算包含 " << len << " 个关键字的子树 ---" << endl);
         
         for (int i = 1; i <= n-len+1; i++) {
             int j = i + len - 1;
             e[i][j] = numeric_limits<double>::max();
             w[i][j] = w[i][j-1] + p[j] + q[j];
             
-            cout << "  计算子树T[" << i << "," << j << "] (关键字: ";
+            TRACE_STEP("  计算子树T[" << i << "," << j << "] (关键字: ");
             for (int t = i; t <= j; t++) {
-                cout << keys[t-1];
-                if (t < j) cout << ",";
+                TRACE_STEP(keys[t-1]);
+                if (t < j) TRACE_STEP(",");
             }
-            cout << "; 概率和: " << fixed << setprecision(3) << w[i][j] << ")" << endl;
+            TRACE_STEP("; 概率和: " << fixed << setprecision(3) << w[i][j] << ")" << endl);
             
             // 尝试每个可能的根节点
             for (int r = i; r <= j; r++) {
                 double t = e[i][r-1] + e[r+1][j] + w[i][j];
                 
-                cout << "    尝试以 " << keys[r-1] << " 为根: 左子树代价=" << e[i][r-1] 
+                TRACE_STEP("    尝试以 " << keys[r-1] << " 为根: 左子树代价=" << e[i][r-1] 
                      << ", 右子树代价=" << e[r+1][j] << ", 子树概率和=" << w[i][j] 
-                     << ", 总代价=" << t << endl;
+                     << ", 总代价=" << t << endl);
                 
                 if (t < e[i][j]) {
                     e[i][j] = t;
                     root[i][j] = r;
-                    cout << "    找到更优解: 最小代价更新为 " << e[i][j] 
-                         << ", 最优根节点为 " << keys[r-1] << endl;
+                    TRACE_STEP("    找到更优解: 最小代价更新为 " << e[i][j] 
+                         << ", 最优根节点为 " << keys[r-1] << endl);
                 }
             }
         }
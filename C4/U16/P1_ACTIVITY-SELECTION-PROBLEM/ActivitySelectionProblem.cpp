@@ -6,6 +6,8 @@
 #include <vector>
 #include <algorithm>
 
+#include "common/Trace.h"
+
 /**
  * 活动结构体，表示一个活动
  */
@@ -46,8 +48,8 @@ std::vector<Activity> iterativeActivitySelection(std::vector<Activity>& activiti
     selected.push_back(activities[0]);
     int lastSelectedIndex = 0;
     
-    std::cout << "选择活动 " << activities[0].id << " (时间: " << activities[0].startTime 
-              << "-" << activities[0].finishTime << ")" << std::endl;
+    TRACE_STEP("选择活动 " << activities[0].id << " (时间: " << activities[0].startTime 
+              << "-" << activities[0].finishTime << ")" << std::endl);
     
     // 步骤3：按贪心策略选择后续活动
     for (int i = 1; i < activities.size(); i++) {
@@ -55,8 +57,8 @@ std::vector<Activity> iterativeActivitySelection(std::vector<Activity>& activiti
         if (activities[i].startTime >= activities[lastSelectedIndex].finishTime) {
             selected.push_back(activities[i]);
             lastSelectedIndex = i;
-            std::cout << "选择活动 " << activities[i].id << " (时间: " << activities[i].startTime 
-                      << "-" << activities[i].finishTime << ")" << std::endl;
+            TRACE_STEP("选择活动 " << activities[i].id << " (时间: " << activities[i].startTime 
+                      << "-" << activities[i].finishTime << ")" << std::endl);
         }
     }
     
@@ -80,8 +82,8 @@ std::vector<Activity> recursiveActivitySelection(const std::vector<Activity>& ac
     
     // 如果找到了兼容活动
     if (m < n) {
-        std::cout << "选择活动 " << activities[m].id << " (时间: " << activities[m].startTime 
-                  << "-" << activities[m].finishTime << ")" << std::endl;
+        TRACE_STEP("选择活动 " << activities[m].id << " (时间: " << activities[m].startTime 
+                  << "-" << activities[m].finishTime << ")" << std::endl);
         
         // 递归选择后续活动
         std::vector<Activity> result = recursiveActivitySelection(activities, m, n);
@@ -107,8 +109,8 @@ std::vector<Activity> recursiveActivitySelectionWrapper(std::vector<Activity>& a
     std::vector<Activity> selected;
     
     // 选择第一个活动
-    std::cout << "选择活动 " << activities[0].id << " (时间: " << activities[0].startTime 
-              << "-" << activities[0].finishTime << ")" << std::endl;
+    TRACE_STEP("选择活动 " << activities[0].id << " (时间: " << activities[0].startTime 
+              << "-" << activities[0].finishTime << ")" << std::endl);
     selected.push_back(activities[0]);
     
     // 递归选择其余活动
@@ -3,6 +3,8 @@
 #include <algorithm>
 #include <set>
 
+#include "common/Trace.h"
+
 /**
  * Matroid and Greedy Algorithm Implementation
  * 
@@ -120,26 +122,28 @@ std::vector<Element> greedyAlgorithm(const Matroid& matroid) {
     std::set<int> independentSet;
     std::vector<Element> result;
     
-    std::cout << "🔧 执行加权拟阵贪心算法:\n";
-    std::cout << "   排序后的元素: ";
-    for (const auto& elem : elements) {
-        std::cout << "(" << elem.id << "," << elem.weight << ") ";
-    }
-    std::cout << "\n\n";
+    TRACE_SUMMARY("🔧 执行加权拟阵贪心算法:\n");
+    TRACE_STEP("   排序后的元素: ");
+    TRACE_STEP_EXEC(
+        for (const auto& elem : elements) {
+            std::cout << "(" << elem.id << "," << elem.weight << ") ";
+        }
+    );
+    TRACE_STEP("\n\n");
     
     // Greedy selection
     for (const Element& element : elements) {
         std::set<int> tentativeSet = independentSet;
         tentativeSet.insert(element.id);
         
-        std::cout << "   考虑添加元素 " << element.id << " (权重: " << element.weight << ")...";
+        TRACE_STEP("   考虑添加元素 " << element.id << " (权重: " << element.weight << ")...");
         
         if (matroid.isIndependent(tentativeSet)) {
             independentSet.insert(element.id);
             result.push_back(element);
-            std::cout << " ✅ 添加成功\n";
+            TRACE_STEP(" ✅ 添加成功\n");
         } else {
-            std::cout << " ❌ 添加失败（会破坏独立性）\n";
+            TRACE_STEP(" ❌ 添加失败（会破坏独立性）\n");
         }
     }
     
@@ -4,6 +4,8 @@
 #include <set>
 #include <iomanip>
 
+#include "common/Trace.h"
+
 /**
  * 用拟阵求解任务调度问题
  * 
@@ -106,13 +108,15 @@ std::vector<Task> greedyTaskScheduling(const TaskSchedulingMatroid& matroid) {
     std::vector<Task> tasks = matroid.getTasks();
     std::sort(tasks.begin(), tasks.end());
     
-    std::cout << "🔧 执行任务调度贪心算法:\n";
-    std::cout << "   按惩罚降序排列的任务: ";
-    for (const auto& task : tasks) {
-        std::cout << "(任务" << task.id << ",截止时间:" << task.deadline 
-                  << ",惩罚:" << task.penalty << ") ";
-    }
-    std::cout << "\n\n";
+    TRACE_SUMMARY("🔧 执行任务调度贪心算法:\n");
+    TRACE_STEP("   按惩罚降序排列的任务: ");
+    TRACE_STEP_EXEC(
+        for (const auto& task : tasks) {
+            std::cout << "(任务" << task.id << ",截止时间:" << task.deadline 
+                      << ",惩罚:" << task.penalty << ") ";
+        }
+    );
+    TRACE_STEP("\n\n");
     
     std::set<int> independentSet;
     std::vector<Task> scheduledTasks;
@@ -122,15 +126,15 @@ std::vector<Task> greedyTaskScheduling(const TaskSchedulingMatroid& matroid) {
         std::set<int> tentativeSet = independentSet;
         tentativeSet.insert(task.id);
         
-        std::cout << "   考虑调度任务 " << task.id << " (截止时间: " << task.deadline 
-                  << ", 惩罚: " << task.penalty << ")...";
+        TRACE_STEP("   考虑调度任务 " << task.id << " (截止时间: " << task.deadline 
+                  << ", 惩罚: " << task.penalty << ")...");
         
         if (matroid.isIndependent(tentativeSet)) {
             independentSet.insert(task.id);
             scheduledTasks.push_back(task);
-            std::cout << " ✅ 调度成功\n";
+            TRACE_STEP(" ✅ 调度成功\n");
         } else {
-            std::cout << " ❌ 调度失败（会导致任务超时）\n";
+            TRACE_STEP(" ❌ 调度失败（会导致任务超时）\n");
         }
     }
     
@@ -3,6 +3,8 @@
 #include <bitset>
 #include <cmath>
 
+#include "common/Trace.h"
+
 /**
  * 聚合分析示例程序
  * 
@@ -28,15 +30,11 @@ public:
      * 实际代价: 1 (将元素压入栈)
      */
     void push(int value) {
-        std::cout << "执行 PUSH(" << value << ")" << std::endl;
+        TRACE_STEP("执行 PUSH(" << value << ")" << std::endl);
         data.push_back(value);
         totalOperations++;
         totalActualCost += 1;  // 实际代价为1
-        std::cout << "  当前栈内容: ";
-        for (int val : data) {
-            std::cout << val << " ";
-        }
-        std::cout << std::endl;
+        TRACE_STEP("  当前栈内容: " << trace::range(data) << std::endl);
     }
 
     /**
@@ -45,19 +43,15 @@ public:
      */
     void pop() {
         if (data.empty()) {
-            std::cout << "执行 POP - 栈为空，无元素可弹出" << std::endl;
+            TRACE_STEP("执行 POP - 栈为空，无元素可弹出" << std::endl);
             return;
         }
         
-        std::cout << "执行 POP - 弹出元素: " << data.back() << std::endl;
+        TRACE_STEP("执行 POP - 弹出元素: " << data.back() << std::endl);
         data.pop_back();
         totalOperations++;
         totalActualCost += 1;  // 实际代价为1
-        std::cout << "  当前栈内容: ";
-        for (int val : data) {
-            std::cout << val << " ";
-        }
-        std::cout << std::endl;
+        TRACE_STEP("  当前栈内容: " << trace::range(data) << std::endl);
     }
 
     /**
@@ -66,20 +60,16 @@ public:
      */
     void multipop(int k) {
         int popCount = std::min(k, (int)data.size());
-        std::cout << "执行 MULTIPOP(" << k << ") - 实际弹出 " << popCount << " 个元素" << std::endl;
+        TRACE_STEP("执行 MULTIPOP(" << k << ") - 实际弹出 " << popCount << " 个元素" << std::endl);
         
         for (int i = 0; i < popCount; i++) {
-            std::cout << "  弹出元素: " << data.back() << std::endl;
+            TRACE_STEP("  弹出元素: " << data.back() << std::endl);
             data.pop_back();
         }
         
         totalOperations++;
         totalActualCost += popCount;  // 实际代价为popCount
-        std::cout << "  当前栈内容: ";
-        for (int val : data) {
-            std::cout << val << " ";
-        }
-        std::cout << std::endl;
+        TRACE_STEP("  当前栈内容: " << trace::range(data) << std::endl);
     }
 
     /**
@@ -104,8 +94,8 @@ private:
 
 public:
     BinaryCounter(int numBits) : bits(numBits, false), totalIncrements(0), totalBitFlips(0) {
-        std::cout << "创建 " << numBits << " 位二进制计数器，初始值为: ";
-        printCounter();
+        TRACE_STEP("创建 " << numBits << " 位二进制计数器，初始值为: ");
+        TRACE_STEP_EXEC(printCounter());
     }
 
     /**
@@ -113,9 +103,9 @@ public:
      * 实际代价: 翻转的比特位数量
      */
     void increment() {
-        std::cout << "\n执行第 " << (totalIncrements + 1) << " 次 INCREMENT 操作:" << std::endl;
-        std::cout << "  操作前: ";
-        printCounter();
+        TRACE_STEP("\n执行第 " << (totalIncrements + 1) << " 次 INCREMENT 操作:" << std::endl);
+        TRACE_STEP("  操作前: ");
+        TRACE_STEP_EXEC(printCounter());
         
         int flips = 0;  // 记录本次操作翻转的比特位数
         int i = 0;
@@ -136,9 +126,9 @@ public:
         totalIncrements++;
         totalBitFlips += flips;
         
-        std::cout << "  操作后: ";
-        printCounter();
-        std::cout << "  本次翻转位数: " << flips << std::endl;
+        TRACE_STEP("  操作后: ");
+        TRACE_STEP_EXEC(printCounter());
+        TRACE_STEP("  本次翻转位数: " << flips << std::endl);
     }
 
     /**
@@ -201,7 +191,7 @@ private:
 public:
     DynamicArray() : capacity(1), totalOperations(0), totalActualCost(0) {
         data.reserve(capacity);
-        std::cout << "创建动态数组，初始容量: " << capacity << std::endl;
+        TRACE_STEP("创建动态数组，初始容量: " << capacity << std::endl);
     }
 
     /**
@@ -209,34 +199,30 @@ public:
      * 实际代价: 1 (插入元素) + 扩容时代价(复制所有元素)
      */
     void push(int value) {
-        std::cout << "\n执行 PUSH(" << value << ")" << std::endl;
-        std::cout << "  当前大小: " << data.size() << ", 容量: " << capacity << std::endl;
+        TRACE_STEP("\n执行 PUSH(" << value << ")" << std::endl);
+        TRACE_STEP("  当前大小: " << data.size() << ", 容量: " << capacity << std::endl);
         
         int cost = 1;  // 插入元素的代价
         
         // 检查是否需要扩容
         if (data.size() == capacity) {
-            std::cout << "  ⚠️  需要扩容!" << std::endl;
-            int oldCapacity = capacity;
+            TRACE_STEP("  ⚠️  需要扩容!" << std::endl);
+            [[maybe_unused]] int oldCapacity = capacity;
             capacity *= 2;  // 扩容为原来的2倍
             
             // 复制元素的代价
             cost += data.size();  // 需要复制所有现有元素
             
-            std::cout << "  扩容: " << oldCapacity << " -> " << capacity << std::endl;
-            std::cout << "  复制元素代价: " << data.size() << std::endl;
+            TRACE_STEP("  扩容: " << oldCapacity << " -> " << capacity << std::endl);
+            TRACE_STEP("  复制元素代价: " << data.size() << std::endl);
         }
         
         data.push_back(value);
         totalOperations++;
         totalActualCost += cost;
         
-        std::cout << "  插入元素 " << value << ", 实际代价: " << cost << std::endl;
-        std::cout << "  当前数组: ";
-        for (int val : data) {
-            std::cout << val << " ";
-        }
-        std::cout << std::endl;
+        TRACE_STEP("  插入元素 " << value << ", 实际代价: " << cost << std::endl);
+        TRACE_STEP("  当前数组: " << trace::range(data) << std::endl);
     }
 
     /**
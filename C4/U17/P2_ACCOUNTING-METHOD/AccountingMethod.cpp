@@ -2,6 +2,8 @@
 #include <vector>
 #include <stack>
 
+#include "common/Trace.h"
+
 /**
  * 核算法示例程序
  * 
@@ -30,9 +32,9 @@ public:
      * 摊还代价: 2 (1用于实际操作，1作为信用存储在该元素上)
      */
     void push(int value) {
-        std::cout << "执行 PUSH(" << value << ")" << std::endl;
-        std::cout << "  实际代价: 1 (压入元素)" << std::endl;
-        std::cout << "  摊还代价: 2 (1用于实际操作，1作为信用存储在该元素上)" << std::endl;
+        TRACE_STEP("执行 PUSH(" << value << ")" << std::endl);
+        TRACE_STEP("  实际代价: 1 (压入元素)" << std::endl);
+        TRACE_STEP("  摊还代价: 2 (1用于实际操作，1作为信用存储在该元素上)" << std::endl);
         
         data.push(value);
         totalOperations++;
@@ -40,7 +42,7 @@ public:
         totalCredit += 1;  // 存储1个信用单位在该元素上
         totalAmortizedCost += 2;
         
-        std::cout << "  当前栈内容: ";
+        TRACE_STEP("  当前栈内容: ");
         std::stack<int> temp = data;
         std::vector<int> elements;
         while (!temp.empty()) {
@@ -48,10 +50,10 @@ public:
             temp.pop();
         }
         for (int i = elements.size() - 1; i >= 0; i--) {
-            std::cout << elements[i] << " ";
+            TRACE_STEP(elements[i] << " ");
         }
-        std::cout << std::endl;
-        std::cout << "  当前信用总额: " << totalCredit << std::endl;
+        TRACE_STEP(std::endl);
+        TRACE_STEP("  当前信用总额: " << totalCredit << std::endl);
     }
 
     /**
@@ -61,14 +63,13 @@ public:
      */
     void pop() {
         if (data.empty()) {
-            std::cout << "执行 POP - 栈为空，无元素可弹出" << std::endl;
+            TRACE_STEP("执行 POP - 栈为空，无元素可弹出" << std::endl);
             return;
         }
         
-        int value = data.top();
-        std::cout << "执行 POP - 弹出元素: " << value << std::endl;
-        std::cout << "  实际代价: 1 (弹出元素)" << std::endl;
-        std::cout << "  摊还代价: 0 (使用该元素上的信用支付实际代价)" << std::endl;
+        TRACE_STEP("执行 POP - 弹出元素: " << data.top() << std::endl);
+        TRACE_STEP("  实际代价: 1 (弹出元素)" << std::endl);
+        TRACE_STEP("  摊还代价: 0 (使用该元素上的信用支付实际代价)" << std::endl);
         
         data.pop();
         totalOperations++;
@@ -76,7 +77,7 @@ public:
         totalCredit -= 1;  // 使用1个信用单位支付实际代价
         totalAmortizedCost += 0;
         
-        std::cout << "  当前栈内容: ";
+        TRACE_STEP("  当前栈内容: ");
         std::stack<int> temp = data;
         std::vector<int> elements;
         while (!temp.empty()) {
@@ -84,10 +85,10 @@ public:
             temp.pop();
         }
         for (int i = elements.size() - 1; i >= 0; i--) {
-            std::cout << elements[i] << " ";
+            TRACE_STEP(elements[i] << " ");
         }
-        std::cout << std::endl;
-        std::cout << "  当前信用总额: " << totalCredit << std::endl;
+        TRACE_STEP(std::endl);
+        TRACE_STEP("  当前信用总额: " << totalCredit << std::endl);
     }
 
     /**
@@ -98,16 +99,16 @@ public:
     void multipop(int k) {
         int popCount = std::min(k, (int)data.size());
         if (popCount == 0) {
-            std::cout << "执行 MULTIPOP(" << k << ") - 栈为空，无元素可弹出" << std::endl;
+            TRACE_STEP("执行 MULTIPOP(" << k << ") - 栈为空，无元素可弹出" << std::endl);
             return;
         }
         
-        std::cout << "执行 MULTIPOP(" << k << ") - 实际弹出 " << popCount << " 个元素" << std::endl;
-        std::cout << "  实际代价: " << popCount << " (弹出" << popCount << "个元素)" << std::endl;
-        std::cout << "  摊还代价: 0 (使用被弹出元素上的信用支付实际代价)" << std::endl;
+        TRACE_STEP("执行 MULTIPOP(" << k << ") - 实际弹出 " << popCount << " 个元素" << std::endl);
+        TRACE_STEP("  实际代价: " << popCount << " (弹出" << popCount << "个元素)" << std::endl);
+        TRACE_STEP("  摊还代价: 0 (使用被弹出元素上的信用支付实际代价)" << std::endl);
         
         for (int i = 0; i < popCount; i++) {
-            std::cout << "  弹出元素: " << data.top() << std::endl;
+            TRACE_STEP("  弹出元素: " << data.top() << std::endl);
             data.pop();
         }
         
@@ -116,7 +117,7 @@ public:
         totalCredit -= popCount;  // 使用popCount个信用单位支付实际代价
         totalAmortizedCost += 0;
         
-        std::cout << "  当前栈内容: ";
+        TRACE_STEP("  当前栈内容: ");
         std::stack<int> temp = data;
         std::vector<int> elements;
         while (!temp.empty()) {
@@ -124,10 +125,10 @@ public:
             temp.pop();
         }
         for (int i = elements.size() - 1; i >= 0; i--) {
-            std::cout << elements[i] << " ";
+            TRACE_STEP(elements[i] << " ");
         }
-        std::cout << std::endl;
-        std::cout << "  当前信用总额: " << totalCredit << std::endl;
+        TRACE_STEP(std::endl);
+        TRACE_STEP("  当前信用总额: " << totalCredit << std::endl);
     }
 
     /**
@@ -158,8 +159,8 @@ private:
 public:
     BinaryCounterWithAccounting(int numBits) : bits(numBits, false), totalIncrements(0), 
                                                totalBitFlips(0), totalCredit(0), totalAmortizedCost(0) {
-        std::cout << "创建 " << numBits << " 位二进制计数器，初始值为: ";
-        printCounter();
+        TRACE_STEP("创建 " << numBits << " 位二进制计数器，初始值为: ");
+        TRACE_STEP_EXEC(printCounter());
     }
 
     /**
@@ -168,16 +169,16 @@ public:
      * 摊还代价: 2 (1用于将0翻转为1，1作为信用存储在该位上)
      */
     void increment() {
-        std::cout << "\n执行第 " << (totalIncrements + 1) << " 次 INCREMENT 操作:" << std::endl;
-        std::cout << "  操作前: ";
-        printCounter();
+        TRACE_STEP("\n执行第 " << (totalIncrements + 1) << " 次 INCREMENT 操作:" << std::endl);
+        TRACE_STEP("  操作前: ");
+        TRACE_STEP_EXEC(printCounter());
         
         int flips = 0;  // 记录本次操作翻转的比特位数
         int i = 0;
         
         // 翻转所有连续的1位为0（使用这些位上的信用支付）
         while (i < bits.size() && bits[i] == true) {
-            std::cout << "  翻转位 " << i << " 从 1 到 0 (使用该位上的信用支付)" << std::endl;
+            TRACE_STEP("  翻转位 " << i << " 从 1 到 0 (使用该位上的信用支付)" << std::endl);
             bits[i] = false;
             flips++;
             totalCredit -= 1;  // 使用1个信用单位支付翻转代价
@@ -186,7 +187,7 @@ public:
         
         // 如果还有剩余位，将第一个0位翻转为1（支付1个单位实际代价，存储1个单位信用）
         if (i < bits.size()) {
-            std::cout << "  翻转位 " << i << " 从 0 到 1 (支付1个单位实际代价，存储1个单位信用)" << std::endl;
+            TRACE_STEP("  翻转位 " << i << " 从 0 到 1 (支付1个单位实际代价，存储1个单位信用)" << std::endl);
             bits[i] = true;
             flips++;
             totalCredit += 1;  // 存储1个信用单位在该位上
@@ -196,12 +197,12 @@ public:
         totalBitFlips += flips;
         totalAmortizedCost += 2;  // 摊还代价恒为2
         
-        std::cout << "  操作后: ";
-        printCounter();
-        std::cout << "  本次翻转位数: " << flips << std::endl;
-        std::cout << "  本次实际代价: " << flips << std::endl;
-        std::cout << "  本次摊还代价: 2" << std::endl;
-        std::cout << "  当前信用总额: " << totalCredit << std::endl;
+        TRACE_STEP("  操作后: ");
+        TRACE_STEP_EXEC(printCounter());
+        TRACE_STEP("  本次翻转位数: " << flips << std::endl);
+        TRACE_STEP("  本次实际代价: " << flips << std::endl);
+        TRACE_STEP("  本次摊还代价: 2" << std::endl);
+        TRACE_STEP("  当前信用总额: " << totalCredit << std::endl);
     }
 
     /**
@@ -258,7 +259,7 @@ public:
     DynamicArrayWithAccounting() : capacity(1), totalOperations(0), totalActualCost(0), 
                                    totalCredit(0), totalAmortizedCost(0) {
         data.reserve(capacity);
-        std::cout << "创建动态数组，初始容量: " << capacity << std::endl;
+        TRACE_STEP("创建动态数组，初始容量: " << capacity << std::endl);
     }
 
     /**
@@ -267,23 +268,22 @@ public:
      * 摊还代价: 3 (1用于插入元素，2作为信用存储在未来用于扩容)
      */
     void push(int value) {
-        std::cout << "\n执行 PUSH(" << value << ")" << std::endl;
-        std::cout << "  当前大小: " << data.size() << ", 容量: " << capacity << std::endl;
+        TRACE_STEP("\n执行 PUSH(" << value << ")" << std::endl);
+        TRACE_STEP("  当前大小: " << data.size() << ", 容量: " << capacity << std::endl);
         
         int actualCost = 1;  // 插入元素的代价
         
         // 检查是否需要扩容
         if (data.size() == capacity) {
-            std::cout << "  ⚠️  需要扩容!" << std::endl;
-            int oldCapacity = capacity;
+            TRACE_STEP("  ⚠️  需要扩容!" << std::endl);
             capacity *= 2;  // 扩容为原来的2倍
             
             // 复制元素的代价
             actualCost += data.size();  // 需要复制所有现有元素
             totalCredit -= data.size(); // 使用之前存储的信用支付复制代价
             
-            std::cout << "  扩容: " << oldCapacity << " -> " << capacity << std::endl;
-            std::cout << "  复制元素代价: " << data.size() << " (使用之前存储的信用支付)" << std::endl;
+            TRACE_STEP("  扩容: " << capacity / 2 << " -> " << capacity << std::endl);
+            TRACE_STEP("  复制元素代价: " << data.size() << " (使用之前存储的信用支付)" << std::endl);
         }
         
         data.push_back(value);
@@ -292,14 +292,10 @@ public:
         totalCredit += 2;  // 存储2个信用单位用于未来的扩容
         totalAmortizedCost += 3;  // 摊还代价恒为3
         
-        std::cout << "  插入元素 " << value << ", 实际代价: " << actualCost << std::endl;
-        std::cout << "  摊还代价: 3 (1用于插入元素，2作为信用存储用于未来扩容)" << std::endl;
-        std::cout << "  当前信用总额: " << totalCredit << std::endl;
-        std::cout << "  当前数组: ";
-        for (int val : data) {
-            std::cout << val << " ";
-        }
-        std::cout << std::endl;
+        TRACE_STEP("  插入元素 " << value << ", 实际代价: " << actualCost << std::endl);
+        TRACE_STEP("  摊还代价: 3 (1用于插入元素，2作为信用存储用于未来扩容)" << std::endl);
+        TRACE_STEP("  当前信用总额: " << totalCredit << std::endl);
+        TRACE_STEP("  当前数组: " << trace::range(data) << std::endl);
     }
 
     /**
@@ -3,6 +3,8 @@
 #include <stack>
 #include <cmath>
 
+#include "common/Trace.h"
+
 /**
  * 势能法示例程序
  * 
@@ -41,8 +43,8 @@ public:
     void push(int value) {
         int oldPotential = potentialFunction();
         
-        std::cout << "执行 PUSH(" << value << ")" << std::endl;
-        std::cout << "  实际代价: 1 (压入元素)" << std::endl;
+        TRACE_STEP("执行 PUSH(" << value << ")" << std::endl);
+        TRACE_STEP("  实际代价: 1 (压入元素)" << std::endl);
         
         data.push(value);
         totalOperations++;
@@ -53,10 +55,10 @@ public:
         int amortizedCost = 1 + potentialChange;
         totalAmortizedCost += amortizedCost;
         
-        std::cout << "  势能变化: " << newPotential << " - " << oldPotential << " = " << potentialChange << std::endl;
-        std::cout << "  摊还代价: 1 + " << potentialChange << " = " << amortizedCost << std::endl;
+        TRACE_STEP("  势能变化: " << newPotential << " - " << oldPotential << " = " << potentialChange << std::endl);
+        TRACE_STEP("  摊还代价: 1 + " << potentialChange << " = " << amortizedCost << std::endl);
         
-        std::cout << "  当前栈内容: ";
+        TRACE_STEP("  当前栈内容: ");
         std::stack<int> temp = data;
         std::vector<int> elements;
         while (!temp.empty()) {
@@ -64,10 +66,10 @@ public:
             temp.pop();
         }
         for (int i = elements.size() - 1; i >= 0; i--) {
-            std::cout << elements[i] << " ";
+            TRACE_STEP(elements[i] << " ");
         }
-        std::cout << std::endl;
-        std::cout << "  当前势能: " << newPotential << std::endl;
+        TRACE_STEP(std::endl);
+        TRACE_STEP("  当前势能: " << newPotential << std::endl);
     }
 
     /**
@@ -77,15 +79,13 @@ public:
      */
     void pop() {
         if (data.empty()) {
-            std::cout << "执行 POP - 栈为空，无元素可弹出" << std::endl;
+            TRACE_STEP("执行 POP - 栈为空，无元素可弹出" << std::endl);
             return;
         }
         
         int oldPotential = potentialFunction();
-        int value = data.top();
-        
-        std::cout << "执行 POP - 弹出元素: " << value << std::endl;
-        std::cout << "  实际代价: 1 (弹出元素)" << std::endl;
+        TRACE_STEP("执行 POP - 弹出元素: " << data.top() << std::endl);
+        TRACE_STEP("  实际代价: 1 (弹出元素)" << std::endl);
         
         data.pop();
         totalOperations++;
@@ -96,10 +96,10 @@ public:
         int amortizedCost = 1 + potentialChange;
         totalAmortizedCost += amortizedCost;
         
-        std::cout << "  势能变化: " << newPotential << " - " << oldPotential << " = " << potentialChange << std::endl;
-        std::cout << "  摊还代价: 1 + " << potentialChange << " = " << amortizedCost << std::endl;
+        TRACE_STEP("  势能变化: " << newPotential << " - " << oldPotential << " = " << potentialChange << std::endl);
+        TRACE_STEP("  摊还代价: 1 + " << potentialChange << " = " << amortizedCost << std::endl);
         
-        std::cout << "  当前栈内容: ";
+        TRACE_STEP("  当前栈内容: ");
         std::stack<int> temp = data;
         std::vector<int> elements;
         while (!temp.empty()) {
@@ -107,10 +107,10 @@ public:
             temp.pop();
         }
         for (int i = elements.size() - 1; i >= 0; i--) {
-            std::cout << elements[i] << " ";
+            TRACE_STEP(elements[i] << " ");
         }
-        std::cout << std::endl;
-        std::cout << "  当前势能: " << newPotential << std::endl;
+        TRACE_STEP(std::endl);
+        TRACE_STEP("  当前势能: " << newPotential << std::endl);
     }
 
     /**
@@ -121,17 +121,17 @@ public:
     void multipop(int k) {
         int popCount = std::min(k, (int)data.size());
         if (popCount == 0) {
-            std::cout << "执行 MULTIPOP(" << k << ") - 栈为空，无元素可弹出" << std::endl;
+            TRACE_STEP("执行 MULTIPOP(" << k << ") - 栈为空，无元素可弹出" << std::endl);
             return;
         }
         
         int oldPotential = potentialFunction();
         
-        std::cout << "执行 MULTIPOP(" << k << ") - 实际弹出 " << popCount << " 个元素" << std::endl;
-        std::cout << "  实际代价: " << popCount << " (弹出" << popCount << "个元素)" << std::endl;
+        TRACE_STEP("执行 MULTIPOP(" << k << ") - 实际弹出 " << popCount << " 个元素" << std::endl);
+        TRACE_STEP("  实际代价: " << popCount << " (弹出" << popCount << "个元素)" << std::endl);
         
         for (int i = 0; i < popCount; i++) {
-            std::cout << "  弹出元素: " << data.top() << std::endl;
+            TRACE_STEP("  弹出元素: " << data.top() << std::endl);
             data.pop();
         }
         
@@ -143,10 +143,10 @@ public:
         int amortizedCost = popCount + potentialChange;
         totalAmortizedCost += amortizedCost;
         
-        std::cout << "  势能变化: " << newPotential << " - " << oldPotential << " = " << potentialChange << std::endl;
-        std::cout << "  摊还代价: " << popCount << " + " << potentialChange << " = " << amortizedCost << std::endl;
+        TRACE_STEP("  势能变化: " << newPotential << " - " << oldPotential << " = " << potentialChange << std::endl);
+        TRACE_STEP("  摊还代价: " << popCount << " + " << potentialChange << " = " << amortizedCost << std::endl);
         
-        std::cout << "  当前栈内容: ";
+        TRACE_STEP("  当前栈内容: ");
         std::stack<int> temp = data;
         std::vector<int> elements;
         while (!temp.empty()) {
@@ -154,10 +154,10 @@ public:
             temp.pop();
         }
         for (int i = elements.size() - 1; i >= 0; i--) {
-            std::cout << elements[i] << " ";
+            TRACE_STEP(elements[i] << " ");
         }
-        std::cout << std::endl;
-        std::cout << "  当前势能: " << newPotential << std::endl;
+        TRACE_STEP(std::endl);
+        TRACE_STEP("  当前势能: " << newPotential << std::endl);
     }
 
     /**
@@ -187,9 +187,9 @@ private:
 public:
     BinaryCounterWithPotential(int numBits) : bits(numBits, false), totalIncrements(0), 
                                               totalBitFlips(0), totalAmortizedCost(0) {
-        std::cout << "创建 " << numBits << " 位二进制计数器，初始值为: ";
-        printCounter();
-        std::cout << "  初始势能: " << potentialFunction() << std::endl;
+        TRACE_STEP("创建 " << numBits << " 位二进制计数器，初始值为: ");
+        TRACE_STEP_EXEC(printCounter());
+        TRACE_STEP("  初始势能: " << potentialFunction() << std::endl);
     }
 
     /**
@@ -216,10 +216,10 @@ public:
      * - 摊还代价: (t+1) + (1-t) = 2
      */
     void increment() {
-        std::cout << "\n执行第 " << (totalIncrements + 1) << " 次 INCREMENT 操作:" << std::endl;
-        std::cout << "  操作前: ";
-        printCounter();
-        std::cout << "  操作前势能: " << potentialFunction() << std::endl;
+        TRACE_STEP("\n执行第 " << (totalIncrements + 1) << " 次 INCREMENT 操作:" << std::endl);
+        TRACE_STEP("  操作前: ");
+        TRACE_STEP_EXEC(printCounter());
+        TRACE_STEP("  操作前势能: " << potentialFunction() << std::endl);
         
         int oldPotential = potentialFunction();
         int flips = 0;  // 记录本次操作翻转的比特位数
@@ -227,7 +227,7 @@ public:
         
         // 翻转所有连续的1位为0
         while (i < bits.size() && bits[i] == true) {
-            std::cout << "  翻转位 " << i << " 从 1 到 0" << std::endl;
+            TRACE_STEP("  翻转位 " << i << " 从 1 到 0" << std::endl);
             bits[i] = false;
             flips++;
             i++;
@@ -235,7 +235,7 @@ public:
         
         // 如果还有剩余位，将第一个0位翻转为1
         if (i < bits.size()) {
-            std::cout << "  翻转位 " << i << " 从 0 到 1" << std::endl;
+            TRACE_STEP("  翻转位 " << i << " 从 0 到 1" << std::endl);
             bits[i] = true;
             flips++;
         }
@@ -248,13 +248,13 @@ public:
         int amortizedCost = flips + potentialChange;
         totalAmortizedCost += amortizedCost;
         
-        std::cout << "  操作后: ";
-        printCounter();
-        std::cout << "  操作后势能: " << newPotential << std::endl;
-        std::cout << "  本次翻转位数: " << flips << std::endl;
-        std::cout << "  本次实际代价: " << flips << std::endl;
-        std::cout << "  势能变化: " << newPotential << " - " << oldPotential << " = " << potentialChange << std::endl;
-        std::cout << "  本次摊还代价: " << flips << " + " << potentialChange << " = " << amortizedCost << std::endl;
+        TRACE_STEP("  操作后: ");
+        TRACE_STEP_EXEC(printCounter());
+        TRACE_STEP("  操作后势能: " << newPotential << std::endl);
+        TRACE_STEP("  本次翻转位数: " << flips << std::endl);
+        TRACE_STEP("  本次实际代价: " << flips << std::endl);
+        TRACE_STEP("  势能变化: " << newPotential << " - " << oldPotential << " = " << potentialChange << std::endl);
+        TRACE_STEP("  本次摊还代价: " << flips << " + " << potentialChange << " = " << amortizedCost << std::endl);
     }
 
     /**
@@ -309,8 +309,8 @@ private:
 public:
     DynamicArrayWithPotential() : capacity(1), totalOperations(0), totalActualCost(0), totalAmortizedCost(0) {
         data.reserve(capacity);
-        std::cout << "创建动态数组，初始容量: " << capacity << std::endl;
-        std::cout << "  初始势能: " << potentialFunction() << std::endl;
+        TRACE_STEP("创建动态数组，初始容量: " << capacity << std::endl);
+        TRACE_STEP("  初始势能: " << potentialFunction() << std::endl);
     }
 
     /**
@@ -335,24 +335,23 @@ public:
      * 摊还代价: 实际代价 + 势能变化
      */
     void push(int value) {
-        std::cout << "\n执行 PUSH(" << value << ")" << std::endl;
-        std::cout << "  当前大小: " << data.size() << ", 容量: " << capacity << std::endl;
-        std::cout << "  操作前势能: " << potentialFunction() << std::endl;
+        TRACE_STEP("\n执行 PUSH(" << value << ")" << std::endl);
+        TRACE_STEP("  当前大小: " << data.size() << ", 容量: " << capacity << std::endl);
+        TRACE_STEP("  操作前势能: " << potentialFunction() << std::endl);
         
         int oldPotential = potentialFunction();
         int actualCost = 1;  // 插入元素的代价
         
         // 检查是否需要扩容
         if (data.size() == capacity) {
-            std::cout << "  ⚠️  需要扩容!" << std::endl;
-            int oldCapacity = capacity;
+            TRACE_STEP("  ⚠️  需要扩容!" << std::endl);
             capacity *= 2;  // 扩容为原来的2倍
             
             // 复制元素的代价
             actualCost += data.size();  // 需要复制所有现有元素
             
-            std::cout << "  扩容: " << oldCapacity << " -> " << capacity << std::endl;
-            std::cout << "  复制元素代价: " << data.size() << std::endl;
+            TRACE_STEP("  扩容: " << capacity / 2 << " -> " << capacity << std::endl);
+            TRACE_STEP("  复制元素代价: " << data.size() << std::endl);
         }
         
         data.push_back(value);
@@ -364,15 +363,11 @@ public:
         int amortizedCost = actualCost + potentialChange;
         totalAmortizedCost += amortizedCost;
         
-        std::cout << "  插入元素 " << value << ", 实际代价: " << actualCost << std::endl;
-        std::cout << "  操作后势能: " << newPotential << std::endl;
-        std::cout << "  势能变化: " << newPotential << " - " << oldPotential << " = " << potentialChange << std::endl;
-        std::cout << "  本次摊还代价: " << actualCost << " + " << potentialChange << " = " << amortizedCost << std::endl;
-        std::cout << "  当前数组: ";
-        for (int val : data) {
-            std::cout << val << " ";
-        }
-        std::cout << std::endl;
+        TRACE_STEP("  插入元素 " << value << ", 实际代价: " << actualCost << std::endl);
+        TRACE_STEP("  操作后势能: " << newPotential << std::endl);
+        TRACE_STEP("  势能变化: " << newPotential << " - " << oldPotential << " = " << potentialChange << std::endl);
+        TRACE_STEP("  本次摊还代价: " << actualCost << " + " << potentialChange << " = " << amortizedCost << std::endl);
+        TRACE_STEP("  当前数组: " << trace::range(data) << std::endl);
     }
 
     /**
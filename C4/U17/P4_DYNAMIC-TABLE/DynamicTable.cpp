@@ -2,6 +2,9 @@
 #include <algorithm>
 #include <iomanip>
 
+#include "DynamicTable.h"
+#include "common/Trace.h"
+
 /**
  * 动态表实现示例程序
  * 
@@ -14,6 +17,7 @@ private:
     int* table;           // 存储元素的数组
     int size;             // 表的总容量
     int num;              // 当前存储的元素数量
+    DynamicTablePolicy policy; // 扩张与收缩策略：装满时加倍，负载因子低于1/4时减半
     
 public:
     // 构造函数
@@ -39,34 +43,34 @@ public:
     // 插入元素（只增加num，不实际存储值）
     void insert() {
         // 如果表已满，则进行扩张
-        if (num == size) {
-            std::cout << "扩张操作: ";
+        if (policy.shouldGrow(num, size)) {
+            TRACE_STEP("扩张操作: ");
             expand();
         }
         
         num++;
-        std::cout << "插入元素，当前元素数: " << num 
+        TRACE_STEP("插入元素，当前元素数: " << num 
                   << ", 表容量: " << size 
                   << ", 负载因子: " << std::fixed << std::setprecision(2) << getLoadFactor() 
-                  << std::endl;
+                  << std::endl);
     }
     
     // 删除元素
     void remove() {
         if (num == 0) {
-            std::cout << "表为空，无法删除元素" << std::endl;
+            TRACE_STEP("表为空，无法删除元素" << std::endl);
             return;
         }
         
         num--;
-        std::cout << "删除元素，当前元素数: " << num 
+        TRACE_STEP("删除元素，当前元素数: " << num 
                   << ", 表容量: " << size 
                   << ", 负载因子: " << std::fixed << std::setprecision(2) << getLoadFactor()
-                  << std::endl;
+                  << std::endl);
         
         // 如果负载因子低于1/4且表容量大于1，则进行收缩
-        if (size > 1 && getLoadFactor() < 0.25) {
-            std::cout << "收缩操作: ";
+        if (policy.shouldShrink(num, size)) {
+            TRACE_STEP("收缩操作: ");
             contract();
         }
     }
@@ -74,7 +78,7 @@ public:
 private:
     // 扩张表（倍增策略）
     void expand() {
-        int newSize = (size == 0) ? 1 : size * 2;
+        int newSize = static_cast<int>(policy.grown(size));
         int* newTable = new int[newSize];
         
         // 复制原有元素
@@ -87,12 +91,12 @@ private:
         table = newTable;
         size = newSize;
         
-        std::cout << "表从容量 " << size/2 << " 扩张到 " << size << std::endl;
+        TRACE_STEP("表从容量 " << size/2 << " 扩张到 " << size << std::endl);
     }
     
     // 收缩表（半减策略）
     void contract() {
-        int newSize = size / 2;
+        int newSize = static_cast<int>(policy.shrunk(size));
         int* newTable = new int[newSize];
         
         // 复制现有元素
@@ -105,7 +109,7 @@ private:
         table = newTable;
         size = newSize;
         
-        std::cout << "表从容量 " << size*2 << " 收缩到 " << size << std::endl;
+        TRACE_STEP("表从容量 " << size*2 << " 收缩到 " << size << std::endl);
     }
 };
 
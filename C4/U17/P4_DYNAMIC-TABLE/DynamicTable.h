@@ -0,0 +1,61 @@
+//
+// Created by HaPpY on 2026/10/17.
+//
+
+#ifndef CLRS_C4_U17_DYNAMIC_TABLE_H
+#define CLRS_C4_U17_DYNAMIC_TABLE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+
+/**
+ * 动态表的扩张与收缩策略（《算法导论》17.4）
+ *
+ * 再插入一个元素会使负载因子超过 maxLoad 时容量加倍，删除后负载因子低于 minLoad 时容量减半。
+ * 默认 maxLoad = 1、minLoad = 1/4：扩张后负载因子为 1/2，收缩后也为 1/2，
+ * 两次调整之间至少间隔 Θ(容量) 次操作，势能法可证每次操作的摊还代价为 O(1)。
+ * DynamicTable 与 HashTable（C3/U11，负载因子为元素数与桶数之比）共用这一策略。
+ */
+struct DynamicTablePolicy {
+    double maxLoad = 1.0;       // 扩张阈值
+    double minLoad = 0.25;      // 收缩阈值，0 表示从不收缩
+    size_t minCapacity = 1;     // 收缩不会低于这一容量
+
+    /**
+     * 检查阈值：minLoad 必须小于 maxLoad 的一半，否则扩张后紧接着的删除可能立即触发收缩，
+     * 在阈值附近交替插入、删除时每次操作都要重建整张表
+     * @throws std::invalid_argument 如果阈值不满足0 <= 2·minLoad < maxLoad
+     */
+    void validate() const {
+        if (!(maxLoad > 0.0) || !(minLoad >= 0.0) || !(2.0 * minLoad < maxLoad)) {
+            throw std::invalid_argument("Dynamic table thresholds must satisfy 0 <= 2 * minLoad < maxLoad");
+        }
+    }
+
+    /**
+     * 已有 num 个元素、容量为 size 时，再插入一个元素是否需要先扩张
+     */
+    bool shouldGrow(size_t num, size_t size) const {
+        return size == 0 || static_cast<double>(num + 1) > maxLoad * static_cast<double>(size);
+    }
+
+    /**
+     * 删除后剩余 num 个元素、容量为 size 时是否需要收缩
+     */
+    bool shouldShrink(size_t num, size_t size) const {
+        return size > minCapacity && static_cast<double>(num) < minLoad * static_cast<double>(size);
+    }
+
+    // 扩张后的容量：加倍
+    size_t grown(size_t size) const {
+        return size == 0 ? std::max<size_t>(1, minCapacity) : size * 2;
+    }
+
+    // 收缩后的容量：减半，但不低于 minCapacity
+    size_t shrunk(size_t size) const {
+        return std::max(minCapacity, size / 2);
+    }
+};
+
+#endif //CLRS_C4_U17_DYNAMIC_TABLE_H
@@ -0,0 +1,645 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#ifndef CLRS_C5_U18_B_TREE_H
+#define CLRS_C5_U18_B_TREE_H
+
+#include <functional>
+#include <vector>
+
+#include "common/Trace.h"
+
+/**
+ * B树实现示例程序
+ * 
+ * 本程序演示了《算法导论》第18章B树的概念和操作
+ * B树是一种自平衡的树数据结构，能够保持数据有序，
+ * 并允许在对数时间内进行搜索、顺序访问、插入和删除操作。
+ * 
+ * B树的主要特点：
+ * 1. 每个节点可以包含多个关键字（而不是二叉树的单个关键字）
+ * 2. 所有叶节点都在同一层
+ * 3. 除了根节点外，每个节点都包含至少⌈m/2⌉-1个关键字（其中m是最小度数）
+ * 4. 每个节点最多包含m-1个关键字
+ */
+
+// B树节点类定义
+// Compare 为关键字的严格弱序，两个关键字互不小于对方时视为相等
+template<typename Key, typename Compare = std::less<Key>>
+class BTreeNode {
+public:
+    int t;                           // 最小度数（阶数）
+    std::vector<Key> keys;           // 存储关键字的数组
+    std::vector<BTreeNode*> children;// 存储子节点指针的数组
+    bool leaf;                       // 标识是否为叶节点的布尔值
+    int n;                           // 当前节点中关键字的数量
+    Compare comp;                    // 关键字比较器
+
+    // 构造函数：创建一个具有指定最小度数和叶节点标志的节点
+    BTreeNode(int _t, bool _leaf, const Compare& _comp = Compare());
+
+    // 析构函数：释放以该节点为根的子树（只有前 n+1 个子节点指针有效）
+    ~BTreeNode() {
+        if (!leaf) {
+            for (int i = 0; i <= n; i++) {
+                delete children[i];
+            }
+        }
+    }
+
+    // 中序遍历以该节点为根的子树，对每个关键字调用visit
+    template<typename Visitor>
+    void traverse(Visitor& visit) const;
+
+    // 在以该节点为根的子树中搜索关键字k
+    BTreeNode* search(const Key& k);
+
+    // 分裂满子节点y，i是y在当前节点children数组中的索引
+    void splitChild(int i, BTreeNode* y);
+
+    // 在非满节点中插入关键字k
+    void insertNonFull(const Key& k);
+
+    // 从以该节点为根的子树中删除关键字k
+    void remove(const Key& k);
+
+    // 从叶节点中删除索引为idx的关键字
+    void removeFromLeaf(int idx);
+
+    // 从内部节点中删除索引为idx的关键字
+    void removeFromNonLeaf(int idx);
+
+    // 获取索引为idx的关键字的前驱（中序遍历意义上的前一个关键字）
+    Key getPredecessor(int idx);
+
+    // 获取索引为idx的关键字的后继（中序遍历意义上的后一个关键字）
+    Key getSuccessor(int idx);
+
+    // 填充索引为idx的子节点，确保它至少包含t个关键字
+    void fill(int idx);
+
+    // 从左兄弟节点（索引为idx-1）借一个关键字
+    void borrowFromPrev(int idx);
+
+    // 从右兄弟节点（索引为idx+1）借一个关键字
+    void borrowFromNext(int idx);
+
+    // 合并索引为idx的子节点与其右兄弟节点
+    void merge(int idx);
+
+    // 在当前节点的关键字数组中查找关键字k的位置
+    int findKey(const Key& k);
+};
+
+// B树类定义
+template<typename Key, typename Compare = std::less<Key>>
+class BTree {
+public:
+    using Node = BTreeNode<Key, Compare>;
+
+private:
+    Node* root;       // 指向B树根节点的指针
+    int t;            // B树的最小度数
+    Compare comp;     // 关键字比较器
+
+public:
+    // 构造函数：创建一个具有指定最小度数的空B树
+    explicit BTree(int _t, const Compare& _comp = Compare()) : comp(_comp) {
+        root = nullptr;
+        t = _t;
+        TRACE_STEP("创建了一个最小度数为 " << t << " 的B树" << std::endl);
+        TRACE_STEP("每个节点最少包含 " << (t-1) << " 个关键字" << std::endl);
+        TRACE_STEP("每个节点最多包含 " << (2*t-1) << " 个关键字" << std::endl);
+    }
+
+    // 析构函数：释放整棵B树
+    ~BTree() {
+        delete root;
+    }
+
+    // 禁止拷贝，节点由B树独占
+    BTree(const BTree&) = delete;
+    BTree& operator=(const BTree&) = delete;
+
+    // 中序遍历整个B树，按从小到大的顺序对每个关键字调用visit
+    template<typename Visitor>
+    void traverse(Visitor visit) const {
+        if (root != nullptr)
+            root->traverse(visit);
+    }
+
+    // 获取根节点，树为空时返回nullptr
+    const Node* getRoot() const {
+        return root;
+    }
+
+    // 在B树中搜索关键字k
+    Node* search(const Key& k) {
+        TRACE_STEP("正在搜索关键字 " << k << "..." << std::endl);
+        Node* result = (root == nullptr) ? nullptr : root->search(k);
+        if (result != nullptr) {
+            TRACE_STEP("✓ 找到关键字 " << k << std::endl);
+        } else {
+            TRACE_STEP("✗ 未找到关键字 " << k << std::endl);
+        }
+        return result;
+    }
+
+    // 向B树中插入关键字k
+    void insert(const Key& k);
+
+    // 从B树中删除关键字k
+    void remove(const Key& k);
+};
+
+// BTreeNode构造函数实现
+template<typename Key, typename Compare>
+BTreeNode<Key, Compare>::BTreeNode(int _t, bool _leaf, const Compare& _comp) : comp(_comp) {
+    t = _t;
+    leaf = _leaf;
+    keys.resize(2 * t - 1);      // 关键字数组大小为2t-1
+    children.resize(2 * t);       // 子节点指针数组大小为2t
+    n = 0;                        // 初始时节点中没有关键字
+}
+
+// 遍历节点实现（中序遍历）
+template<typename Key, typename Compare>
+template<typename Visitor>
+void BTreeNode<Key, Compare>::traverse(Visitor& visit) const {
+    // 遍历所有关键字及其对应的子树
+    int i;
+    for (i = 0; i < n; i++) {
+        // 如果不是叶节点，先遍历左边的子树
+        if (!leaf)
+            children[i]->traverse(visit);
+        // 访问当前关键字
+        visit(keys[i]);
+    }
+
+    // 遍历最右边的子树（对应于最后一个关键字的右侧）
+    if (!leaf)
+        children[i]->traverse(visit);
+}
+
+// 搜索关键字实现
+template<typename Key, typename Compare>
+BTreeNode<Key, Compare>* BTreeNode<Key, Compare>::search(const Key& k) {
+    // 在当前节点的关键字中查找k的位置
+    int i = 0;
+    while (i < n && comp(keys[i], k))
+        i++;
+
+    // 如果找到了关键字k，返回当前节点
+    if (i < n && !comp(k, keys[i]))
+        return this;
+
+    // 如果是叶节点且未找到k，说明k不在树中
+    if (leaf)
+        return nullptr;
+
+    // 递归搜索对应的子树
+    return children[i]->search(k);
+}
+
+// 查找关键字索引实现
+template<typename Key, typename Compare>
+int BTreeNode<Key, Compare>::findKey(const Key& k) {
+    int idx = 0;
+    // 找到第一个大于等于k的关键字位置
+    while (idx < n && comp(keys[idx], k))
+        ++idx;
+    return idx;
+}
+
+// 插入关键字实现
+template<typename Key, typename Compare>
+void BTree<Key, Compare>::insert(const Key& k) {
+    TRACE_STEP("\n--- 插入关键字 " << k << " ---" << std::endl);
+    
+    // 如果树为空，创建根节点
+    if (root == nullptr) {
+        TRACE_STEP("树为空，创建新的根节点..." << std::endl);
+        root = new Node(t, true, comp);
+        root->keys[0] = k;
+        root->n = 1;
+        TRACE_STEP("✓ 关键字 " << k << " 已插入到根节点" << std::endl);
+    } else {
+        // 如果根节点已满（包含2t-1个关键字）
+        if (root->n == 2 * t - 1) {
+            TRACE_STEP("根节点已满（" << root->n << "个关键字），需要分裂..." << std::endl);
+            
+            // 创建新的根节点
+            Node* s = new Node(t, false, comp);
+            s->children[0] = root;
+            
+            // 分裂原来的根节点
+            s->splitChild(0, root);
+            
+            // 决定k应该插入到哪个子节点中
+            int i = 0;
+            if (comp(s->keys[0], k))
+                i++;
+            s->children[i]->insertNonFull(k);
+            
+            // 更新根节点
+            root = s;
+            TRACE_STEP("✓ 根节点分裂完成，新的根节点已建立" << std::endl);
+        } else {
+            // 根节点未满，直接插入
+            root->insertNonFull(k);
+        }
+    }
+}
+
+// 分裂子节点实现
+template<typename Key, typename Compare>
+void BTreeNode<Key, Compare>::splitChild(int i, BTreeNode* y) {
+    TRACE_STEP("  正在分裂第 " << i << " 个子节点..." << std::endl);
+    
+    // 创建新节点z来存储y的后t-1个关键字
+    BTreeNode* z = new BTreeNode(y->t, y->leaf, comp);
+    z->n = t - 1;
+    
+    TRACE_STEP("    创建新节点，将包含 " << (t-1) << " 个关键字" << std::endl);
+    
+    // 将y的后t-1个关键字复制到z
+    for (int j = 0; j < t - 1; j++) {
+        z->keys[j] = y->keys[j + t];
+        TRACE_STEP("    将关键字 " << y->keys[j + t] << " 复制到新节点" << std::endl);
+    }
+    
+    // 如果y不是叶节点，还需要复制子节点指针
+    if (!y->leaf) {
+        for (int j = 0; j < t; j++) {
+            z->children[j] = y->children[j + t];
+            TRACE_STEP("    将子节点指针 " << j << " 复制到新节点" << std::endl);
+        }
+    }
+    
+    // 更新y中的关键字数量
+    y->n = t - 1;
+    TRACE_STEP("    原节点关键字数量更新为 " << y->n << std::endl);
+    
+    // 为新节点z在当前节点中创建空间
+    for (int j = n; j >= i + 1; j--) {
+        children[j + 1] = children[j];
+    }
+    
+    // 将新节点z连接为当前节点的子节点
+    children[i + 1] = z;
+    TRACE_STEP("    将新节点连接为第 " << (i+1) << " 个子节点" << std::endl);
+    
+    // 将y的中间关键字上移到当前节点
+    for (int j = n - 1; j >= i; j--) {
+        keys[j + 1] = keys[j];
+    }
+    
+    keys[i] = y->keys[t - 1];
+    TRACE_STEP("    将关键字 " << y->keys[t-1] << " 上移到当前节点" << std::endl);
+    
+    // 更新当前节点的关键字数量
+    n = n + 1;
+    TRACE_STEP("    当前节点关键字数量更新为 " << n << std::endl);
+}
+
+// 在非满节点中插入关键字实现
+template<typename Key, typename Compare>
+void BTreeNode<Key, Compare>::insertNonFull(const Key& k) {
+    // 从最右边的关键字开始查找插入位置
+    int i = n - 1;
+    
+    TRACE_STEP("  在非满节点中插入关键字 " << k << std::endl);
+    
+    // 如果是叶节点
+    if (leaf) {
+        TRACE_STEP("    当前节点是叶节点" << std::endl);
+        // 向右移动所有大于k的关键字
+        while (i >= 0 && comp(k, keys[i])) {
+            keys[i + 1] = keys[i];
+            i--;
+        }
+        
+        // 插入关键字k
+        keys[i + 1] = k;
+        n = n + 1;
+        TRACE_STEP("    ✓ 关键字 " << k << " 已插入，当前节点有 " << n << " 个关键字" << std::endl);
+    } else {
+        TRACE_STEP("    当前节点是内部节点" << std::endl);
+        // 找到应该插入到哪个子树中
+        while (i >= 0 && comp(k, keys[i]))
+            i--;
+        
+        // 检查选中的子节点是否已满
+        if (children[i + 1]->n == 2 * t - 1) {
+            TRACE_STEP("    第 " << (i+1) << " 个子节点已满，需要分裂..." << std::endl);
+            // 分裂满的子节点
+            splitChild(i + 1, children[i + 1]);
+            
+            // 如果需要，调整i的值
+            if (comp(keys[i + 1], k))
+                i++;
+        }
+        // 递归插入到选定的子节点中
+        children[i + 1]->insertNonFull(k);
+    }
+}
+
+// 删除关键字实现
+template<typename Key, typename Compare>
+void BTree<Key, Compare>::remove(const Key& k) {
+    TRACE_STEP("\n--- 删除关键字 " << k << " ---" << std::endl);
+    
+    // 如果树为空
+    if (!root) {
+        TRACE_STEP("✗ 树为空，无法删除" << std::endl);
+        return;
+    }
+    
+    // 调用根节点的删除方法
+    root->remove(k);
+    
+    // 如果根节点变空，需要特殊处理
+    if (root->n == 0) {
+        TRACE_STEP("根节点变空，需要调整树结构..." << std::endl);
+        Node* tmp = root;
+        // 如果根节点是叶节点，树变为空
+        if (root->leaf)
+            root = nullptr;
+        // 否则，第一个子节点成为新的根节点
+        else
+            root = root->children[0];
+        tmp->leaf = true;  // 子节点已交给新的根节点，析构时不再释放
+        delete tmp;
+        TRACE_STEP("✓ 树结构调整完成" << std::endl);
+    }
+}
+
+// 从节点中删除关键字实现
+template<typename Key, typename Compare>
+void BTreeNode<Key, Compare>::remove(const Key& k) {
+    // 查找关键字k在当前节点中的位置
+    int idx = findKey(k);
+    
+    TRACE_STEP("  在节点中查找关键字 " << k << "，索引为 " << idx << std::endl);
+    
+    // 如果关键字k在当前节点中
+    if (idx < n && !comp(k, keys[idx])) {
+        TRACE_STEP("  找到要删除的关键字 " << k << std::endl);
+        // 根据节点类型采取不同的删除策略
+        if (leaf) {
+            TRACE_STEP("    从叶节点删除..." << std::endl);
+            removeFromLeaf(idx);
+        } else {
+            TRACE_STEP("    从内部节点删除..." << std::endl);
+            removeFromNonLeaf(idx);
+        }
+    } else {
+        // 关键字k不在当前节点中
+        if (leaf) {
+            // 如果是叶节点，说明k不在树中
+            TRACE_STEP("✗ 关键字 " << k << " 不存在于树中" << std::endl);
+            return;
+        }
+        
+        // 标记是否是最后一个子节点
+        bool flag = ((idx == n) ? true : false);
+        
+        // 如果对应的子节点关键字数量不足，需要填充
+        if (children[idx]->n < t) {
+            TRACE_STEP("    第 " << idx << " 个子节点关键字数量不足，需要填充..." << std::endl);
+            fill(idx);
+        }
+        
+        // 递归删除，根据flag决定使用哪个子节点
+        if (flag && idx > n)
+            children[idx - 1]->remove(k);
+        else
+            children[idx]->remove(k);
+    }
+}
+
+// 从叶节点中删除关键字实现
+template<typename Key, typename Compare>
+void BTreeNode<Key, Compare>::removeFromLeaf(int idx) {
+    TRACE_STEP("    从叶节点删除索引 " << idx << " 的关键字 " << keys[idx] << std::endl);
+    
+    // 将idx后面的所有关键字向前移动一位
+    for (int i = idx + 1; i < n; ++i)
+        keys[i - 1] = keys[i];
+    
+    // 减少关键字数量
+    n--;
+    TRACE_STEP("    ✓ 删除完成，当前节点有 " << n << " 个关键字" << std::endl);
+}
+
+// 从内部节点中删除关键字实现
+template<typename Key, typename Compare>
+void BTreeNode<Key, Compare>::removeFromNonLeaf(int idx) {
+    Key k = keys[idx];
+    TRACE_STEP("    从内部节点删除关键字 " << k << "（索引 " << idx << "）" << std::endl);
+    
+    // 如果左子节点有足够的关键字（至少t个）
+    if (children[idx]->n >= t) {
+        TRACE_STEP("      左子节点有足够关键字，使用前驱替换..." << std::endl);
+        // 使用前驱关键字替换k
+        Key pred = getPredecessor(idx);
+        keys[idx] = pred;
+        // 递归删除前驱关键字
+        children[idx]->remove(pred);
+    }
+    // 如果右子节点有足够的关键字（至少t个）
+    else if (children[idx + 1]->n >= t) {
+        TRACE_STEP("      右子节点有足够关键字，使用后继替换..." << std::endl);
+        // 使用后继关键字替换k
+        Key succ = getSuccessor(idx);
+        keys[idx] = succ;
+        // 递归删除后继关键字
+        children[idx + 1]->remove(succ);
+    }
+    // 如果两个子节点的关键字数量都不足，需要合并它们
+    else {
+        TRACE_STEP("      两个子节点关键字都不足，需要合并..." << std::endl);
+        merge(idx);
+        // 递归删除合并后的关键字
+        children[idx]->remove(k);
+    }
+}
+
+// 获取前驱关键字实现
+template<typename Key, typename Compare>
+Key BTreeNode<Key, Compare>::getPredecessor(int idx) {
+    TRACE_STEP("      获取关键字 " << keys[idx] << " 的前驱..." << std::endl);
+    
+    // 移动到左子树，直到到达叶节点
+    BTreeNode* cur = children[idx];
+    while (!cur->leaf)
+        cur = cur->children[cur->n];
+    
+    // 返回叶节点的最后一个关键字
+    TRACE_STEP("      前驱关键字是 " << cur->keys[cur->n - 1] << std::endl);
+    return cur->keys[cur->n - 1];
+}
+
+// 获取后继关键字实现
+template<typename Key, typename Compare>
+Key BTreeNode<Key, Compare>::getSuccessor(int idx) {
+    TRACE_STEP("      获取关键字 " << keys[idx] << " 的后继..." << std::endl);
+    
+    // 移动到右子树，直到到达叶节点
+    BTreeNode* cur = children[idx + 1];
+    while (!cur->leaf)
+        cur = cur->children[0];
+    
+    // 返回叶节点的第一个关键字
+    TRACE_STEP("      后继关键字是 " << cur->keys[0] << std::endl);
+    return cur->keys[0];
+}
+
+// 填充子节点实现
+template<typename Key, typename Compare>
+void BTreeNode<Key, Compare>::fill(int idx) {
+    TRACE_STEP("      填充第 " << idx << " 个子节点..." << std::endl);
+    
+    // 如果左兄弟节点有额外的关键字（超过t-1个）
+    if (idx != 0 && children[idx - 1]->n >= t) {
+        TRACE_STEP("        从前一个兄弟节点（索引 " << (idx-1) << "）借关键字..." << std::endl);
+        borrowFromPrev(idx);
+    }
+    // 如果右兄弟节点有额外的关键字（超过t-1个）
+    else if (idx != n && children[idx + 1]->n >= t) {
+        TRACE_STEP("        从后一个兄弟节点（索引 " << (idx+1) << "）借关键字..." << std::endl);
+        borrowFromNext(idx);
+    }
+    // 否则，合并节点
+    else {
+        if (idx != n) {
+            TRACE_STEP("        与后一个兄弟节点（索引 " << (idx+1) << "）合并..." << std::endl);
+            merge(idx);
+        } else {
+            TRACE_STEP("        与前一个兄弟节点（索引 " << (idx-1) << "）合并..." << std::endl);
+            merge(idx - 1);
+        }
+    }
+}
+
+// 从前一个兄弟节点借关键字实现
+template<typename Key, typename Compare>
+void BTreeNode<Key, Compare>::borrowFromPrev(int idx) {
+    TRACE_STEP("        从前一个兄弟节点(" << (idx-1) << ")借关键字到子节点(" << idx << ")" << std::endl);
+    
+    BTreeNode* child = children[idx];
+    BTreeNode* sibling = children[idx - 1];
+    
+    // 将child的所有关键字向后移动一位
+    for (int i = child->n - 1; i >= 0; --i)
+        child->keys[i + 1] = child->keys[i];
+    
+    // 如果child不是叶节点，移动所有子指针
+    if (!child->leaf) {
+        for (int i = child->n; i >= 0; --i)
+            child->children[i + 1] = child->children[i];
+    }
+    
+    // 将父节点的关键字复制到child的第一个位置
+    child->keys[0] = keys[idx - 1];
+    TRACE_STEP("          将父节点关键字 " << keys[idx - 1] << " 复制到子节点" << std::endl);
+    
+    // 如果child不是叶节点，将sibling的最后一个子节点复制到child的第一个位置
+    if (!child->leaf)
+        child->children[0] = sibling->children[sibling->n];
+    
+    // 将sibling的最后一个关键字上移到父节点
+    keys[idx - 1] = sibling->keys[sibling->n - 1];
+    TRACE_STEP("          将兄弟节点关键字 " << sibling->keys[sibling->n - 1] << " 上移到父节点" << std::endl);
+    
+    // 更新关键字数量
+    child->n += 1;
+    sibling->n -= 1;
+    
+    TRACE_STEP("        ✓ 借关键字完成" << std::endl);
+}
+
+// 从后一个兄弟节点借关键字实现
+template<typename Key, typename Compare>
+void BTreeNode<Key, Compare>::borrowFromNext(int idx) {
+    TRACE_STEP("        从后一个兄弟节点(" << (idx+1) << ")借关键字到子节点(" << idx << ")" << std::endl);
+    
+    BTreeNode* child = children[idx];
+    BTreeNode* sibling = children[idx + 1];
+    
+    // 将父节点的关键字复制到child的最后位置
+    child->keys[(child->n)] = keys[idx];
+    TRACE_STEP("          将父节点关键字 " << keys[idx] << " 复制到子节点" << std::endl);
+    
+    // 如果child不是叶节点，将sibling的第一个子节点复制到child的最后位置
+    if (!(child->leaf))
+        child->children[(child->n) + 1] = sibling->children[0];
+    
+    // 将sibling的第一个关键字上移到父节点
+    keys[idx] = sibling->keys[0];
+    TRACE_STEP("          将兄弟节点关键字 " << sibling->keys[0] << " 上移到父节点" << std::endl);
+    
+    // 将sibling的所有关键字向前移动一位
+    for (int i = 1; i < sibling->n; ++i)
+        sibling->keys[i - 1] = sibling->keys[i];
+    
+    // 如果sibling不是叶节点，移动所有子指针
+    if (!sibling->leaf) {
+        for (int i = 1; i <= sibling->n; ++i)
+            sibling->children[i - 1] = sibling->children[i];
+    }
+    
+    // 更新关键字数量
+    child->n += 1;
+    sibling->n -= 1;
+    
+    TRACE_STEP("        ✓ 借关键字完成" << std::endl);
+}
+
+// 合并子节点实现
+template<typename Key, typename Compare>
+void BTreeNode<Key, Compare>::merge(int idx) {
+    TRACE_STEP("        合并第 " << idx << " 个子节点和第 " << (idx+1) << " 个子节点..." << std::endl);
+    
+    BTreeNode* child = children[idx];
+    BTreeNode* sibling = children[idx + 1];
+    
+    // 将父节点的关键字复制到child的中间位置
+    child->keys[t - 1] = keys[idx];
+    TRACE_STEP("          将父节点关键字 " << keys[idx] << " 复制到合并节点" << std::endl);
+    
+    // 将sibling的所有关键字复制到child的后半部分
+    for (int i = 0; i < sibling->n; ++i) {
+        child->keys[i + t] = sibling->keys[i];
+        TRACE_STEP("          复制兄弟节点关键字 " << sibling->keys[i] << " 到合并节点" << std::endl);
+    }
+    
+    // 如果child不是叶节点，复制sibling的所有子指针
+    if (!child->leaf) {
+        for (int i = 0; i <= sibling->n; ++i) {
+            child->children[i + t] = sibling->children[i];
+            TRACE_STEP("          复制兄弟节点子指针 " << i << " 到合并节点" << std::endl);
+        }
+    }
+    
+    // 将父节点中的关键字向前移动
+    for (int i = idx + 1; i < n; ++i)
+        keys[i - 1] = keys[i];
+    
+    // 将父节点的子指针向前移动
+    for (int i = idx + 2; i <= n; ++i)
+        children[i - 1] = children[i];
+    
+    // 更新关键字数量
+    child->n += sibling->n + 1;
+    n--;
+    
+    TRACE_STEP("          合并完成，子节点现在有 " << child->n << " 个关键字" << std::endl);
+    
+    // 删除sibling节点（其子节点已转移到child，析构时不再释放）
+    sibling->leaf = true;
+    delete sibling;
+}
+
+#endif //CLRS_C5_U18_B_TREE_H
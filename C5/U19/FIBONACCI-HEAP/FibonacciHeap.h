@@ -0,0 +1,500 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#ifndef CLRS_C5_U19_FIBONACCI_HEAP_H
+#define CLRS_C5_U19_FIBONACCI_HEAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "common/NodePool.h"
+#include "common/Trace.h"
+
+/**
+ * 斐波那契堆实现示例程序
+ * 
+ * 本程序演示了《算法导论》第19章斐波那契堆的概念和操作
+ * 斐波那契堆是一种高效的优先队列数据结构，支持高效的插入、
+ * 查找最小值和合并操作，并且在图算法中有重要应用。
+ * 
+ * 斐波那契堆的主要特点：
+ * 1. 插入操作: O(1) 摊还时间复杂度
+ * 2. 合并操作: O(1) 实际时间复杂度
+ * 3. 抽取最小节点: O(log n) 摊还时间复杂度
+ * 4. 减小关键字: O(1) 摊还时间复杂度
+ * 5. 删除节点: O(log n) 摊还时间复杂度
+ *
+ * 节点从堆自己的节点池（NodePool）中分配：插入不调用 malloc，
+ * 清空或销毁堆时按 slab 整块释放，不逐个遍历、释放节点。
+ */
+
+// 斐波那契堆节点结构
+struct FibonacciNode {
+    int key;                         // 节点的关键字
+    int degree;                      // 节点的度数（子节点数量）
+    bool mark;                       // 标记位，用于删除操作
+    FibonacciNode* parent;           // 指向父节点的指针
+    FibonacciNode* child;            // 指向某个子节点的指针
+    FibonacciNode* left;             // 指向左兄弟节点的指针
+    FibonacciNode* right;            // 指向右兄弟节点的指针
+
+    // 构造函数
+    FibonacciNode(int k) : key(k), degree(0), mark(false), 
+                          parent(nullptr), child(nullptr), 
+                          left(this), right(this) {
+        TRACE_STEP("    创建新节点，关键字为 " << k << std::endl);
+    }
+};
+
+/**
+ * 斐波那契堆的操作统计，用于分析 extractMin 的延迟尖峰：
+ * 一次 extractMin 的实际代价正比于合并时根列表的长度加上链接次数，
+ * 而根列表的长度由此前的插入、合并与切断（包括级联切断）累积而来
+ */
+struct FibonacciHeapStats {
+    uint64_t consolidations = 0;    // 合并操作(CONSOLIDATE)的次数
+    uint64_t links = 0;             // 链接次数
+    uint64_t rootsScanned = 0;      // 各次合并扫描的根节点总数
+    size_t lastRootListLength = 0;  // 最近一次合并时根列表的长度
+    size_t maxRootListLength = 0;   // 合并时根列表的最大长度
+    uint64_t cuts = 0;              // 减小关键字直接引起的切断次数
+    uint64_t cascadingCuts = 0;     // 级联切断次数
+};
+
+// 斐波那契堆类
+class FibonacciHeap {
+private:
+    FibonacciNode* min;     // 指向最小节点的指针
+    int n;                  // 堆中节点总数
+    std::vector<FibonacciNode*> rank; // 合并时按度数索引的数组，各次合并之间复用，合并结束时全部为 nullptr
+    std::vector<FibonacciNode*> roots; // 合并时根列表的快照，各次合并之间复用
+    FibonacciHeapStats counters; // 操作统计
+    NodePool<FibonacciNode> pool; // 本堆全部节点（包括已抽取、尚未归还的节点）所在的节点池
+
+public:
+    // 节点类型，与 PairingHeap、RadixHeap 一致，便于写出对三者通用的代码
+    using Node = FibonacciNode;
+
+    // 构造函数
+    FibonacciHeap() : min(nullptr), n(0) {
+        TRACE_STEP("  创建空的斐波那契堆" << std::endl);
+    }
+
+    // 析构函数
+    ~FibonacciHeap() {
+        clear();
+    }
+
+    // 插入关键字
+    FibonacciNode* insert(int key);
+
+    // 查找最小关键字
+    FibonacciNode* minimum() { 
+        TRACE_STEP("  查找最小关键字: " << (min ? std::to_string(min->key) : "堆为空") << std::endl);
+        return min; 
+    }
+
+    /**
+     * 抽取最小关键字，堆为空时返回 nullptr
+     * 返回的节点仍属于本堆的节点池，在 release()、clear() 或堆销毁之前有效，调用者不能 delete
+     */
+    FibonacciNode* extractMin();
+
+    // 把 extractMin() 返回的节点归还节点池，供之后的插入复用
+    void release(FibonacciNode* x) { pool.destroy(x); }
+
+    /**
+     * 合并两个斐波那契堆，other 随后为空
+     * other 的节点连同所在的 slab 一起转入本堆的节点池，other 之后仍可继续使用
+     */
+    void unite(FibonacciHeap& other);
+
+    // 减小关键字的值
+    void decreaseKey(FibonacciNode* x, int k);
+
+    // 删除节点
+    void deleteNode(FibonacciNode* x);
+
+    // 清空堆：作废全部节点（包括已抽取、尚未归还的节点），保留节点池的内存供之后复用
+    void clear();
+
+    // 获取节点数量
+    int size() const { return n; }
+
+    // 获取最小节点（不输出追踪信息），可由此遍历根列表
+    FibonacciNode* getMin() const { return min; }
+
+    // 获取操作统计
+    const FibonacciHeapStats& stats() const { return counters; }
+
+    // 清零操作统计
+    void resetStats() { counters = FibonacciHeapStats(); }
+
+private:
+    // 将节点插入根列表
+    void insertToRootList(FibonacciNode* node);
+
+    // 将节点从兄弟列表中移除
+    void removeFromList(FibonacciNode* node);
+
+    // 合并两个节点
+    void link(FibonacciNode* y, FibonacciNode* x);
+
+    // 维护最小节点指针
+    void consolidate();
+
+    /**
+     * n 个节点的堆中度数的上界：D(n) <= floor(log_phi(n))（引理19.4）
+     * log_phi(n) = log2(n) / log2(phi) < 1.4405 * log2(n)，用二进制位数估计，不调用 std::log
+     */
+    static int maxDegreeBound(int n) {
+        int bits = 32 - __builtin_clz(static_cast<unsigned>(n));
+        return static_cast<int>(bits * 1.4405) + 1;
+    }
+
+    // 切断父子关系
+    void cut(FibonacciNode* x, FibonacciNode* y);
+
+    // 递归标记和切断
+    void cascadingCut(FibonacciNode* y);
+};
+
+// 插入关键字
+inline FibonacciNode* FibonacciHeap::insert(int key) {
+    TRACE_STEP("\n--- 插入关键字 " << key << " ---" << std::endl);
+    
+    FibonacciNode* node = pool.create(key);
+    if (min == nullptr) {
+        TRACE_STEP("    堆为空，设置为根节点" << std::endl);
+        min = node;
+    } else {
+        TRACE_STEP("    将节点插入根列表" << std::endl);
+        insertToRootList(node);
+        if (key < min->key) {
+            TRACE_STEP("    新节点关键字更小，更新最小节点指针" << std::endl);
+            min = node;
+        }
+    }
+    n++;
+    TRACE_STEP("  ✓ 插入完成，堆中节点总数: " << n << std::endl);
+    return node;
+}
+
+// 将节点插入根列表
+inline void FibonacciHeap::insertToRootList(FibonacciNode* node) {
+    TRACE_STEP("    执行插入到根列表操作" << std::endl);
+    node->left = min;
+    node->right = min->right;
+    min->right->left = node;
+    min->right = node;
+}
+
+// 将节点从兄弟列表中移除
+inline void FibonacciHeap::removeFromList(FibonacciNode* node) {
+    TRACE_STEP("    从兄弟列表中移除节点" << std::endl);
+    node->left->right = node->right;
+    node->right->left = node->left;
+}
+
+// 抽取最小关键字
+inline FibonacciNode* FibonacciHeap::extractMin() {
+    TRACE_STEP("\n--- 抽取最小关键字 ---" << std::endl);
+    
+    FibonacciNode* z = min;
+    if (z != nullptr) {
+        TRACE_STEP("  当前最小节点关键字: " << z->key << std::endl);
+        
+        // 将z的每个子节点添加到根列表中
+        if (z->child != nullptr) {
+            TRACE_STEP("  将最小节点的子节点添加到根列表" << std::endl);
+            FibonacciNode* child = z->child;
+            do {
+                FibonacciNode* next = child->right;
+                TRACE_STEP("    添加子节点 " << child->key << std::endl);
+                child->parent = nullptr;
+                insertToRootList(child);
+                child = next;
+            } while (child != z->child);
+        }
+
+        // 从根列表中移除z
+        TRACE_STEP("  从根列表中移除最小节点" << std::endl);
+        removeFromList(z);
+        
+        // 如果z是唯一节点
+        if (z == z->right) {
+            TRACE_STEP("  最小节点是唯一的根节点" << std::endl);
+            min = nullptr;
+        } else {
+            TRACE_STEP("  设置新的候选最小节点并执行合并操作" << std::endl);
+            min = z->right;
+            consolidate();
+        }
+        
+        n--;
+        TRACE_STEP("  ✓ 抽取完成，抽取的关键字: " << z->key << "，剩余节点数: " << n << std::endl);
+    } else {
+        TRACE_STEP("  堆为空，无法抽取" << std::endl);
+    }
+    return z;
+}
+
+// 合并两个节点
+inline void FibonacciHeap::link(FibonacciNode* y, FibonacciNode* x) {
+    TRACE_STEP("    链接操作：将节点 " << y->key << " 链接到节点 " << x->key << std::endl);
+    TRACE_COUNT("fibonacciHeap.links");
+    counters.links++;
+    
+    // 从根列表中移除y
+    removeFromList(y);
+    y->parent = x;
+
+    // 将y作为x的子节点
+    if (x->child == nullptr) {
+        TRACE_STEP("      节点 " << x->key << " 没有子节点，直接设置" << std::endl);
+        x->child = y;
+        y->left = y;
+        y->right = y;
+    } else {
+        TRACE_STEP("      节点 " << x->key << " 已有子节点，插入到子节点列表" << std::endl);
+        y->left = x->child;
+        y->right = x->child->right;
+        x->child->right->left = y;
+        x->child->right = y;
+    }
+    
+    x->degree++;
+    y->mark = false;
+    TRACE_STEP("    链接完成，节点 " << x->key << " 的度数变为 " << x->degree << std::endl);
+}
+
+// 维护最小节点指针
+inline void FibonacciHeap::consolidate() {
+    TRACE_STEP("  执行合并操作(CONSOLIDATE)..." << std::endl);
+    
+    int maxDegree = maxDegreeBound(n);
+    TRACE_STEP("    最大可能度数: " << maxDegree << std::endl);
+    
+    // 度数数组只在上界变大时扩容，重建根列表时逐项清空，留给下一次合并
+    if (rank.size() < static_cast<size_t>(maxDegree) + 1) {
+        rank.resize(maxDegree + 1, nullptr);
+    }
+
+    // 链接会改动根列表，先把根节点记入快照缓冲区
+    roots.clear();
+    FibonacciNode* current = min;
+    do {
+        roots.push_back(current);
+        current = current->right;
+    } while (current != min);
+    
+    TRACE_STEP("    根列表中有 " << roots.size() << " 个节点" << std::endl);
+    counters.consolidations++;
+    counters.rootsScanned += roots.size();
+    counters.lastRootListLength = roots.size();
+    if (roots.size() > counters.maxRootListLength) {
+        counters.maxRootListLength = roots.size();
+    }
+
+    // 遍历根列表中的每个节点
+    for (FibonacciNode* w : roots) {
+        FibonacciNode* x = w;
+        int d = x->degree;
+        TRACE_STEP("    处理节点 " << x->key << " (度数: " << d << ")" << std::endl);
+        
+        while (rank[d] != nullptr) {
+            FibonacciNode* y = rank[d];
+            TRACE_STEP("      发现度数相同的节点 " << y->key << std::endl);
+            
+            if (x->key > y->key) {
+                TRACE_STEP("      交换节点以确保最小节点在前" << std::endl);
+                std::swap(x, y);
+            }
+            
+            link(y, x);
+            rank[d] = nullptr;
+            d++;
+            TRACE_STEP("      度数增加到 " << d << std::endl);
+        }
+        rank[d] = x;
+        TRACE_STEP("      将节点 " << x->key << " 存储在位置 " << d << std::endl);
+    }
+
+    // 重建根列表，更新最小节点
+    TRACE_STEP("    重建根列表..." << std::endl);
+    min = nullptr;
+    for (int i = 0; i <= maxDegree; i++) {
+        if (rank[i] != nullptr) {
+            FibonacciNode* x = rank[i];
+            rank[i] = nullptr;
+            TRACE_STEP("      处理度数为 " << i << " 的节点 " << x->key << std::endl);
+            if (min == nullptr) {
+                min = x;
+                min->left = min;
+                min->right = min;
+                TRACE_STEP("        设置为新的最小节点" << std::endl);
+            } else {
+                insertToRootList(x);
+                if (x->key < min->key) {
+                    TRACE_STEP("        发现更小节点，更新最小节点指针" << std::endl);
+                    min = x;
+                }
+            }
+        }
+    }
+    
+    TRACE_STEP("  ✓ 合并操作完成" << std::endl);
+}
+
+// 合并两个斐波那契堆
+inline void FibonacciHeap::unite(FibonacciHeap& other) {
+    TRACE_STEP("\n--- 合并两个斐波那契堆 ---" << std::endl);
+    TRACE_STEP("  当前堆节点数: " << n << ", 另一个堆节点数: " << other.n << std::endl);
+    
+    // 节点的内存随节点一起转入本堆；other 为空时也接管它已抽取、尚未归还的节点
+    pool.splice(other.pool);
+
+    if (other.min == nullptr) {
+        TRACE_STEP("  另一个堆为空，无需合并" << std::endl);
+        return;
+    }
+    
+    if (min == nullptr) {
+        TRACE_STEP("  当前堆为空，直接复制另一个堆" << std::endl);
+        min = other.min;
+        n = other.n;
+        other.min = nullptr;
+        other.n = 0;
+        return;
+    }
+
+    // 连接两个根列表
+    TRACE_STEP("  连接两个根列表" << std::endl);
+    min->right->left = other.min->left;
+    other.min->left->right = min->right;
+    min->right = other.min;
+    other.min->left = min;
+
+    // 更新最小节点
+    if (other.min->key < min->key) {
+        TRACE_STEP("  另一个堆的最小节点更小，更新最小节点指针" << std::endl);
+        min = other.min;
+    }
+    
+    n += other.n;
+    TRACE_STEP("  ✓ 合并完成，总节点数: " << n << std::endl);
+    
+    // 清空other堆，避免重复删除节点
+    other.min = nullptr;
+    other.n = 0;
+}
+
+// 减小关键字的值
+inline void FibonacciHeap::decreaseKey(FibonacciNode* x, int k) {
+    TRACE_STEP("\n--- 减小节点关键字 ---" << std::endl);
+    TRACE_STEP("  将节点 " << x->key << " 的关键字减小到 " << k << std::endl);
+    
+    if (k > x->key) {
+        TRACE_STEP("  ✗ 错误：新关键字大于原关键字，操作无效" << std::endl);
+        return;
+    }
+    
+    x->key = k;
+    FibonacciNode* y = x->parent;
+    
+    if (y != nullptr && x->key < y->key) {
+        TRACE_STEP("  节点 " << x->key << " 违反了最小堆性质，需要切断" << std::endl);
+        cut(x, y);
+        counters.cuts++;
+        cascadingCut(y);
+    }
+    
+    if (x->key < min->key) {
+        TRACE_STEP("  节点 " << x->key << " 成为新的最小节点" << std::endl);
+        min = x;
+    }
+    
+    TRACE_STEP("  ✓ 关键字减小完成" << std::endl);
+}
+
+// 切断父子关系
+inline void FibonacciHeap::cut(FibonacciNode* x, FibonacciNode* y) {
+    TRACE_STEP("    切断操作：切断节点 " << x->key << " 与其父节点 " << y->key << " 的连接" << std::endl);
+    
+    // 从y的子节点列表中移除x
+    if (x->right == x) {
+        y->child = nullptr;
+        TRACE_STEP("      节点 " << y->key << " 失去唯一子节点" << std::endl);
+    } else {
+        x->left->right = x->right;
+        x->right->left = x->left;
+        if (y->child == x) {
+            y->child = x->right;
+        }
+        TRACE_STEP("      从节点 " << y->key << " 的子节点列表中移除节点 " << x->key << std::endl);
+    }
+    
+    y->degree--;
+    TRACE_STEP("      节点 " << y->key << " 的度数减少到 " << y->degree << std::endl);
+    
+    // 将x添加到根列表
+    TRACE_STEP("      将节点 " << x->key << " 添加到根列表" << std::endl);
+    insertToRootList(x);
+    x->parent = nullptr;
+    x->mark = false;
+    TRACE_STEP("      节点 " << x->key << " 的标记重置为false" << std::endl);
+}
+
+// 递归标记和切断
+inline void FibonacciHeap::cascadingCut(FibonacciNode* y) {
+    TRACE_STEP("    级联切断：处理节点 " << y->key << std::endl);
+    
+    FibonacciNode* z = y->parent;
+    if (z != nullptr) {
+        if (!y->mark) {
+            TRACE_STEP("      节点 " << y->key << " 首次失去子节点，设置标记" << std::endl);
+            y->mark = true;
+        } else {
+            TRACE_STEP("      节点 " << y->key << " 再次失去子节点，执行切断并继续级联" << std::endl);
+            cut(y, z);
+            TRACE_COUNT("fibonacciHeap.cascadingCuts");
+            counters.cascadingCuts++;
+            cascadingCut(z);
+        }
+    } else {
+        TRACE_STEP("      节点 " << y->key << " 是根节点，无需进一步处理" << std::endl);
+    }
+}
+
+// 删除节点
+inline void FibonacciHeap::deleteNode(FibonacciNode* x) {
+    TRACE_STEP("\n--- 删除节点 " << x->key << " ---" << std::endl);
+    
+    TRACE_STEP("  将节点关键字减小到负无穷" << std::endl);
+    decreaseKey(x, std::numeric_limits<int>::min());
+    TRACE_STEP("  抽取最小节点以完成删除" << std::endl);
+    release(extractMin());
+    
+    TRACE_STEP("  ✓ 节点删除成功" << std::endl);
+}
+
+// 清空堆
+inline void FibonacciHeap::clear() {
+    TRACE_STEP("清空斐波那契堆..." << std::endl);
+    if (min == nullptr) {
+        TRACE_STEP("堆已为空" << std::endl);
+    } else {
+        TRACE_STEP("✓ 已释放 " << n << " 个节点" << std::endl);
+    }
+
+    // 节点都是平凡析构的，不必遍历各棵树，整个节点池一次作废
+    pool.reset();
+    min = nullptr;
+    n = 0;
+}
+
+#endif //CLRS_C5_U19_FIBONACCI_HEAP_H
@@ -0,0 +1,58 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#include <iostream>
+#include <vector>
+
+#include "PairingHeap.h"
+
+// 依次抽取全部节点并打印关键字
+void drain(PairingHeap& heap) {
+    while (PairingNode* node = heap.extractMin()) {
+        std::cout << node->key << " ";
+        heap.release(node);
+    }
+    std::cout << std::endl;
+}
+
+int main() {
+#ifdef ACM_LOCAL
+    freopen("data.in", "r", stdin);
+    freopen("data.out", "w", stdout);
+#endif
+    std::cout << "========================================" << std::endl;
+    std::cout << "        配对堆演示" << std::endl;
+    std::cout << "========================================" << std::endl << std::endl;
+
+    // 与斐波那契堆演示相同的关键字
+    PairingHeap heap;
+    std::vector<PairingNode*> nodes;
+    int keys[] = {23, 7, 21, 3, 18, 52, 38, 41, 39, 35};
+    for (int key : keys) {
+        nodes.push_back(heap.insert(key));
+    }
+    std::cout << "插入 10 个关键字后，最小关键字: " << heap.minimum()->key << "，节点数: " << heap.size() << std::endl;
+
+    PairingNode* extracted = heap.extractMin();
+    std::cout << "抽取的最小关键字: " << extracted->key << std::endl;
+    heap.release(extracted);
+
+    heap.decreaseKey(nodes[5], 2);
+    std::cout << "把 52 减小为 2 后，最小关键字: " << heap.minimum()->key << std::endl;
+
+    heap.deleteNode(nodes[2]);
+    std::cout << "删除关键字 21 后，节点数: " << heap.size() << std::endl;
+
+    PairingHeap other;
+    for (int key : {17, 4, 30}) {
+        other.insert(key);
+    }
+    heap.unite(other);
+    std::cout << "合并 {17, 4, 30} 后依次抽取: ";
+    drain(heap);
+
+    std::cout << std::endl << "========================================" << std::endl;
+    std::cout << "配对堆演示完成!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,213 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#ifndef CLRS_C5_U19_PAIRING_HEAP_H
+#define CLRS_C5_U19_PAIRING_HEAP_H
+
+#include <utility>
+#include <vector>
+
+#include "common/Trace.h"
+
+/**
+ * 配对堆（Fredman、Sedgewick、Sleator、Tarjan，1986）
+ *
+ * 与斐波那契堆的接口相同（insert / minimum / extractMin / decreaseKey / unite / deleteNode），
+ * 结构却简单得多：一棵堆序的多叉树，每个结点只保存第一个子结点和左右兄弟，没有度数、标记和根列表。
+ * - insert、unite、decreaseKey：与根比较一次、链接一次，O(1)；
+ * - extractMin：删除根后把子结点两两配对链接，再从右到左依次链接，摊还 O(log n)。
+ * decreaseKey 的摊还界理论上为 O(2^(2√(log log n)))，实际中通常比斐波那契堆更快。
+ */
+
+// 配对堆节点结构
+struct PairingNode {
+    int key;                 // 节点的关键字
+    PairingNode* child;      // 第一个子节点
+    PairingNode* next;       // 右兄弟
+    PairingNode* prev;       // 左兄弟；若为第一个子节点则指向父节点，根节点为 nullptr
+
+    explicit PairingNode(int k) : key(k), child(nullptr), next(nullptr), prev(nullptr) {}
+};
+
+// 配对堆类
+class PairingHeap {
+public:
+    using Node = PairingNode;
+
+    PairingHeap() : root(nullptr), n(0) {}
+
+    ~PairingHeap() {
+        clear();
+    }
+
+    PairingHeap(const PairingHeap&) = delete;
+    PairingHeap& operator=(const PairingHeap&) = delete;
+
+    // 插入关键字
+    PairingNode* insert(int key) {
+        PairingNode* node = new PairingNode(key);
+        root = root == nullptr ? node : link(root, node);
+        n++;
+        TRACE_STEP("  插入关键字 " << key << "，堆顶: " << root->key << std::endl);
+        return node;
+    }
+
+    // 查找最小关键字
+    PairingNode* minimum() const {
+        return root;
+    }
+
+    /**
+     * 抽取最小关键字，返回的节点由调用者用 release() 释放；堆为空时返回 nullptr
+     */
+    PairingNode* extractMin() {
+        PairingNode* z = root;
+        if (z != nullptr) {
+            root = combineSiblings(z->child);
+            z->child = nullptr;
+            n--;
+            TRACE_STEP("  抽取最小关键字 " << z->key << "，剩余节点数: " << n << std::endl);
+        }
+        return z;
+    }
+
+    // 释放 extractMin() 返回的节点
+    void release(PairingNode* x) { delete x; }
+
+    // 合并两个配对堆，other 随后为空
+    void unite(PairingHeap& other) {
+        if (other.root == nullptr) {
+            return;
+        }
+        root = root == nullptr ? other.root : link(root, other.root);
+        n += other.n;
+        other.root = nullptr;
+        other.n = 0;
+    }
+
+    /**
+     * 减小关键字：把以 x 为根的子树从父节点下切开，再与根链接
+     * 与 FibonacciHeap 相同，新关键字大于原关键字时不做任何操作
+     */
+    void decreaseKey(PairingNode* x, int k) {
+        if (k > x->key) {
+            TRACE_STEP("  新关键字 " << k << " 大于原关键字 " << x->key << "，操作无效" << std::endl);
+            return;
+        }
+        x->key = k;
+        if (x != root) {
+            detach(x);
+            root = link(root, x);
+        }
+        TRACE_COUNT("pairingHeap.decreaseKeys");
+    }
+
+    // 删除节点：把 x 的子节点合并成一棵树，挂回堆中，再释放 x
+    void deleteNode(PairingNode* x) {
+        if (x == root) {
+            release(extractMin());
+            return;
+        }
+        detach(x);
+        PairingNode* children = combineSiblings(x->child);
+        if (children != nullptr) {
+            root = link(root, children);
+        }
+        n--;
+        delete x;
+    }
+
+    // 清空堆，释放全部节点
+    void clear() {
+        std::vector<PairingNode*> stack;
+        if (root != nullptr) {
+            stack.push_back(root);
+        }
+        while (!stack.empty()) {
+            PairingNode* node = stack.back();
+            stack.pop_back();
+            if (node->child != nullptr) stack.push_back(node->child);
+            if (node->next != nullptr) stack.push_back(node->next);
+            delete node;
+        }
+        root = nullptr;
+        n = 0;
+    }
+
+    // 获取节点数量
+    int size() const { return n; }
+
+private:
+    /**
+     * 链接两棵树的根：关键字较大的成为另一个的第一个子节点，返回新的根
+     * 两个参数都必须没有兄弟和父节点
+     */
+    static PairingNode* link(PairingNode* a, PairingNode* b) {
+        if (b->key < a->key) {
+            std::swap(a, b);
+        }
+        b->prev = a;
+        b->next = a->child;
+        if (a->child != nullptr) {
+            a->child->prev = b;
+        }
+        a->child = b;
+        TRACE_COUNT("pairingHeap.links");
+        return a;
+    }
+
+    // 把以 x 为根的子树从父节点的子节点列表中摘下
+    static void detach(PairingNode* x) {
+        if (x->prev->child == x) {
+            x->prev->child = x->next;
+        } else {
+            x->prev->next = x->next;
+        }
+        if (x->next != nullptr) {
+            x->next->prev = x->prev;
+        }
+        x->prev = nullptr;
+        x->next = nullptr;
+    }
+
+    /**
+     * 两趟合并兄弟列表：第一趟从左到右两两链接，第二趟从右到左依次链接到结果上
+     * 不用递归，兄弟列表很长时也不会栈溢出
+     */
+    static PairingNode* combineSiblings(PairingNode* first) {
+        if (first == nullptr) {
+            return nullptr;
+        }
+        // 第一趟：配对的结果用 next 串成一个逆序的列表
+        PairingNode* paired = nullptr;
+        while (first != nullptr) {
+            PairingNode* a = first;
+            PairingNode* b = a->next;
+            first = b != nullptr ? b->next : nullptr;
+            a->prev = a->next = nullptr;
+            if (b != nullptr) {
+                b->prev = b->next = nullptr;
+                a = link(a, b);
+            }
+            a->next = paired;
+            paired = a;
+        }
+        // 第二趟：从最右边的一对开始依次链接
+        PairingNode* result = paired;
+        paired = paired->next;
+        result->next = nullptr;
+        while (paired != nullptr) {
+            PairingNode* next = paired->next;
+            paired->next = nullptr;
+            result = link(result, paired);
+            paired = next;
+        }
+        return result;
+    }
+
+    PairingNode* root;  // 堆顶（最小节点）
+    int n;              // 堆中节点总数
+};
+
+#endif //CLRS_C5_U19_PAIRING_HEAP_H
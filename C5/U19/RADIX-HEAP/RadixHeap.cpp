@@ -0,0 +1,86 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#include <climits>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "RadixHeap.h"
+
+int main() {
+#ifdef ACM_LOCAL
+    freopen("data.in", "r", stdin);
+    freopen("data.out", "w", stdout);
+#endif
+    std::cout << "========================================" << std::endl;
+    std::cout << "        基数堆演示" << std::endl;
+    std::cout << "========================================" << std::endl << std::endl;
+
+    // Dijkstra 最短路径（《算法导论》图24-6）：边权非负，抽取出的距离单调不减
+    std::vector<std::vector<std::pair<int, int>>> graph = {
+        {{1, 10}, {3, 5}},          // s
+        {{2, 1}, {3, 2}},           // t
+        {{4, 4}},                   // x
+        {{1, 3}, {2, 9}, {4, 2}},   // y
+        {{0, 7}, {2, 6}},           // z
+    };
+    const char* names = "stxyz";
+    RadixHeap heap;
+    std::vector<RadixNode*> nodes(graph.size(), nullptr);
+    std::vector<int> dist(graph.size(), INT_MAX);
+    std::vector<bool> done(graph.size(), false);
+    nodes[0] = heap.insert(0);
+    dist[0] = 0;
+    std::cout << "抽取顺序:";
+    while (RadixNode* node = heap.extractMin()) {
+        int u = 0;
+        while (nodes[u] != node) u++;
+        nodes[u] = nullptr;
+        done[u] = true;
+        std::cout << " " << names[u] << "(" << node->key << ")";
+        heap.release(node);
+        for (const std::pair<int, int>& edge : graph[u]) {
+            int v = edge.first;
+            int d = dist[u] + edge.second;
+            if (done[v] || d >= dist[v]) continue;
+            dist[v] = d;
+            if (nodes[v] == nullptr) {
+                nodes[v] = heap.insert(d);
+            } else {
+                heap.decreaseKey(nodes[v], d);
+            }
+        }
+    }
+    std::cout << std::endl << "最短路径:";
+    for (size_t v = 0; v < dist.size(); v++) {
+        std::cout << " " << names[v] << "=" << dist[v];
+    }
+    std::cout << std::endl << std::endl;
+
+    // 违反单调性：插入比最近抽取的最小值更小的关键字
+    RadixHeap monotone;
+    monotone.insert(10);
+    monotone.insert(20);
+    monotone.release(monotone.extractMin());
+    try {
+        monotone.insert(5);
+    } catch (const std::invalid_argument& e) {
+        std::cout << "抽取 10 后插入 5: " << e.what() << std::endl;
+    }
+
+    // 只查看最小值不会提高下限：抽取 0 后查看到 100，仍可插入 50
+    RadixHeap peek;
+    peek.insert(0);
+    peek.insert(100);
+    peek.release(peek.extractMin());
+    std::cout << "抽取 0 后查看最小值: " << peek.minimum()->key;
+    peek.insert(50);
+    std::cout << "，插入 50 后最小值: " << peek.minimum()->key << std::endl;
+
+    std::cout << std::endl << "========================================" << std::endl;
+    std::cout << "基数堆演示完成!" << std::endl;
+    return 0;
+}
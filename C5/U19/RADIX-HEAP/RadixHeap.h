@@ -0,0 +1,250 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#ifndef CLRS_C5_U19_RADIX_HEAP_H
+#define CLRS_C5_U19_RADIX_HEAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "common/Trace.h"
+
+/**
+ * 单调基数堆（Ahuja、Mehlhorn、Orlin、Tarjan，1990）
+ *
+ * 适用于"单调"的优先队列：插入或减小后的关键字总不小于最近一次抽取的最小值 last，
+ * Dijkstra 算法（非负边权）正好满足这一点。与斐波那契堆的接口相同。
+ *
+ * 节点按关键字与 last 的二进制最高不同位放入 33 个桶：桶 0 存放等于 last 的关键字，
+ * 桶 b（b ≥ 1）存放与 last 的最高不同位为第 b - 1 位的关键字。桶号越大，关键字越大。
+ * - insert、decreaseKey：计算桶号并放入桶中，O(1)；
+ * - extractMin：桶 0 为空时找到第一个非空的桶，以其中最小的关键字作为新的 last，
+ *   把该桶的节点重新分配到更低的桶中。每个节点的桶号只降不升，总代价 O(log C)，C 为关键字范围。
+ * 没有指针结构，节点按桶连续存放，常数远小于斐波那契堆。
+ */
+
+// 基数堆节点结构
+struct RadixNode {
+    int key;        // 节点的关键字
+    int bucket;     // 所在的桶，-1 表示不在堆中
+    size_t index;   // 在桶内的下标
+
+    explicit RadixNode(int k) : key(k), bucket(-1), index(0) {}
+};
+
+// 基数堆类
+class RadixHeap {
+public:
+    using Node = RadixNode;
+
+    // 桶的个数：桶 0 加上 32 个二进制位各一个
+    static constexpr int kBuckets = 33;
+
+    RadixHeap() : buckets(kBuckets), last(std::numeric_limits<int>::min()), n(0) {}
+
+    ~RadixHeap() {
+        clear();
+    }
+
+    RadixHeap(const RadixHeap&) = delete;
+    RadixHeap& operator=(const RadixHeap&) = delete;
+
+    /**
+     * 插入关键字，堆为空时关键字不受单调性限制
+     * @throws std::invalid_argument 如果堆非空且关键字小于最近一次抽取的最小值
+     */
+    RadixNode* insert(int key) {
+        if (n == 0 && key < last) {
+            last = key;  // 空堆中没有其他关键字，可以把基准调小
+        }
+        checkMonotone(key);
+        RadixNode* node = new RadixNode(key);
+        place(node);
+        n++;
+        TRACE_STEP("  插入关键字 " << key << "，放入桶 " << node->bucket << std::endl);
+        return node;
+    }
+
+    /**
+     * 查找最小关键字：在第一个非空的桶中扫描，不重新分配，也不改变 last
+     * 只查看不抽取时，此后插入的关键字仍只需不小于最近一次抽取的最小值
+     */
+    RadixNode* minimum() const {
+        if (n == 0) {
+            return nullptr;
+        }
+        int b = 0;
+        while (buckets[b].empty()) {
+            b++;
+        }
+        RadixNode* z = buckets[b][0];
+        for (RadixNode* node : buckets[b]) {
+            if (node->key < z->key) z = node;
+        }
+        return z;
+    }
+
+    /**
+     * 抽取最小关键字，返回的节点由调用者用 release() 释放；堆为空时返回 nullptr
+     * 必要时把最小关键字所在的桶重新分配，使它落入桶 0
+     */
+    RadixNode* extractMin() {
+        if (n == 0) {
+            return nullptr;
+        }
+        redistribute();
+        RadixNode* z = buckets[0].back();
+        remove(z);
+        n--;
+        TRACE_STEP("  抽取最小关键字 " << z->key << "，剩余节点数: " << n << std::endl);
+        return z;
+    }
+
+    // 释放 extractMin() 返回的节点
+    void release(RadixNode* x) { delete x; }
+
+    /**
+     * 合并两个基数堆，other 随后为空
+     * 两个堆的 last 不同，取较小者并把 other 的节点逐个放入对应的桶，O(other.size())
+     */
+    void unite(RadixHeap& other) {
+        if (other.n == 0) {
+            return;
+        }
+        if (n == 0 || other.last < last) {
+            rebase(other.last);
+        }
+        for (std::vector<RadixNode*>& bucket : other.buckets) {
+            for (RadixNode* node : bucket) {
+                place(node);
+            }
+            bucket.clear();
+        }
+        n += other.n;
+        other.n = 0;
+    }
+
+    /**
+     * 减小关键字：从原来的桶中取出，按新关键字放入更低的桶
+     * 与 FibonacciHeap 相同，新关键字大于原关键字时不做任何操作
+     * @throws std::invalid_argument 如果新关键字小于最近一次抽取的最小值
+     */
+    void decreaseKey(RadixNode* x, int k) {
+        if (k > x->key) {
+            TRACE_STEP("  新关键字 " << k << " 大于原关键字 " << x->key << "，操作无效" << std::endl);
+            return;
+        }
+        checkMonotone(k);
+        remove(x);
+        x->key = k;
+        place(x);
+        TRACE_COUNT("radixHeap.decreaseKeys");
+    }
+
+    // 删除节点：直接从桶中取出，不需要先减小到负无穷
+    void deleteNode(RadixNode* x) {
+        remove(x);
+        n--;
+        delete x;
+    }
+
+    // 清空堆，释放全部节点
+    void clear() {
+        for (std::vector<RadixNode*>& bucket : buckets) {
+            for (RadixNode* node : bucket) {
+                delete node;
+            }
+            bucket.clear();
+        }
+        last = std::numeric_limits<int>::min();
+        n = 0;
+    }
+
+    // 获取节点数量
+    int size() const { return n; }
+
+private:
+    // 把 int 映射为保持大小顺序的无符号数，负数也能参与按位比较
+    static uint32_t ordered(int key) {
+        return static_cast<uint32_t>(key) ^ 0x80000000u;
+    }
+
+    // 关键字相对于 last 应放入的桶
+    int bucketOf(int key) const {
+        uint32_t diff = ordered(key) ^ ordered(last);
+        return diff == 0 ? 0 : 32 - __builtin_clz(diff);
+    }
+
+    void checkMonotone(int key) const {
+        if (n > 0 && key < last) {
+            throw std::invalid_argument("Radix heap key is below the last extracted minimum");
+        }
+    }
+
+    void place(RadixNode* node) {
+        std::vector<RadixNode*>& bucket = buckets[bucketOf(node->key)];
+        node->bucket = bucketOf(node->key);
+        node->index = bucket.size();
+        bucket.push_back(node);
+    }
+
+    // 用桶内最后一个节点填补 x 的位置
+    void remove(RadixNode* x) {
+        std::vector<RadixNode*>& bucket = buckets[x->bucket];
+        RadixNode* moved = bucket.back();
+        bucket[x->index] = moved;
+        moved->index = x->index;
+        bucket.pop_back();
+        x->bucket = -1;
+    }
+
+    /**
+     * 桶 0 为空时，以第一个非空桶中的最小关键字作为新的 last，把该桶的节点重新分配
+     * 这些节点与新 last 的最高不同位更低，全部落入编号更小的桶
+     */
+    void redistribute() {
+        if (!buckets[0].empty()) {
+            return;
+        }
+        int b = 1;
+        while (buckets[b].empty()) {
+            b++;
+        }
+        std::vector<RadixNode*> moving;
+        moving.swap(buckets[b]);
+        int newLast = moving[0]->key;
+        for (RadixNode* node : moving) {
+            if (node->key < newLast) newLast = node->key;
+        }
+        last = newLast;
+        for (RadixNode* node : moving) {
+            place(node);
+        }
+        moving.clear();
+        moving.swap(buckets[b]);  // 保留桶 b 已分配的容量
+        TRACE_COUNT("radixHeap.redistributions");
+    }
+
+    // 改变 last（只能变小）后所有节点的桶号都可能变化，全部重新放置
+    void rebase(int newLast) {
+        std::vector<RadixNode*> all;
+        for (std::vector<RadixNode*>& bucket : buckets) {
+            all.insert(all.end(), bucket.begin(), bucket.end());
+            bucket.clear();
+        }
+        last = newLast;
+        for (RadixNode* node : all) {
+            place(node);
+        }
+    }
+
+    std::vector<std::vector<RadixNode*>> buckets;  // 各桶中的节点
+    int last;                                      // 最近一次抽取的最小值（初始为 INT_MIN），所有关键字都不小于它
+    int n;                                         // 堆中节点总数
+};
+
+#endif //CLRS_C5_U19_RADIX_HEAP_H
@@ -4,6 +4,8 @@
 #include <vector>
 #include <bitset>
 
+#include "common/Trace.h"
+
 /**
  * van Emde Boas树实现示例程序
  * 
@@ -33,13 +35,13 @@ public:
 
     // 获取最小值
     int minimum() const { 
-        std::cout << "  获取最小值: " << (min == -1 ? -1 : min) << std::endl;
+        TRACE_STEP("  获取最小值: " << (min == -1 ? -1 : min) << std::endl);
         return min; 
     }
 
     // 获取最大值
     int maximum() const { 
-        std::cout << "  获取最大值: " << (max == -1 ? -1 : max) << std::endl;
+        TRACE_STEP("  获取最大值: " << (max == -1 ? -1 : max) << std::endl);
         return max; 
     }
 
@@ -65,14 +67,14 @@ private:
     // 高位函数
     int high(int x) const {
         int result = x / static_cast<int>(std::sqrt(u));
-        std::cout << "    high(" << x << ") = " << x << " / " << static_cast<int>(std::sqrt(u)) << " = " << result << std::endl;
+        TRACE_STEP("    high(" << x << ") = " << x << " / " << static_cast<int>(std::sqrt(u)) << " = " << result << std::endl);
         return result;
     }
 
     // 低位函数
     int low(int x) const {
         int result = x % static_cast<int>(std::sqrt(u));
-        std::cout << "    low(" << x << ") = " << x << " % " << static_cast<int>(std::sqrt(u)) << " = " << result << std::endl;
+        TRACE_STEP("    low(" << x << ") = " << x << " % " << static_cast<int>(std::sqrt(u)) << " = " << result << std::endl);
         return result;
     }
 
@@ -80,7 +82,7 @@ private:
     int index(int x, int y) const {
         int sqrt_u = static_cast<int>(std::sqrt(u));
         int result = x * sqrt_u + y;
-        std::cout << "    index(" << x << ", " << y << ") = " << x << " * " << sqrt_u << " + " << y << " = " << result << std::endl;
+        TRACE_STEP("    index(" << x << ", " << y << ") = " << x << " * " << sqrt_u << " + " << y << " = " << result << std::endl);
         return result;
     }
 
@@ -93,24 +95,24 @@ private:
 
 // 构造函数
 VanEmdeBoasTree::VanEmdeBoasTree(int universe_size) : u(universe_size), min(-1), max(-1), summary(nullptr) {
-    std::cout << "\n>>> 创建大小为 " << u << " 的van Emde Boas树 <<<" << std::endl;
+    TRACE_STEP("\n>>> 创建大小为 " << u << " 的van Emde Boas树 <<<" << std::endl);
     
     if (u > 2) {
         int sqrt_u = static_cast<int>(std::sqrt(u));
-        std::cout << "  √u = " << sqrt_u << "，将创建 " << sqrt_u << " 个簇" << std::endl;
+        TRACE_STEP("  √u = " << sqrt_u << "，将创建 " << sqrt_u << " 个簇" << std::endl);
         cluster.resize(sqrt_u);
         for (int i = 0; i < sqrt_u; i++) {
             cluster[i] = nullptr;
         }
         summary = nullptr;
     } else {
-        std::cout << "  基础情况 u=" << u << "，无需创建簇和摘要" << std::endl;
+        TRACE_STEP("  基础情况 u=" << u << "，无需创建簇和摘要" << std::endl);
     }
 }
 
 // 析构函数
 VanEmdeBoasTree::~VanEmdeBoasTree() {
-    std::cout << "销毁大小为 " << u << " 的van Emde Boas树..." << std::endl;
+    TRACE_STEP("销毁大小为 " << u << " 的van Emde Boas树..." << std::endl);
     if (u > 2) {
         delete summary;
         for (int i = 0; i < static_cast<int>(cluster.size()); i++) {
@@ -121,27 +123,27 @@ VanEmdeBoasTree::~VanEmdeBoasTree() {
 
 // 检查值是否存在
 bool VanEmdeBoasTree::member(int x) {
-    std::cout << "\n--- 检查元素 " << x << " 是否存在 ---" << std::endl;
+    TRACE_STEP("\n--- 检查元素 " << x << " 是否存在 ---" << std::endl);
     
     if (x == min || x == max) {
-        std::cout << "    元素 " << x << " 是最小值(" << min << ")或最大值(" << max << ")，存在" << std::endl;
+        TRACE_STEP("    元素 " << x << " 是最小值(" << min << ")或最大值(" << max << ")，存在" << std::endl);
         return true;
     } else if (u <= 2) {
-        std::cout << "    基础情况(u=" << u << ")，元素 " << x << " 不存在" << std::endl;
+        TRACE_STEP("    基础情况(u=" << u << ")，元素 " << x << " 不存在" << std::endl);
         return false;
     } else {
-        std::cout << "    递归情况(u=" << u << ")" << std::endl;
+        TRACE_STEP("    递归情况(u=" << u << ")" << std::endl);
         int cluster_index = high(x);
         int pos = low(x);
-        std::cout << "    元素 " << x << " 属于簇 " << cluster_index << "，位置 " << pos << std::endl;
+        TRACE_STEP("    元素 " << x << " 属于簇 " << cluster_index << "，位置 " << pos << std::endl);
         
         if (cluster[cluster_index] != nullptr) {
-            std::cout << "    簇 " << cluster_index << " 存在，递归检查..." << std::endl;
+            TRACE_STEP("    簇 " << cluster_index << " 存在，递归检查..." << std::endl);
             bool result = cluster[cluster_index]->member(pos);
-            std::cout << "    元素 " << x << (result ? " 存在" : " 不存在") << std::endl;
+            TRACE_STEP("    元素 " << x << (result ? " 存在" : " 不存在") << std::endl);
             return result;
         } else {
-            std::cout << "    簇 " << cluster_index << " 为空，元素 " << x << " 不存在" << std::endl;
+            TRACE_STEP("    簇 " << cluster_index << " 为空，元素 " << x << " 不存在" << std::endl);
             return false;
         }
     }
@@ -149,97 +151,97 @@ bool VanEmdeBoasTree::member(int x) {
 
 // 插入值
 void VanEmdeBoasTree::insert(int x) {
-    std::cout << "\n--- 插入元素 " << x << " ---" << std::endl;
+    TRACE_STEP("\n--- 插入元素 " << x << " ---" << std::endl);
     
     if (min == -1) {
-        std::cout << "  树为空，设置 " << x << " 为最小值和最大值" << std::endl;
+        TRACE_STEP("  树为空，设置 " << x << " 为最小值和最大值" << std::endl);
         min = max = x;
     } else if (x < min) {
-        std::cout << "  元素 " << x << " 小于当前最小值 " << min << "，交换它们" << std::endl;
+        TRACE_STEP("  元素 " << x << " 小于当前最小值 " << min << "，交换它们" << std::endl);
         std::swap(x, min);
     }
     
     if (u > 2) {
         int cluster_index = high(x);
         int pos = low(x);
-        std::cout << "  元素 " << x << " 属于簇 " << cluster_index << "，位置 " << pos << std::endl;
+        TRACE_STEP("  元素 " << x << " 属于簇 " << cluster_index << "，位置 " << pos << std::endl);
         
         if (cluster[cluster_index] == nullptr) {
-            std::cout << "    簇 " << cluster_index << " 为空，创建新簇" << std::endl;
+            TRACE_STEP("    簇 " << cluster_index << " 为空，创建新簇" << std::endl);
             cluster[cluster_index] = makeEmptyVEBTree(static_cast<int>(std::sqrt(u)));
             
             if (summary == nullptr) {
-                std::cout << "    摘要为空，创建新摘要" << std::endl;
+                TRACE_STEP("    摘要为空，创建新摘要" << std::endl);
                 summary = makeEmptyVEBTree(static_cast<int>(std::sqrt(u)));
             }
-            std::cout << "    在摘要中插入簇索引 " << cluster_index << std::endl;
+            TRACE_STEP("    在摘要中插入簇索引 " << cluster_index << std::endl);
             summary->insert(cluster_index);
         }
         
-        std::cout << "    在簇 " << cluster_index << " 中插入位置 " << pos << std::endl;
+        TRACE_STEP("    在簇 " << cluster_index << " 中插入位置 " << pos << std::endl);
         cluster[cluster_index]->insert(pos);
     }
     
     if (x > max) {
-        std::cout << "  更新最大值为 " << x << std::endl;
+        TRACE_STEP("  更新最大值为 " << x << std::endl);
         max = x;
     }
     
-    std::cout << "  ✓ 元素 " << x << " 插入完成" << std::endl;
+    TRACE_STEP("  ✓ 元素 " << x << " 插入完成" << std::endl);
 }
 
 // 删除值
 void VanEmdeBoasTree::remove(int x) {
-    std::cout << "\n--- 删除元素 " << x << " ---" << std::endl;
+    TRACE_STEP("\n--- 删除元素 " << x << " ---" << std::endl);
     
     if (min == max && x == min) {
-        std::cout << "  树中只有一个元素 " << x << "，删除后树变为空" << std::endl;
+        TRACE_STEP("  树中只有一个元素 " << x << "，删除后树变为空" << std::endl);
         min = max = -1;
         return;
     } else if (u <= 2) {
-        std::cout << "  基础情况(u=" << u << ")" << std::endl;
+        TRACE_STEP("  基础情况(u=" << u << ")" << std::endl);
         if (x == 0 && min == 0) {
-            std::cout << "    删除元素0，最小值更新为1" << std::endl;
+            TRACE_STEP("    删除元素0，最小值更新为1" << std::endl);
             min = 1;
         } else if (x == 1 && min == 1) {
-            std::cout << "    删除元素1，最小值更新为0" << std::endl;
+            TRACE_STEP("    删除元素1，最小值更新为0" << std::endl);
             min = 0;
         }
         
         if (min == max) {
-            std::cout << "    删除后树变为空" << std::endl;
+            TRACE_STEP("    删除后树变为空" << std::endl);
             min = max = -1;
         }
         
-        std::cout << "  基础情况，删除元素 " << x << " 完成" << std::endl;
+        TRACE_STEP("  基础情况，删除元素 " << x << " 完成" << std::endl);
         return;
     }
     
     if (x == min) {
-        std::cout << "  删除的是最小元素 " << x << std::endl;
+        TRACE_STEP("  删除的是最小元素 " << x << std::endl);
         if (summary == nullptr || summary->minimum() == -1) {
-            std::cout << "  没有其他元素，树变为空" << std::endl;
+            TRACE_STEP("  没有其他元素，树变为空" << std::endl);
             min = max = -1;
             return;
         }
         
         int first_cluster = summary->minimum();
-        std::cout << "  从簇 " << first_cluster << " 中找到新的最小值" << std::endl;
+        TRACE_STEP("  从簇 " << first_cluster << " 中找到新的最小值" << std::endl);
         x = index(first_cluster, cluster[first_cluster]->minimum());
-        std::cout << "  新的最小值为 " << x << std::endl;
+        TRACE_STEP("  新的最小值为 " << x << std::endl);
         min = x;
     }
     
     int cluster_index = high(x);
     int pos = low(x);
-    std::cout << "  元素 " << x << " 属于簇 " << cluster_index << "，位置 " << pos << std::endl;
+    TRACE_STEP("  元素 " << x << " 属于簇 " << cluster_index << "，位置 " << pos << std::endl);
     
     if (cluster[cluster_index] != nullptr) {
-        std::cout << "    在簇 " << cluster_index << " 中删除位置 " << pos << std::endl;
+        TRACE_STEP("    在簇 " << cluster_index << " 中删除位置 " << pos << std::endl);
         cluster[cluster_index]->remove(pos);
         
         if (cluster[cluster_index]->minimum() == -1) {
-            std::cout << "    簇 " << cluster_index << " 变为空，从摘要中删除" << std::endl;
+            TRACE_STEP("    簇 " << cluster_index << " 变为空，从摘要中删除" << std::endl);
             if (summary != nullptr) {
                 summary->remove(cluster_index);
             }
@@ -249,73 +251,73 @@ void VanEmdeBoasTree::remove(int x) {
     }
     
     if (x == max) {
-        std::cout << "  删除的是最大元素 " << x << std::endl;
+        TRACE_STEP("  删除的是最大元素 " << x << std::endl);
         if (summary == nullptr || summary->minimum() == -1) {
-            std::cout << "  没有其他元素，最大值设为最小值 " << min << std::endl;
+            TRACE_STEP("  没有其他元素，最大值设为最小值 " << min << std::endl);
             max = min;
         } else {
             int last_cluster = summary->maximum();
-            std::cout << "  从簇 " << last_cluster << " 中找到新的最大值" << std::endl;
+            TRACE_STEP("  从簇 " << last_cluster << " 中找到新的最大值" << std::endl);
             max = index(last_cluster, cluster[last_cluster]->maximum());
-            std::cout << "  新的最大值为 " << max << std::endl;
+            TRACE_STEP("  新的最大值为 " << max << std::endl);
         }
     }
     
-    std::cout << "  ✓ 元素 " << x << " 删除完成" << std::endl;
+    TRACE_STEP("  ✓ 元素 " << x << " 删除完成" << std::endl);
 }
 
 // 查找后继
 int VanEmdeBoasTree::successor(int x) {
-    std::cout << "\n--- 查找元素 " << x << " 的后继 ---" << std::endl;
+    TRACE_STEP("\n--- 查找元素 " << x << " 的后继 ---" << std::endl);
     
     if (u <= 2) {
-        std::cout << "  基础情况(u=" << u << ")" << std::endl;
+        TRACE_STEP("  基础情况(u=" << u << ")" << std::endl);
         if (x == 0 && max == 1) {
-            std::cout << "    基础情况，元素0的后继是1" << std::endl;
+            TRACE_STEP("    基础情况，元素0的后继是1" << std::endl);
             return 1;
         } else {
-            std::cout << "    基础情况，元素 " << x << " 没有后继" << std::endl;
+            TRACE_STEP("    基础情况，元素 " << x << " 没有后继" << std::endl);
             return -1;
         }
     } else if (min != -1 && x < min) {
-        std::cout << "  元素 " << x << " 小于最小值 " << min << "，后继就是最小值" << std::endl;
+        TRACE_STEP("  元素 " << x << " 小于最小值 " << min << "，后继就是最小值" << std::endl);
         return min;
     } else {
-        std::cout << "  递归情况(u=" << u << ")" << std::endl;
+        TRACE_STEP("  递归情况(u=" << u << ")" << std::endl);
         int cluster_index = high(x);
         int pos = low(x);
-        std::cout << "  元素 " << x << " 属于簇 " << cluster_index << "，位置 " << pos << std::endl;
+        TRACE_STEP("  元素 " << x << " 属于簇 " << cluster_index << "，位置 " << pos << std::endl);
         int max_low = -1;
         
         if (cluster[cluster_index] != nullptr) {
             max_low = cluster[cluster_index]->maximum();
         }
-        std::cout << "  簇 " << cluster_index << " 的最大值为 " << max_low << std::endl;
+        TRACE_STEP("  簇 " << cluster_index << " 的最大值为 " << max_low << std::endl);
         
         if (max_low != -1 && pos < max_low) {
-            std::cout << "    在簇 " << cluster_index << " 中找到后继" << std::endl;
+            TRACE_STEP("    在簇 " << cluster_index << " 中找到后继" << std::endl);
             int offset = cluster[cluster_index]->successor(pos);
             if (offset != -1) {
                 int result = index(cluster_index, offset);
-                std::cout << "    元素 " << x << " 的后继是 " << result << std::endl;
+                TRACE_STEP("    元素 " << x << " 的后继是 " << result << std::endl);
                 return result;
             }
         } else {
-            std::cout << "    在当前簇中未找到后继，查找后续簇" << std::endl;
+            TRACE_STEP("    在当前簇中未找到后继，查找后续簇" << std::endl);
             int succ_cluster = -1;
             if (summary != nullptr) {
                 succ_cluster = summary->successor(cluster_index);
             }
-            std::cout << "    后继簇索引为 " << succ_cluster << std::endl;
+            TRACE_STEP("    后继簇索引为 " << succ_cluster << std::endl);
             
             if (succ_cluster == -1) {
-                std::cout << "    没有后继簇，元素 " << x << " 没有后继" << std::endl;
+                TRACE_STEP("    没有后继簇，元素 " << x << " 没有后继" << std::endl);
                 return -1;
             } else {
-                std::cout << "    在后继簇 " << succ_cluster << " 中找到最小值作为后继" << std::endl;
+                TRACE_STEP("    在后继簇 " << succ_cluster << " 中找到最小值作为后继" << std::endl);
                 int offset = cluster[succ_cluster]->minimum();
                 int result = index(succ_cluster, offset);
-                std::cout << "    元素 " << x << " 的后继是 " << result << std::endl;
+                TRACE_STEP("    元素 " << x << " 的后继是 " << result << std::endl);
                 return result;
             }
         }
@@ -325,61 +327,61 @@ int VanEmdeBoasTree::successor(int x) {
 
 // 查找前驱
 int VanEmdeBoasTree::predecessor(int x) {
-    std::cout << "\n--- 查找元素 " << x << " 的前驱 ---" << std::endl;
+    TRACE_STEP("\n--- 查找元素 " << x << " 的前驱 ---" << std::endl);
     
     if (u <= 2) {
-        std::cout << "  基础情况(u=" << u << ")" << std::endl;
+        TRACE_STEP("  基础情况(u=" << u << ")" << std::endl);
         if (x == 1 && min == 0) {
-            std::cout << "    基础情况，元素1的前驱是0" << std::endl;
+            TRACE_STEP("    基础情况，元素1的前驱是0" << std::endl);
             return 0;
         } else {
-            std::cout << "    基础情况，元素 " << x << " 没有前驱" << std::endl;
+            TRACE_STEP("    基础情况，元素 " << x << " 没有前驱" << std::endl);
             return -1;
         }
     } else if (max != -1 && x > max) {
-        std::cout << "  元素 " << x << " 大于最大值 " << max << "，前驱就是最大值" << std::endl;
+        TRACE_STEP("  元素 " << x << " 大于最大值 " << max << "，前驱就是最大值" << std::endl);
         return max;
     } else {
-        std::cout << "  递归情况(u=" << u << ")" << std::endl;
+        TRACE_STEP("  递归情况(u=" << u << ")" << std::endl);
         int cluster_index = high(x);
         int pos = low(x);
-        std::cout << "  元素 " << x << " 属于簇 " << cluster_index << "，位置 " << pos << std::endl;
+        TRACE_STEP("  元素 " << x << " 属于簇 " << cluster_index << "，位置 " << pos << std::endl);
         int min_low = -1;
         
         if (cluster[cluster_index] != nullptr) {
             min_low = cluster[cluster_index]->minimum();
         }
-        std::cout << "  簇 " << cluster_index << " 的最小值为 " << min_low << std::endl;
+        TRACE_STEP("  簇 " << cluster_index << " 的最小值为 " << min_low << std::endl);
         
         if (min_low != -1 && pos > min_low) {
-            std::cout << "    在簇 " << cluster_index << " 中找到前驱" << std::endl;
+            TRACE_STEP("    在簇 " << cluster_index << " 中找到前驱" << std::endl);
             int offset = cluster[cluster_index]->predecessor(pos);
             if (offset != -1) {
                 int result = index(cluster_index, offset);
-                std::cout << "    元素 " << x << " 的前驱是 " << result << std::endl;
+                TRACE_STEP("    元素 " << x << " 的前驱是 " << result << std::endl);
                 return result;
             }
         } else {
-            std::cout << "    在当前簇中未找到前驱，查找前驱簇" << std::endl;
+            TRACE_STEP("    在当前簇中未找到前驱，查找前驱簇" << std::endl);
             int pred_cluster = -1;
             if (summary != nullptr) {
                 pred_cluster = summary->predecessor(cluster_index);
             }
-            std::cout << "    前驱簇索引为 " << pred_cluster << std::endl;
+            TRACE_STEP("    前驱簇索引为 " << pred_cluster << std::endl);
             
             if (pred_cluster == -1) {
                 if (min != -1 && x > min) {
-                    std::cout << "    没有前驱簇，但最小值 " << min << " 是前驱" << std::endl;
+                    TRACE_STEP("    没有前驱簇，但最小值 " << min << " 是前驱" << std::endl);
                     return min;
                 } else {
-                    std::cout << "    没有前驱" << std::endl;
+                    TRACE_STEP("    没有前驱" << std::endl);
                     return -1;
                 }
             } else {
-                std::cout << "    在前驱簇 " << pred_cluster << " 中找到最大值作为前驱" << std::endl;
+                TRACE_STEP("    在前驱簇 " << pred_cluster << " 中找到最大值作为前驱" << std::endl);
                 int offset = cluster[pred_cluster]->maximum();
                 int result = index(pred_cluster, offset);
-                std::cout << "    元素 " << x << " 的前驱是 " << result << std::endl;
+                TRACE_STEP("    元素 " << x << " 的前驱是 " << result << std::endl);
                 return result;
             }
         }
@@ -389,7 +391,7 @@ int VanEmdeBoasTree::predecessor(int x) {
 
 // 创建空的vEB树
 VanEmdeBoasTree* VanEmdeBoasTree::makeEmptyVEBTree(int u) {
-    std::cout << "  创建大小为 " << u << " 的空vEB树" << std::endl;
+    TRACE_STEP("  创建大小为 " << u << " 的空vEB树" << std::endl);
     return new VanEmdeBoasTree(u);
 }
 
@@ -0,0 +1,193 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#ifndef CLRS_C5_U21_DISJOINT_SET_DATA_STRUCTURE_H
+#define CLRS_C5_U21_DISJOINT_SET_DATA_STRUCTURE_H
+
+#include <vector>
+
+#include "common/Trace.h"
+
+/**
+ * 不相交集合数据结构（并查集）实现
+ * 
+ * 根据《算法导论》第21章内容实现
+ * 
+ * 不相交集合数据结构支持以下操作：
+ * 1. MAKE-SET(x) - 创建一个新的集合，其唯一成员是x
+ * 2. UNION(x, y) - 将包含x和y的集合合并
+ * 3. FIND-SET(x) - 返回包含x的集合的代表元素
+ * 
+ * 优化策略：
+ * 1. 按秩合并（Union by rank）- 将秩较小的树连接到秩较大的树下
+ * 2. 路径压缩（Path compression）- 在FIND-SET操作中，使查找路径上的每个节点直接指向根节点
+ * 
+ * 时间复杂度：
+ * - MAKE-SET: O(1)
+ * - UNION: O(α(n))
+ * - FIND-SET: O(α(n))
+ * 其中α(n)是反Ackermann函数，实际上可以认为是常数时间
+ */
+
+class DisjointSet {
+private:
+    std::vector<int> parent;  // parent[x] 表示元素x的父节点
+    std::vector<int> rank;    // rank[x] 表示以x为根的子树的高度上界（秩）
+    
+public:
+    /**
+     * 构造函数
+     * @param n 集合中元素的数量，元素编号从0到n-1
+     */
+    explicit DisjointSet(int n) : parent(n), rank(n, 0) {
+        // 初始化时，每个元素都是自己集合的代表元素
+        for (int i = 0; i < n; i++) {
+            parent[i] = i;
+        }
+        TRACE_STEP("创建不相交集合数据结构，包含 " << n << " 个元素 [0.." << (n-1) << "]" << std::endl);
+    }
+    
+    /**
+     * MAKE-SET操作：创建只包含元素x的集合
+     * 在初始化后一般不需要调用此方法，但在某些动态场景中可能有用
+     * @param x 元素索引
+     */
+    void makeSet(int x) {
+        TRACE_STEP("MAKE-SET(" << x << "): 创建只包含元素 " << x << " 的新集合" << std::endl);
+        parent[x] = x;
+        rank[x] = 0;
+    }
+    
+    /**
+     * FIND-SET操作：查找包含元素x的集合的代表元素（根节点）
+     * 使用路径压缩优化
+     * @param x 要查找的元素
+     * @return 包含x的集合的代表元素
+     */
+    int findSet(int x) {
+        TRACE_STEP("FIND-SET(" << x << "): ");
+        
+        // 路径压缩：如果x不是根节点，则将x的父节点设置为根节点
+        if (parent[x] != x) {
+            TRACE_STEP("路径压缩 ");
+            parent[x] = findSet(parent[x]);  // 递归查找根节点，并进行路径压缩
+        }
+        
+        TRACE_STEP("返回根节点 " << parent[x] << std::endl);
+        return parent[x];
+    }
+    
+    /**
+     * 迭代版本的FIND-SET操作
+     * 避免在很深的递归调用中可能出现的栈溢出问题
+     * @param x 要查找的元素
+     * @return 包含x的集合的代表元素
+     */
+    int findSetIterative(int x) {
+        TRACE_STEP("FIND-SET-ITERATIVE(" << x << "): ");
+        
+        // 第一遍查找根节点
+        int root = x;
+        while (parent[root] != root) {
+            root = parent[root];
+        }
+        
+        // 第二遍进行路径压缩
+        while (parent[x] != x) {
+            int next = parent[x];
+            parent[x] = root;
+            x = next;
+        }
+        
+        TRACE_STEP("返回根节点 " << root << std::endl);
+        return root;
+    }
+    
+    /**
+     * UNION操作：合并包含元素x和y的集合
+     * 使用按秩合并优化
+     * @param x 第一个元素
+     * @param y 第二个元素
+     */
+    void unionSets(int x, int y) {
+        TRACE_STEP("\nUNION(" << x << ", " << y << "): ");
+        int rootX = findSet(x);
+        int rootY = findSet(y);
+        
+        // 如果x和y已经在同一个集合中，则无需合并
+        if (rootX == rootY) {
+            TRACE_STEP("元素 " << x << " 和 " << y << " 已经在同一个集合中" << std::endl);
+            return;
+        }
+        
+        TRACE_STEP("合并包含 " << x << " 和 " << y << " 的集合" << std::endl);
+        
+        // 按秩合并：将秩较小的树连接到秩较大的树下
+        if (rank[rootX] < rank[rootY]) {
+            TRACE_STEP("  将秩为 " << rank[rootX] << " 的树连接到秩为 " << rank[rootY] << " 的树下" << std::endl);
+            parent[rootX] = rootY;
+        } else if (rank[rootX] > rank[rootY]) {
+            TRACE_STEP("  将秩为 " << rank[rootY] << " 的树连接到秩为 " << rank[rootX] << " 的树下" << std::endl);
+            parent[rootY] = rootX;
+        } else {
+            // 如果两棵树的秩相同，任选其一作为根，并将其秩加1
+            TRACE_STEP("  两棵树秩相同(" << rank[rootX] << ")，将其中一棵树连接到另一棵下，新根节点秩增加" << std::endl);
+            parent[rootY] = rootX;
+            rank[rootX]++;
+        }
+    }
+    
+    /**
+     * 检查两个元素是否属于同一个集合
+     * @param x 第一个元素
+     * @param y 第二个元素
+     * @return 如果x和y在同一个集合中返回true，否则返回false
+     */
+    bool isConnected(int x, int y) {
+        return findSet(x) == findSet(y);
+    }
+    
+    /**
+     * 获取元素的数量
+     * @return 元素数量n，元素编号从0到n-1
+     */
+    int size() const {
+        return parent.size();
+    }
+    
+    /**
+     * 获取元素x的父节点（不做路径压缩）
+     * @param x 元素索引
+     * @return x的父节点
+     */
+    int parentOf(int x) const {
+        return parent[x];
+    }
+    
+    /**
+     * 获取元素x的秩
+     * @param x 元素索引
+     * @return x的秩
+     */
+    int rankOf(int x) const {
+        return rank[x];
+    }
+    
+    /**
+     * 获取集合的数量
+     * @return 当前不相交集合中独立集合的数量
+     */
+    int getSetCount() const {
+        int count = 0;
+        int n = parent.size();
+        for (int i = 0; i < n; i++) {
+            if (parent[i] == i) {  // 根节点代表一个集合
+                count++;
+            }
+        }
+        return count;
+    }
+};
+
+#endif //CLRS_C5_U21_DISJOINT_SET_DATA_STRUCTURE_H
@@ -5,430 +5,70 @@
 #include <stack>
 #include <iomanip>
 
+#include "GraphRepresentation.h"
+
 /**
- * 图的表示方法实现
- * 
- * 根据《算法导论》第22章22.1节内容实现
- * 
- * 图可以用多种方式表示，最常见的有：
- * 1. 邻接表表示法 (Adjacency-List Representation)
- * 2. 邻接矩阵表示法 (Adjacency-Matrix Representation)
- * 
- * 本程序将实现这两种表示方法，并演示它们的基本操作
+ * 打印邻接表表示
  */
-
-// 邻接表表示的有向图
-class DirectedAdjacencyListGraph {
-private:
-    int vertices;                           // 顶点数
-    std::vector<std::list<int>> adjList;    // 邻接表
-    std::vector<int> inDegree;              // 入度数组
-    
-public:
-    /**
-     * 构造函数
-     * @param v 顶点数量
-     */
-    explicit DirectedAdjacencyListGraph(int v) : vertices(v), adjList(v), inDegree(v, 0) {
-        std::cout << "创建邻接表表示的有向图，包含 " << v << " 个顶点 [0.." << (v-1) << "]" << std::endl;
-    }
-    
-    /**
-     * 添加一条有向边 (u, v)
-     * @param u 起点
-     * @param v 终点
-     */
-    void addEdge(int u, int v) {
-        std::cout << "添加有向边 (" << u << ", " << v << ")" << std::endl;
-        adjList[u].push_back(v);
-        inDegree[v]++;  // 增加终点的入度
-    }
-    
-    /**
-     * 打印邻接表表示
-     */
-    void printGraph() {
-        std::cout << "\n========== 邻接表表示 ==========" << std::endl;
-        for (int i = 0; i < vertices; i++) {
-            std::cout << "顶点 " << i << " (入度: " << inDegree[i] << "): ";
-            for (int neighbor : adjList[i]) {
-                std::cout << neighbor << " ";
-            }
-            std::cout << std::endl;
-        }
-        std::cout << "===============================" << std::endl;
-    }
-    
-    /**
-     * 获取顶点数
-     * @return 顶点数量
-     */
-    int getVertexCount() const {
-        return vertices;
-    }
-    
-    /**
-     * 获取边数
-     * @return 边的数量
-     */
-    int getEdgeCount() const {
-        int count = 0;
-        for (int i = 0; i < vertices; i++) {
-            count += adjList[i].size();
-        }
-        return count;
-    }
-    
-    /**
-     * 获取指定顶点的邻接点
-     * @param v 顶点
-     * @return 邻接点列表
-     */
-    const std::list<int>& getAdjacent(int v) const {
-        return adjList[v];
-    }
-    
-    /**
-     * 检查是否存在边 (u, v)
-     * @param u 起点
-     * @param v 终点
-     * @return 如果存在边返回true，否则返回false
-     */
-    bool hasEdge(int u, int v) const {
-        for (int neighbor : adjList[u]) {
-            if (neighbor == v) {
-                return true;
-            }
-        }
-        return false;
-    }
-    
-    /**
-     * 获取顶点的出度
-     * @param v 顶点
-     * @return 出度
-     */
-    int getOutDegree(int v) const {
-        return adjList[v].size();
-    }
-    
-    /**
-     * 获取顶点的入度
-     * @param v 顶点
-     * @return 入度
-     */
-    int getInDegree(int v) const {
-        return inDegree[v];
-    }
-};
-
-// 邻接表表示的无向图
-class UndirectedAdjacencyListGraph {
-private:
-    int vertices;                           // 顶点数
-    std::vector<std::list<int>> adjList;    // 邻接表
-    
-public:
-    /**
-     * 构造函数
-     * @param v 顶点数量
-     */
-    explicit UndirectedAdjacencyListGraph(int v) : vertices(v), adjList(v) {
-        std::cout << "创建邻接表表示的无向图，包含 " << v << " 个顶点 [0.." << (v-1) << "]" << std::endl;
-    }
-    
-    /**
-     * 添加一条无向边 (u, v)
-     * @param u 顶点u
-     * @param v 顶点v
-     */
-    void addEdge(int u, int v) {
-        std::cout << "添加无向边 (" << u << ", " << v << ")" << std::endl;
-        adjList[u].push_back(v);
-        adjList[v].push_back(u);  // 无向图需要在两个顶点的邻接表中都添加对方
-    }
-    
-    /**
-     * 打印邻接表表示
-     */
-    void printGraph() {
-        std::cout << "\n========== 无向图邻接表表示 ==========" << std::endl;
-        for (int i = 0; i < vertices; i++) {
-            std::cout << "顶点 " << i << " (度数: " << adjList[i].size() << "): ";
-            for (int neighbor : adjList[i]) {
-                std::cout << neighbor << " ";
-            }
-            std::cout << std::endl;
-        }
-        std::cout << "===================================" << std::endl;
-    }
-    
-    /**
-     * 获取顶点数
-     * @return 顶点数量
-     */
-    int getVertexCount() const {
-        return vertices;
-    }
-    
-    /**
-     * 获取边数
-     * @return 边的数量
-     */
-    int getEdgeCount() const {
-        int count = 0;
-        for (int i = 0; i < vertices; i++) {
-            count += adjList[i].size();
-        }
-        return count / 2;  // 无向图中每条边被计算了两次
-    }
-    
-    /**
-     * 获取指定顶点的邻接点
-     * @param v 顶点
-     * @return 邻接点列表
-     */
-    const std::list<int>& getAdjacent(int v) const {
-        return adjList[v];
-    }
-    
-    /**
-     * 检查是否存在边 (u, v)
-     * @param u 顶点u
-     * @param v 顶点v
-     * @return 如果存在边返回true，否则返回false
-     */
-    bool hasEdge(int u, int v) const {
-        for (int neighbor : adjList[u]) {
-            if (neighbor == v) {
-                return true;
-            }
-        }
-        return false;
-    }
-    
-    /**
-     * 获取顶点的度数
-     * @param v 顶点
-     * @return 度数
-     */
-    int getDegree(int v) const {
-        return adjList[v].size();
-    }
-};
-
-// 邻接矩阵表示的图
-class AdjacencyMatrixGraph {
-private:
-    int vertices;                    // 顶点数
-    std::vector<std::vector<int>> adjMatrix;  // 邻接矩阵
-    
-public:
-    /**
-     * 构造函数
-     * @param v 顶点数量
-     */
-    explicit AdjacencyMatrixGraph(int v) : vertices(v), adjMatrix(v, std::vector<int>(v, 0)) {
-        std::cout << "创建邻接矩阵表示的图，包含 " << v << " 个顶点 [0.." << (v-1) << "]" << std::endl;
-    }
-    
-    /**
-     * 添加一条边 (u, v)
-     * @param u 起点
-     * @param v 终点
-     */
-    void addEdge(int u, int v) {
-        std::cout << "添加边 (" << u << ", " << v << ")" << std::endl;
-        adjMatrix[u][v] = 1;
-    }
-    
-    /**
-     * 打印邻接矩阵表示
-     */
-    void printGraph() {
-        std::cout << "\n========== 邻接矩阵表示 ==========" << std::endl;
-        std::cout << "    ";
-        for (int i = 0; i < vertices; i++) {
-            std::cout << std::setw(3) << i;
+void printGraph(const DirectedAdjacencyListGraph& graph) {
+    std::cout << "\n========== 邻接表表示 ==========" << std::endl;
+    for (int i = 0; i < graph.getVertexCount(); i++) {
+        std::cout << "顶点 " << i << " (入度: " << graph.getInDegree(i) << "): ";
+        for (int neighbor : graph.getAdjacent(i)) {
+            std::cout << neighbor << " ";
         }
         std::cout << std::endl;
-        
-        for (int i = 0; i < vertices; i++) {
-            std::cout << std::setw(3) << i << " ";
-            for (int j = 0; j < vertices; j++) {
-                std::cout << std::setw(3) << adjMatrix[i][j];
-            }
-            std::cout << std::endl;
-        }
-        std::cout << "================================" << std::endl;
-    }
-    
-    /**
-     * 获取顶点数
-     * @return 顶点数量
-     */
-    int getVertexCount() const {
-        return vertices;
-    }
-    
-    /**
-     * 获取边数
-     * @return 边的数量
-     */
-    int getEdgeCount() const {
-        int count = 0;
-        for (int i = 0; i < vertices; i++) {
-            for (int j = 0; j < vertices; j++) {
-                if (adjMatrix[i][j] == 1) {
-                    count++;
-                }
-            }
-        }
-        return count;
-    }
-    
-    /**
-     * 检查是否存在边 (u, v)
-     * @param u 起点
-     * @param v 终点
-     * @return 如果存在边返回true，否则返回false
-     */
-    bool hasEdge(int u, int v) const {
-        return adjMatrix[u][v] == 1;
     }
-    
-    /**
-     * 获取指定顶点的出度
-     * @param v 顶点
-     * @return 出度
-     */
-    int getOutDegree(int v) const {
-        int degree = 0;
-        for (int j = 0; j < vertices; j++) {
-            if (adjMatrix[v][j] == 1) {
-                degree++;
-            }
-        }
-        return degree;
-    }
-    
-    /**
-     * 获取指定顶点的入度
-     * @param v 顶点
-     * @return 入度
-     */
-    int getInDegree(int v) const {
-        int degree = 0;
-        for (int i = 0; i < vertices; i++) {
-            if (adjMatrix[i][v] == 1) {
-                degree++;
-            }
-        }
-        return degree;
-    }
-};
+    std::cout << "===============================" << std::endl;
+}
 
 /**
- * 图的遍历算法 - 广度优先搜索 (BFS)
- * @param graph 邻接表表示的图
- * @param start 起始顶点
+ * 打印无向图邻接表表示
  */
-void BFS(const DirectedAdjacencyListGraph& graph, int start) {
-    std::cout << "\n--- 广度优先搜索 (BFS) 从顶点 " << start << " 开始 ---" << std::endl;
-    
-    int vertices = graph.getVertexCount();
-    std::vector<bool> visited(vertices, false);
-    std::queue<int> queue;
-    
-    visited[start] = true;
-    queue.push(start);
-    std::cout << "访问顶点: " << start << std::endl;
-    
-    while (!queue.empty()) {
-        int current = queue.front();
-        queue.pop();
-        
-        // 访问当前顶点的所有未访问过的邻居
-        for (int neighbor : graph.getAdjacent(current)) {
-            if (!visited[neighbor]) {
-                visited[neighbor] = true;
-                queue.push(neighbor);
-                std::cout << "访问顶点: " << neighbor << std::endl;
-            }
+void printGraph(const UndirectedAdjacencyListGraph& graph) {
+    std::cout << "\n========== 无向图邻接表表示 ==========" << std::endl;
+    for (int i = 0; i < graph.getVertexCount(); i++) {
+        std::cout << "顶点 " << i << " (度数: " << graph.getDegree(i) << "): ";
+        for (int neighbor : graph.getAdjacent(i)) {
+            std::cout << neighbor << " ";
         }
+        std::cout << std::endl;
     }
+    std::cout << "===================================" << std::endl;
 }
 
 /**
- * 图的遍历算法 - 深度优先搜索 (DFS) 递归版本
- * @param graph 邻接表表示的图
- * @param vertex 当前顶点
- * @param visited 访问标记数组
+ * 打印邻接矩阵表示
  */
-void DFSUtil(const DirectedAdjacencyListGraph& graph, int vertex, std::vector<bool>& visited) {
-    visited[vertex] = true;
-    std::cout << "访问顶点: " << vertex << std::endl;
-    
-    // 递归访问所有未访问过的邻居
-    for (int neighbor : graph.getAdjacent(vertex)) {
-        if (!visited[neighbor]) {
-            DFSUtil(graph, neighbor, visited);
+void printGraph(const AdjacencyMatrixGraph& graph) {
+    std::cout << "\n========== 邻接矩阵表示 ==========" << std::endl;
+    std::cout << "    ";
+    for (int i = 0; i < graph.getVertexCount(); i++) {
+        std::cout << std::setw(3) << i;
+    }
+    std::cout << std::endl;
+    
+    for (int i = 0; i < graph.getVertexCount(); i++) {
+        std::cout << std::setw(3) << i << " ";
+        for (int j = 0; j < graph.getVertexCount(); j++) {
+            std::cout << std::setw(3) << (graph.hasEdge(i, j) ? 1 : 0);
         }
+        std::cout << std::endl;
     }
+    std::cout << "================================" << std::endl;
 }
 
 /**
- * 图的遍历算法 - 深度优先搜索 (DFS) 递归版本
- * @param graph 邻接表表示的图
- * @param start 起始顶点
- */
-void DFSRecursive(const DirectedAdjacencyListGraph& graph, int start) {
-    std::cout << "\n--- 深度优先搜索 (DFS) 递归版本 从顶点 " << start << " 开始 ---" << std::endl;
-    
-    int vertices = graph.getVertexCount();
-    std::vector<bool> visited(vertices, false);
-    
-    DFSUtil(graph, start, visited);
-}
-
-/**
- * 图的遍历算法 - 深度优先搜索 (DFS) 迭代版本
- * @param graph 邻接表表示的图
- * @param start 起始顶点
+ * 图的表示方法实现
+ * 
+ * 根据《算法导论》第22章22.1节内容实现
+ * 
+ * 图可以用多种方式表示，最常见的有：
+ * 1. 邻接表表示法 (Adjacency-List Representation)
+ * 2. 邻接矩阵表示法 (Adjacency-Matrix Representation)
+ * 
+ * 本程序将实现这两种表示方法，并演示它们的基本操作
  */
-void DFSIterative(const DirectedAdjacencyListGraph& graph, int start) {
-    std::cout << "\n--- 深度优先搜索 (DFS) 迭代版本 从顶点 " << start << " 开始 ---" << std::endl;
-    
-    int vertices = graph.getVertexCount();
-    std::vector<bool> visited(vertices, false);
-    std::stack<int> stack;
-    
-    stack.push(start);
-    
-    while (!stack.empty()) {
-        int current = stack.top();
-        stack.pop();
-        
-        if (!visited[current]) {
-            visited[current] = true;
-            std::cout << "访问顶点: " << current << std::endl;
-            
-            // 将所有未访问的邻居压入栈中
-            // 注意：为了保持与递归版本一致的访问顺序，我们需要逆序压栈
-            std::vector<int> neighbors;
-            for (int neighbor : graph.getAdjacent(current)) {
-                if (!visited[neighbor]) {
-                    neighbors.push_back(neighbor);
-                }
-            }
-            
-            // 逆序压栈以保证访问顺序一致
-            for (int i = neighbors.size() - 1; i >= 0; i--) {
-                stack.push(neighbors[i]);
-            }
-        }
-    }
-}
 
 /**
  * 演示有向图的不同表示方法
@@ -454,7 +94,7 @@ void demonstrateDirectedGraphRepresentations() {
     adjListGraph.addEdge(4, 3);
     adjListGraph.addEdge(5, 5);  // 自环
     
-    adjListGraph.printGraph();
+    printGraph(adjListGraph);
     
     std::cout << "\n图信息:" << std::endl;
     std::cout << "顶点数: " << adjListGraph.getVertexCount() << std::endl;
@@ -482,7 +122,7 @@ void demonstrateDirectedGraphRepresentations() {
     adjMatrixGraph.addEdge(4, 3);
     adjMatrixGraph.addEdge(5, 5);  // 自环
     
-    adjMatrixGraph.printGraph();
+    printGraph(adjMatrixGraph);
     
     std::cout << "\n图信息:" << std::endl;
     std::cout << "顶点数: " << adjMatrixGraph.getVertexCount() << std::endl;
@@ -518,7 +158,7 @@ void demonstrateUndirectedGraphRepresentations() {
     undirectedGraph.addEdge(1, 2);
     undirectedGraph.addEdge(2, 3);
     
-    undirectedGraph.printGraph();
+    printGraph(undirectedGraph);
     
     std::cout << "\n图信息:" << std::endl;
     std::cout << "顶点数: " << undirectedGraph.getVertexCount() << std::endl;
@@ -530,6 +170,16 @@ void demonstrateUndirectedGraphRepresentations() {
     }
 }
 
+/**
+ * 按访问顺序打印顶点
+ * @param order 遍历得到的顶点访问顺序
+ */
+void printVisitOrder(const std::vector<int>& order) {
+    for (int vertex : order) {
+        std::cout << "访问顶点: " << vertex << std::endl;
+    }
+}
+
 /**
  * 演示图的遍历算法
  */
@@ -550,9 +200,12 @@ void demonstrateGraphTraversal() {
     graph.addEdge(4, 3);
     graph.addEdge(5, 5);
     
-    BFS(graph, 0);
-    DFSRecursive(graph, 0);
-    DFSIterative(graph, 0);
+    std::cout << "\n--- 广度优先搜索 (BFS) 从顶点 " << 0 << " 开始 ---" << std::endl;
+    printVisitOrder(BFS(graph, 0));
+    std::cout << "\n--- 深度优先搜索 (DFS) 递归版本 从顶点 " << 0 << " 开始 ---" << std::endl;
+    printVisitOrder(DFSRecursive(graph, 0));
+    std::cout << "\n--- 深度优先搜索 (DFS) 迭代版本 从顶点 " << 0 << " 开始 ---" << std::endl;
+    printVisitOrder(DFSIterative(graph, 0));
 }
 
 /**
@@ -0,0 +1,381 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#ifndef CLRS_C6_U22_GRAPH_REPRESENTATION_H
+#define CLRS_C6_U22_GRAPH_REPRESENTATION_H
+
+#include <vector>
+#include <list>
+#include <queue>
+#include <stack>
+
+#include "common/Trace.h"
+
+// 邻接表表示的有向图
+class DirectedAdjacencyListGraph {
+private:
+    int vertices;                           // 顶点数
+    std::vector<std::list<int>> adjList;    // 邻接表
+    std::vector<int> inDegree;              // 入度数组
+    
+public:
+    /**
+     * 构造函数
+     * @param v 顶点数量
+     */
+    explicit DirectedAdjacencyListGraph(int v) : vertices(v), adjList(v), inDegree(v, 0) {
+        TRACE_STEP("创建邻接表表示的有向图，包含 " << v << " 个顶点 [0.." << (v-1) << "]" << std::endl);
+    }
+    
+    /**
+     * 添加一条有向边 (u, v)
+     * @param u 起点
+     * @param v 终点
+     */
+    void addEdge(int u, int v) {
+        TRACE_STEP("添加有向边 (" << u << ", " << v << ")" << std::endl);
+        adjList[u].push_back(v);
+        inDegree[v]++;  // 增加终点的入度
+    }
+    
+    /**
+     * 获取顶点数
+     * @return 顶点数量
+     */
+    int getVertexCount() const {
+        return vertices;
+    }
+    
+    /**
+     * 获取边数
+     * @return 边的数量
+     */
+    int getEdgeCount() const {
+        int count = 0;
+        for (int i = 0; i < vertices; i++) {
+            count += adjList[i].size();
+        }
+        return count;
+    }
+    
+    /**
+     * 获取指定顶点的邻接点
+     * @param v 顶点
+     * @return 邻接点列表
+     */
+    const std::list<int>& getAdjacent(int v) const {
+        return adjList[v];
+    }
+    
+    /**
+     * 检查是否存在边 (u, v)
+     * @param u 起点
+     * @param v 终点
+     * @return 如果存在边返回true，否则返回false
+     */
+    bool hasEdge(int u, int v) const {
+        for (int neighbor : adjList[u]) {
+            if (neighbor == v) {
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    /**
+     * 获取顶点的出度
+     * @param v 顶点
+     * @return 出度
+     */
+    int getOutDegree(int v) const {
+        return adjList[v].size();
+    }
+    
+    /**
+     * 获取顶点的入度
+     * @param v 顶点
+     * @return 入度
+     */
+    int getInDegree(int v) const {
+        return inDegree[v];
+    }
+};
+
+// 邻接表表示的无向图
+class UndirectedAdjacencyListGraph {
+private:
+    int vertices;                           // 顶点数
+    std::vector<std::list<int>> adjList;    // 邻接表
+    
+public:
+    /**
+     * 构造函数
+     * @param v 顶点数量
+     */
+    explicit UndirectedAdjacencyListGraph(int v) : vertices(v), adjList(v) {
+        TRACE_STEP("创建邻接表表示的无向图，包含 " << v << " 个顶点 [0.." << (v-1) << "]" << std::endl);
+    }
+    
+    /**
+     * 添加一条无向边 (u, v)
+     * @param u 顶点u
+     * @param v 顶点v
+     */
+    void addEdge(int u, int v) {
+        TRACE_STEP("添加无向边 (" << u << ", " << v << ")" << std::endl);
+        adjList[u].push_back(v);
+        adjList[v].push_back(u);  // 无向图需要在两个顶点的邻接表中都添加对方
+    }
+    
+    /**
+     * 获取顶点数
+     * @return 顶点数量
+     */
+    int getVertexCount() const {
+        return vertices;
+    }
+    
+    /**
+     * 获取边数
+     * @return 边的数量
+     */
+    int getEdgeCount() const {
+        int count = 0;
+        for (int i = 0; i < vertices; i++) {
+            count += adjList[i].size();
+        }
+        return count / 2;  // 无向图中每条边被计算了两次
+    }
+    
+    /**
+     * 获取指定顶点的邻接点
+     * @param v 顶点
+     * @return 邻接点列表
+     */
+    const std::list<int>& getAdjacent(int v) const {
+        return adjList[v];
+    }
+    
+    /**
+     * 检查是否存在边 (u, v)
+     * @param u 顶点u
+     * @param v 顶点v
+     * @return 如果存在边返回true，否则返回false
+     */
+    bool hasEdge(int u, int v) const {
+        for (int neighbor : adjList[u]) {
+            if (neighbor == v) {
+                return true;
+            }
+        }
+        return false;
+    }
+    
+    /**
+     * 获取顶点的度数
+     * @param v 顶点
+     * @return 度数
+     */
+    int getDegree(int v) const {
+        return adjList[v].size();
+    }
+};
+
+// 邻接矩阵表示的图
+class AdjacencyMatrixGraph {
+private:
+    int vertices;                    // 顶点数
+    std::vector<std::vector<int>> adjMatrix;  // 邻接矩阵
+    
+public:
+    /**
+     * 构造函数
+     * @param v 顶点数量
+     */
+    explicit AdjacencyMatrixGraph(int v) : vertices(v), adjMatrix(v, std::vector<int>(v, 0)) {
+        TRACE_STEP("创建邻接矩阵表示的图，包含 " << v << " 个顶点 [0.." << (v-1) << "]" << std::endl);
+    }
+    
+    /**
+     * 添加一条边 (u, v)
+     * @param u 起点
+     * @param v 终点
+     */
+    void addEdge(int u, int v) {
+        TRACE_STEP("添加边 (" << u << ", " << v << ")" << std::endl);
+        adjMatrix[u][v] = 1;
+    }
+    
+    /**
+     * 获取顶点数
+     * @return 顶点数量
+     */
+    int getVertexCount() const {
+        return vertices;
+    }
+    
+    /**
+     * 获取边数
+     * @return 边的数量
+     */
+    int getEdgeCount() const {
+        int count = 0;
+        for (int i = 0; i < vertices; i++) {
+            for (int j = 0; j < vertices; j++) {
+                if (adjMatrix[i][j] == 1) {
+                    count++;
+                }
+            }
+        }
+        return count;
+    }
+    
+    /**
+     * 检查是否存在边 (u, v)
+     * @param u 起点
+     * @param v 终点
+     * @return 如果存在边返回true，否则返回false
+     */
+    bool hasEdge(int u, int v) const {
+        return adjMatrix[u][v] == 1;
+    }
+    
+    /**
+     * 获取指定顶点的出度
+     * @param v 顶点
+     * @return 出度
+     */
+    int getOutDegree(int v) const {
+        int degree = 0;
+        for (int j = 0; j < vertices; j++) {
+            if (adjMatrix[v][j] == 1) {
+                degree++;
+            }
+        }
+        return degree;
+    }
+    
+    /**
+     * 获取指定顶点的入度
+     * @param v 顶点
+     * @return 入度
+     */
+    int getInDegree(int v) const {
+        int degree = 0;
+        for (int i = 0; i < vertices; i++) {
+            if (adjMatrix[i][v] == 1) {
+                degree++;
+            }
+        }
+        return degree;
+    }
+};
+
+/**
+ * 图的遍历算法 - 广度优先搜索 (BFS)
+ * @param graph 邻接表表示的图
+ * @param start 起始顶点
+ * @return 顶点的访问顺序
+ */
+inline std::vector<int> BFS(const DirectedAdjacencyListGraph& graph, int start) {
+    int vertices = graph.getVertexCount();
+    std::vector<bool> visited(vertices, false);
+    std::vector<int> order;
+    std::queue<int> queue;
+    
+    visited[start] = true;
+    queue.push(start);
+    order.push_back(start);
+    
+    while (!queue.empty()) {
+        int current = queue.front();
+        queue.pop();
+        
+        // 访问当前顶点的所有未访问过的邻居
+        for (int neighbor : graph.getAdjacent(current)) {
+            if (!visited[neighbor]) {
+                visited[neighbor] = true;
+                queue.push(neighbor);
+                order.push_back(neighbor);
+            }
+        }
+    }
+    return order;
+}
+
+/**
+ * 图的遍历算法 - 深度优先搜索 (DFS) 递归版本
+ * @param graph 邻接表表示的图
+ * @param vertex 当前顶点
+ * @param visited 访问标记数组
+ * @param order 顶点的访问顺序
+ */
+inline void DFSUtil(const DirectedAdjacencyListGraph& graph, int vertex, std::vector<bool>& visited, std::vector<int>& order) {
+    visited[vertex] = true;
+    order.push_back(vertex);
+    
+    // 递归访问所有未访问过的邻居
+    for (int neighbor : graph.getAdjacent(vertex)) {
+        if (!visited[neighbor]) {
+            DFSUtil(graph, neighbor, visited, order);
+        }
+    }
+}
+
+/**
+ * 图的遍历算法 - 深度优先搜索 (DFS) 递归版本
+ * @param graph 邻接表表示的图
+ * @param start 起始顶点
+ * @return 顶点的访问顺序
+ */
+inline std::vector<int> DFSRecursive(const DirectedAdjacencyListGraph& graph, int start) {
+    int vertices = graph.getVertexCount();
+    std::vector<bool> visited(vertices, false);
+    std::vector<int> order;
+    
+    DFSUtil(graph, start, visited, order);
+    return order;
+}
+
+/**
+ * 图的遍历算法 - 深度优先搜索 (DFS) 迭代版本
+ * @param graph 邻接表表示的图
+ * @param start 起始顶点
+ * @return 顶点的访问顺序
+ */
+inline std::vector<int> DFSIterative(const DirectedAdjacencyListGraph& graph, int start) {
+    int vertices = graph.getVertexCount();
+    std::vector<bool> visited(vertices, false);
+    std::vector<int> order;
+    std::stack<int> stack;
+    
+    stack.push(start);
+    
+    while (!stack.empty()) {
+        int current = stack.top();
+        stack.pop();
+        
+        if (!visited[current]) {
+            visited[current] = true;
+            order.push_back(current);
+            
+            // 将所有未访问的邻居压入栈中
+            // 注意：为了保持与递归版本一致的访问顺序，我们需要逆序压栈
+            std::vector<int> neighbors;
+            for (int neighbor : graph.getAdjacent(current)) {
+                if (!visited[neighbor]) {
+                    neighbors.push_back(neighbor);
+                }
+            }
+            
+            // 逆序压栈以保证访问顺序一致
+            for (int i = neighbors.size() - 1; i >= 0; i--) {
+                stack.push(neighbors[i]);
+            }
+        }
+    }
+    return order;
+}
+
+#endif //CLRS_C6_U22_GRAPH_REPRESENTATION_H
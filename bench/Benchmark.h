@@ -0,0 +1,434 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#ifndef CLRS_BENCH_BENCHMARK_H
+#define CLRS_BENCH_BENCHMARK_H
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <ostream>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/**
+ * 统一的基准测试框架
+ *
+ * 每个测试用例分两步：
+ *   prepare(input) 在计时之外完成建表、类型转换等准备工作，返回一个可执行体
+ *   run()          被计时的部分，返回一个校验值，防止编译器把算法优化掉
+ *
+ * 测试用例按分组（sort / select / heap / tree / hash / dp / graph）注册，
+ * 由 BenchmarkMain.cpp 统一按输入规模和数据分布组合运行，结果以 CSV 或 JSON 输出。
+ * Linux 上额外记录最优一次运行的分支预测失败次数（branch_misses）与缓存未命中次数（cache_misses），
+ * 不可用时为 -1；用 CountingLess 作比较器的用例还会记录比较次数（comparisons），否则为 -1。
+ */
+namespace bench {
+
+/**
+ * 输入数据的分布
+ */
+enum class Distribution {
+    Random,      // [0, n) 上的均匀随机数
+    Sorted,      // 已升序排列
+    Reversed,    // 已降序排列
+    FewUniques,  // 只有 16 个不同的值
+    Zipf,        // Zipf 分布（s = 1），少数值大量重复
+    SqrtUniques, // 约 √n 个不同的值，每个值重复约 √n 次
+    AllEqual     // 所有元素相等
+};
+
+/**
+ * 全部分布，用于解析 --dists
+ */
+inline const std::vector<Distribution>& allDistributions() {
+    static const std::vector<Distribution> all = {
+        Distribution::Random, Distribution::Sorted, Distribution::Reversed,
+        Distribution::FewUniques, Distribution::Zipf,
+        Distribution::SqrtUniques, Distribution::AllEqual
+    };
+    return all;
+}
+
+/**
+ * 未指定 --dists 时运行的分布
+ * sqrt-uniques 与 all-equal 用于重复键密度的对比，会让 Lomuto 划分类算法退化为平方级，需显式指定：
+ *   clrs_benchmark --dists=random,sqrt-uniques,few-uniques,all-equal --filter=select/
+ */
+inline const std::vector<Distribution>& defaultDistributions() {
+    static const std::vector<Distribution> defaults = {
+        Distribution::Random, Distribution::Sorted, Distribution::Reversed,
+        Distribution::FewUniques, Distribution::Zipf
+    };
+    return defaults;
+}
+
+inline const char* distributionName(Distribution d) {
+    switch (d) {
+        case Distribution::Random:      return "random";
+        case Distribution::Sorted:      return "sorted";
+        case Distribution::Reversed:    return "reversed";
+        case Distribution::FewUniques:  return "few-uniques";
+        case Distribution::Zipf:        return "zipf";
+        case Distribution::SqrtUniques: return "sqrt-uniques";
+        case Distribution::AllEqual:    return "all-equal";
+    }
+    return "unknown";
+}
+
+/**
+ * 按名字查找分布
+ * @return 找到返回true，并写入out
+ */
+inline bool parseDistribution(const std::string& name, Distribution& out) {
+    for (Distribution d : allDistributions()) {
+        if (name == distributionName(d)) {
+            out = d;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * 生成n个取值在[0, n)内的非负整数
+ * @param d 数据分布
+ * @param n 元素个数
+ * @param seed 随机种子，同一种子生成的数据完全相同
+ */
+inline std::vector<int> generate(Distribution d, size_t n, uint32_t seed) {
+    std::vector<int> data(n);
+    std::mt19937 rng(seed);
+    int upper = n == 0 ? 0 : static_cast<int>(n - 1);
+
+    switch (d) {
+        case Distribution::Random: {
+            std::uniform_int_distribution<int> dist(0, upper);
+            for (size_t i = 0; i < n; i++) data[i] = dist(rng);
+            break;
+        }
+        case Distribution::Sorted:
+        case Distribution::Reversed: {
+            std::uniform_int_distribution<int> dist(0, upper);
+            for (size_t i = 0; i < n; i++) data[i] = dist(rng);
+            std::sort(data.begin(), data.end());
+            if (d == Distribution::Reversed) std::reverse(data.begin(), data.end());
+            break;
+        }
+        case Distribution::FewUniques: {
+            std::uniform_int_distribution<int> dist(0, 15);
+            for (size_t i = 0; i < n; i++) data[i] = dist(rng) * (upper / 16);
+            break;
+        }
+        case Distribution::SqrtUniques: {
+            int distinct = std::max(1, static_cast<int>(std::sqrt(static_cast<double>(n))));
+            std::uniform_int_distribution<int> dist(0, distinct - 1);
+            for (size_t i = 0; i < n; i++) data[i] = dist(rng) * (upper / distinct);
+            break;
+        }
+        case Distribution::AllEqual: {
+            std::fill(data.begin(), data.end(), upper / 2);
+            break;
+        }
+        case Distribution::Zipf: {
+            // 第k个值出现的概率正比于 1/k，先累积分布再二分查找
+            std::vector<double> cdf(n);
+            double sum = 0;
+            for (size_t k = 0; k < n; k++) {
+                sum += 1.0 / static_cast<double>(k + 1);
+                cdf[k] = sum;
+            }
+            std::uniform_real_distribution<double> dist(0, sum);
+            for (size_t i = 0; i < n; i++) {
+                data[i] = static_cast<int>(std::lower_bound(cdf.begin(), cdf.end(), dist(rng)) - cdf.begin());
+                if (data[i] > upper) data[i] = upper;
+            }
+            break;
+        }
+    }
+    return data;
+}
+
+/**
+ * 把一个元素转换为参与校验的整数，浮点数取其位模式（负浮点数直接转换为无符号数是未定义行为）
+ */
+template<typename V>
+uint64_t checksumBits(const V& v) {
+    if constexpr (std::is_floating_point<V>::value) {
+        uint64_t bits = 0;
+        std::memcpy(&bits, &v, sizeof(V));
+        return bits;
+    } else {
+        return static_cast<uint64_t>(v);
+    }
+}
+
+/**
+ * 对结果序列求一个与顺序相关的校验值
+ */
+template<typename Container>
+uint64_t checksum(const Container& c) {
+    uint64_t h = 1469598103934665603ULL;
+    for (const auto& v : c) {
+        h = (h ^ checksumBits(v)) * 1099511628211ULL;
+    }
+    return h;
+}
+
+using Runner = std::function<uint64_t()>;
+using Prepare = std::function<Runner(const std::vector<int>&)>;
+
+/**
+ * 一个已注册的测试用例
+ */
+struct Case {
+    std::string group;   // 分组，例如 sort
+    std::string name;    // 名称，例如 quickSort
+    size_t maxSize;      // 允许的最大输入规模，超过则跳过（平方级算法需要限制）
+    Prepare prepare;
+};
+
+/**
+ * 测试用例注册表
+ */
+class Registry {
+public:
+    void add(const std::string& group, const std::string& name, size_t maxSize, Prepare prepare) {
+        cases_.push_back({group, name, maxSize, std::move(prepare)});
+    }
+
+    const std::vector<Case>& cases() const {
+        return cases_;
+    }
+
+private:
+    std::vector<Case> cases_;
+};
+
+/**
+ * 单次测量结果
+ */
+struct Result {
+    std::string group;
+    std::string name;
+    std::string distribution;
+    size_t n;
+    int repeat;
+    double bestNs;
+    double medianNs;
+    long peakRssKb;
+    long long branchMisses;  // 最优一次运行的分支预测失败次数，不可用时为 -1
+    long long cacheMisses;   // 最优一次运行的缓存未命中次数，不可用时为 -1
+    long long comparisons;   // 最优一次运行的比较次数，用例未计数时为 -1
+    uint64_t checksum;
+
+    double nsPerElement() const {
+        return n == 0 ? 0 : medianNs / static_cast<double>(n);
+    }
+
+    // 每秒处理的百万元素数
+    double throughputMeps() const {
+        return medianNs == 0 ? 0 : static_cast<double>(n) * 1e3 / medianNs;
+    }
+};
+
+/**
+ * 进程的峰值常驻内存（KB），不支持的平台返回 -1
+ */
+inline long peakRssKb() {
+#if defined(__unix__) || defined(__APPLE__)
+    struct rusage usage {};
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return -1;
+#if defined(__APPLE__)
+    return static_cast<long>(usage.ru_maxrss / 1024);  // macOS 以字节为单位
+#else
+    return static_cast<long>(usage.ru_maxrss);
+#endif
+#else
+    return -1;
+#endif
+}
+
+/**
+ * 硬件事件
+ */
+enum class PerfEvent {
+    BranchMisses,  // 分支预测失败
+    CacheMisses    // 缓存未命中（通常为最后一级缓存）
+};
+
+/**
+ * 用户态的硬件事件计数器
+ * 仅在 Linux 上通过 perf_event_open 实现；不支持的平台、虚拟机中缺少 PMU
+ * 或权限不足（perf_event_paranoid）时 available() 返回false，读数为 -1
+ */
+class PerfCounter {
+public:
+    explicit PerfCounter(PerfEvent event) {
+#if defined(__linux__)
+        perf_event_attr attr {};
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = event == PerfEvent::BranchMisses ? PERF_COUNT_HW_BRANCH_MISSES : PERF_COUNT_HW_CACHE_MISSES;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fd_ = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+    }
+
+    ~PerfCounter() {
+#if defined(__linux__)
+        if (fd_ >= 0) close(fd_);
+#endif
+    }
+
+    PerfCounter(const PerfCounter&) = delete;
+    PerfCounter& operator=(const PerfCounter&) = delete;
+
+    bool available() const {
+        return fd_ >= 0;
+    }
+
+    void start() {
+#if defined(__linux__)
+        if (fd_ < 0) return;
+        ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+    }
+
+    /**
+     * 停止计数
+     * @return 自 start() 以来的事件次数，不可用时返回 -1
+     */
+    long long stop() {
+#if defined(__linux__)
+        if (fd_ < 0) return -1;
+        ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+        long long count = 0;
+        if (read(fd_, &count, sizeof(count)) != static_cast<ssize_t>(sizeof(count))) return -1;
+        return count;
+#else
+        return -1;
+#endif
+    }
+
+private:
+    int fd_ = -1;
+};
+
+/**
+ * 被计时部分中的比较次数，由 CountingLess 累加，measure() 在每次运行前清零
+ * 只在单线程的用例中使用
+ */
+inline long long& comparisonCount() {
+    static long long count = 0;
+    return count;
+}
+
+/**
+ * 统计比较次数的 std::less，用于比较不同算法的比较次数
+ * 每次比较多一次内存自增，使用它的各用例开销相同
+ */
+template<typename T>
+struct CountingLess {
+    bool operator()(const T& a, const T& b) const {
+        ++comparisonCount();
+        return a < b;
+    }
+};
+
+/**
+ * 运行一个测试用例repeat次，取最优值和中位数
+ */
+inline Result measure(const Case& c, Distribution d, const std::vector<int>& input, int repeat) {
+    static PerfCounter branchMisses(PerfEvent::BranchMisses);
+    static PerfCounter cacheMisses(PerfEvent::CacheMisses);
+    std::vector<double> samples;
+    uint64_t sum = 0;
+    double best = 0;
+    long long bestBranchMisses = -1;
+    long long bestCacheMisses = -1;
+    long long bestComparisons = -1;
+    for (int r = 0; r < repeat; r++) {
+        Runner run = c.prepare(input);
+        comparisonCount() = 0;
+        branchMisses.start();
+        cacheMisses.start();
+        auto start = std::chrono::steady_clock::now();
+        sum = run();
+        auto stop = std::chrono::steady_clock::now();
+        long long cache = cacheMisses.stop();
+        long long branch = branchMisses.stop();
+        double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+        if (r == 0 || ns < best) {
+            best = ns;
+            bestBranchMisses = branch;
+            bestCacheMisses = cache;
+            bestComparisons = comparisonCount() > 0 ? comparisonCount() : -1;
+        }
+        samples.push_back(ns);
+    }
+    std::sort(samples.begin(), samples.end());
+    return {c.group, c.name, distributionName(d), input.size(), repeat,
+            samples.front(), samples[samples.size() / 2], peakRssKb(),
+            bestBranchMisses, bestCacheMisses, bestComparisons, sum};
+}
+
+inline void writeCsvHeader(std::ostream& os) {
+    os << "revision,group,case,distribution,n,repeat,best_ns,median_ns,ns_per_element,throughput_meps,peak_rss_kb,branch_misses,cache_misses,comparisons\n";
+}
+
+inline void writeCsv(std::ostream& os, const std::string& revision, const Result& r) {
+    os << revision << ',' << r.group << ',' << r.name << ',' << r.distribution << ','
+       << r.n << ',' << r.repeat << ',' << r.bestNs << ',' << r.medianNs << ','
+       << r.nsPerElement() << ',' << r.throughputMeps() << ',' << r.peakRssKb << ','
+       << r.branchMisses << ',' << r.cacheMisses << ',' << r.comparisons << '\n';
+}
+
+inline void writeJson(std::ostream& os, const std::string& revision, const std::vector<Result>& results) {
+    os << "{\n  \"revision\": \"" << revision << "\",\n  \"results\": [";
+    for (size_t i = 0; i < results.size(); i++) {
+        const Result& r = results[i];
+        os << (i == 0 ? "\n" : ",\n")
+           << "    {\"group\": \"" << r.group << "\", \"case\": \"" << r.name
+           << "\", \"distribution\": \"" << r.distribution << "\", \"n\": " << r.n
+           << ", \"repeat\": " << r.repeat << ", \"best_ns\": " << r.bestNs
+           << ", \"median_ns\": " << r.medianNs << ", \"ns_per_element\": " << r.nsPerElement()
+           << ", \"throughput_meps\": " << r.throughputMeps() << ", \"peak_rss_kb\": " << r.peakRssKb
+           << ", \"branch_misses\": " << r.branchMisses << ", \"cache_misses\": " << r.cacheMisses
+           << ", \"comparisons\": " << r.comparisons << "}";
+    }
+    os << "\n  ]\n}\n";
+}
+
+// 各分组的注册函数，分别定义在对应的 *Benchmarks.cpp 中
+void registerSortBenchmarks(Registry& registry);
+void registerSelectBenchmarks(Registry& registry);
+void registerHeapBenchmarks(Registry& registry);
+void registerTreeBenchmarks(Registry& registry);
+void registerHashBenchmarks(Registry& registry);
+void registerDpBenchmarks(Registry& registry);
+void registerGraphBenchmarks(Registry& registry);
+
+} // namespace bench
+
+#endif //CLRS_BENCH_BENCHMARK_H
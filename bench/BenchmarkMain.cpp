@@ -0,0 +1,206 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Benchmark.h"
+
+#ifndef CLRS_BENCH_REVISION
+#define CLRS_BENCH_REVISION "unknown"
+#endif
+
+/**
+ * 基准测试驱动程序
+ *
+ * 用法：
+ *   clrs_benchmark [--sizes=1000,10000,100000] [--dists=random,sorted,...]
+ *                  [--filter=子串] [--repeat=5] [--seed=42]
+ *                  [--format=csv|json] [--output=文件] [--list]
+ *
+ * --filter 按 "分组/名称" 做子串匹配，例如 --filter=sort/ 只运行排序类用例。
+ * --dists 默认不含 sqrt-uniques 与 all-equal，重复键密度的对比需显式指定。
+ */
+
+namespace {
+
+struct Options {
+    std::vector<size_t> sizes = {1000, 10000, 100000};
+    std::vector<bench::Distribution> dists = bench::defaultDistributions();
+    std::string filter;
+    int repeat = 5;
+    uint32_t seed = 42;
+    std::string format = "csv";
+    std::string output;
+    bool list = false;
+};
+
+std::vector<std::string> split(const std::string& s) {
+    std::vector<std::string> parts;
+    std::stringstream ss(s);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (!item.empty()) parts.push_back(item);
+    }
+    return parts;
+}
+
+bool startsWith(const std::string& s, const std::string& prefix) {
+    return s.compare(0, prefix.size(), prefix) == 0;
+}
+
+/**
+ * 把整个字符串解析为不超过 maxValue 的非负十进制整数
+ * @return 字符串为空、含有数字以外的字符或超出范围时返回false
+ */
+bool parseUnsigned(const std::string& s, unsigned long long maxValue, unsigned long long& value) {
+    if (s.empty() || s.find_first_not_of("0123456789") != std::string::npos) {
+        return false;
+    }
+    errno = 0;
+    value = std::strtoull(s.c_str(), nullptr, 10);
+    return errno == 0 && value <= maxValue;
+}
+
+void usage() {
+    std::cerr << "用法: clrs_benchmark [--sizes=1000,10000] [--dists=random,sorted,reversed,few-uniques,zipf,sqrt-uniques,all-equal]\n"
+              << "                      [--filter=sort/] [--repeat=5] [--seed=42]\n"
+              << "                      [--format=csv|json] [--output=文件] [--list]" << std::endl;
+}
+
+/**
+ * 解析命令行参数
+ * @return 参数合法返回true
+ */
+bool parseArgs(int argc, char** argv, Options& opt) {
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (startsWith(arg, "--sizes=")) {
+            opt.sizes.clear();
+            for (const std::string& s : split(arg.substr(8))) {
+                unsigned long long n;
+                if (!parseUnsigned(s, std::numeric_limits<size_t>::max(), n)) {
+                    std::cerr << "非法的输入规模: " << s << std::endl;
+                    return false;
+                }
+                opt.sizes.push_back(static_cast<size_t>(n));
+            }
+        } else if (startsWith(arg, "--dists=")) {
+            opt.dists.clear();
+            for (const std::string& s : split(arg.substr(8))) {
+                bench::Distribution d;
+                if (!bench::parseDistribution(s, d)) {
+                    std::cerr << "未知的数据分布: " << s << std::endl;
+                    return false;
+                }
+                opt.dists.push_back(d);
+            }
+        } else if (startsWith(arg, "--filter=")) {
+            opt.filter = arg.substr(9);
+        } else if (startsWith(arg, "--repeat=")) {
+            opt.repeat = std::max(1, std::atoi(arg.c_str() + 9));
+        } else if (startsWith(arg, "--seed=")) {
+            unsigned long long seed;
+            if (!parseUnsigned(arg.substr(7), std::numeric_limits<uint32_t>::max(), seed)) {
+                std::cerr << "非法的随机种子: " << arg.substr(7) << std::endl;
+                return false;
+            }
+            opt.seed = static_cast<uint32_t>(seed);
+        } else if (startsWith(arg, "--format=")) {
+            opt.format = arg.substr(9);
+            if (opt.format != "csv" && opt.format != "json") {
+                std::cerr << "未知的输出格式: " << opt.format << std::endl;
+                return false;
+            }
+        } else if (startsWith(arg, "--output=")) {
+            opt.output = arg.substr(9);
+        } else if (arg == "--list") {
+            opt.list = true;
+        } else {
+            std::cerr << "未知参数: " << arg << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseArgs(argc, argv, opt)) {
+        usage();
+        return 1;
+    }
+
+#if CLRS_TRACE_LEVEL > CLRS_TRACE_OFF
+    std::cerr << "警告: 当前以 CLRS_TRACE_LEVEL=" << CLRS_TRACE_LEVEL
+              << " 构建，测量结果包含追踪输出的开销" << std::endl;
+#endif
+
+    bench::Registry registry;
+    bench::registerSortBenchmarks(registry);
+    bench::registerSelectBenchmarks(registry);
+    bench::registerHeapBenchmarks(registry);
+    bench::registerTreeBenchmarks(registry);
+    bench::registerHashBenchmarks(registry);
+    bench::registerDpBenchmarks(registry);
+    bench::registerGraphBenchmarks(registry);
+
+    if (opt.list) {
+        for (const bench::Case& c : registry.cases()) {
+            std::cout << c.group << "/" << c.name << " (n <= " << c.maxSize << ")" << std::endl;
+        }
+        return 0;
+    }
+
+    std::ofstream file;
+    if (!opt.output.empty()) {
+        file.open(opt.output);
+        if (!file) {
+            std::cerr << "无法打开输出文件: " << opt.output << std::endl;
+            return 1;
+        }
+    }
+    std::ostream& os = opt.output.empty() ? std::cout : file;
+
+    const std::string revision = CLRS_BENCH_REVISION;
+    std::vector<bench::Result> results;
+    if (opt.format == "csv") bench::writeCsvHeader(os);
+
+    for (const bench::Case& c : registry.cases()) {
+        if (!opt.filter.empty() && (c.group + "/" + c.name).find(opt.filter) == std::string::npos) continue;
+        for (size_t n : opt.sizes) {
+            if (n > c.maxSize) continue;
+            for (bench::Distribution d : opt.dists) {
+                std::vector<int> input = bench::generate(d, n, opt.seed);
+                bench::Result r;
+                try {
+                    r = bench::measure(c, d, input, opt.repeat);
+                } catch (const std::exception& e) {
+                    std::cerr << "校验失败（" << bench::distributionName(d) << ", n = " << n << "）: "
+                              << e.what() << std::endl;
+                    return 1;
+                }
+                if (opt.format == "csv") {
+                    bench::writeCsv(os, revision, r);
+                    os.flush();
+                } else {
+                    results.push_back(r);
+                }
+            }
+        }
+    }
+
+    if (opt.format == "json") bench::writeJson(os, revision, results);
+    return 0;
+}
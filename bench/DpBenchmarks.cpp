@@ -0,0 +1,50 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#include <string>
+#include <vector>
+
+#include "Benchmark.h"
+#include "C4/U15/P2_MATRIX-CHAIN-MULTIPLICATION/MatrixChainMultiplication.h"
+#include "C4/U15/P3_LONGEST-COMMON-SUBSEQUENCE/LongestCommonSubsequence.h"
+
+/**
+ * 动态规划类基准测试
+ */
+namespace bench {
+
+void registerDpBenchmarks(Registry& registry) {
+    // 输入前后两半各映射为一个长度 n/2、字母表为 {A,C,G,T} 的序列，DP 表为 (n/2)^2
+    registry.add("dp", "lcsLength", 1 << 12, [](const std::vector<int>& input) -> Runner {
+        std::string x, y;
+        for (size_t i = 0; i < input.size(); i++) {
+            char ch = "ACGT"[input[i] % 4];
+            (i < input.size() / 2 ? x : y) += ch;
+        }
+        return [x, y]() {
+            std::vector<std::vector<int>> c;
+            std::vector<std::vector<char>> b;
+            lcsLength(x, y, c, b);
+            return static_cast<uint64_t>(c[x.size()][y.size()]);
+        };
+    });
+
+    // n 个矩阵的维度取自输入，算法为立方级；输入为空时没有矩阵可乘
+    registry.add("dp", "matrixChainOrder", 1 << 9, [](const std::vector<int>& input) -> Runner {
+        if (input.empty()) {
+            return []() { return uint64_t(0); };
+        }
+        std::vector<int> dimensions;
+        dimensions.reserve(input.size() + 1);
+        dimensions.push_back(1);
+        for (int v : input) dimensions.push_back(v % 100 + 1);
+        return [dimensions]() {
+            size_t n = dimensions.size() - 1;
+            std::vector<std::vector<int>> splitPoints(n, std::vector<int>(n, 0));
+            return static_cast<uint64_t>(matrixChainOrder(dimensions, splitPoints));
+        };
+    });
+}
+
+} // namespace bench
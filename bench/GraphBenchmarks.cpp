@@ -0,0 +1,74 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#include <memory>
+#include <vector>
+
+#include "Benchmark.h"
+#include "C5/U21/DISJOINT-SET-DATA-STRUCTURE/DisjointSetDataStructure.h"
+#include "C6/U22/P1_GRAPH-REPRESENTATION/GraphRepresentation.h"
+
+/**
+ * 图与不相交集合类基准测试
+ *
+ * 由输入构造一个 n 个顶点的有向图：每个顶点 i 有两条出边 i -> i+1 和 i -> input[i]，
+ * 因此从顶点 0 出发可以到达全部顶点。
+ */
+namespace bench {
+
+namespace {
+
+/**
+ * 把图遍历函数包装成测试用例，建图放在计时之外
+ * 输入为空时图中没有顶点 0，不做遍历
+ */
+template<typename Traversal>
+Prepare traversal(Traversal traverse) {
+    return [traverse](const std::vector<int>& input) -> Runner {
+        if (input.empty()) {
+            return []() { return uint64_t(0); };
+        }
+        auto graph = std::make_shared<DirectedAdjacencyListGraph>(static_cast<int>(input.size()));
+        for (size_t i = 0; i < input.size(); i++) {
+            if (i + 1 < input.size()) graph->addEdge(static_cast<int>(i), static_cast<int>(i + 1));
+            graph->addEdge(static_cast<int>(i), input[i]);
+        }
+        return [traverse, graph]() {
+            return checksum(traverse(*graph, 0));
+        };
+    };
+}
+
+} // namespace
+
+void registerGraphBenchmarks(Registry& registry) {
+    const size_t unlimited = static_cast<size_t>(-1);
+
+    registry.add("graph", "BFS", unlimited, traversal([](const DirectedAdjacencyListGraph& g, int s) {
+        return BFS(g, s);
+    }));
+
+    // 递归深度可达 n
+    registry.add("graph", "DFSRecursive", 1 << 14, traversal([](const DirectedAdjacencyListGraph& g, int s) {
+        return DFSRecursive(g, s);
+    }));
+
+    registry.add("graph", "DFSIterative", unlimited, traversal([](const DirectedAdjacencyListGraph& g, int s) {
+        return DFSIterative(g, s);
+    }));
+
+    // 对 (i, input[i]) 逐对执行 UNION，再对每个元素执行 FIND-SET
+    registry.add("graph", "disjointSet", unlimited, [](const std::vector<int>& input) -> Runner {
+        return [&input]() {
+            int n = static_cast<int>(input.size());
+            DisjointSet sets(n);
+            for (int i = 0; i < n; i++) sets.unionSets(i, input[i]);
+            uint64_t h = 0;
+            for (int i = 0; i < n; i++) h += static_cast<uint64_t>(sets.findSet(i));
+            return h;
+        };
+    });
+}
+
+} // namespace bench
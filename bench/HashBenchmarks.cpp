@@ -0,0 +1,372 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Benchmark.h"
+#include "C3/U11/HASH-TABLE/ConcurrentHashTable.h"
+#include "C3/U11/HASH-TABLE/HashTable.h"
+#include "C3/U11/HASH-TABLE/OpenHashTable.h"
+#include "C3/U11/HASH-TABLE/PerfectHashTable.h"
+
+/**
+ * 散列表类基准测试：插入全部键值对，再逐个查找
+ * hashTable.grow / hashTable.incrementalGrow 从 16 个桶开始自动扩容
+ * hashLoad 组固定装载因子（0.5、0.7、0.9），比较链接法、开放寻址与 std::unordered_map，
+ * 查找既包括命中，也包括同样多次的未命中
+ * concurrentHash 组多个线程同时读写同一张表，按读操作所占的比例（50%、90%、99%）
+ * 比较分片并发散列表（逐个操作与批量操作）与一把读写锁保护的 HashTable
+ * hashPolicy 组比较 HashTable 的散列函数策略：整数关键字原样使用，或左移 12 位
+ * （.strided，低 12 位全为 0，模拟对齐的地址、按步长分配的编号），以及 "user:<数字>" 形式的字符串；
+ * openHashTable.* 用开放寻址表重复整数关键字的测试，检验对齐的关键字是否让指纹失效
+ * perfectHash 组在准备阶段用去重后的输入建好只读的表，只计时查找（全部命中），
+ * perfectHashTable.build 单独计时完美散列表的构造
+ */
+namespace bench {
+
+namespace {
+
+/**
+ * 装载因子固定的测试规模：槽数取 2 的幂，插入的键值对个数为槽数乘以装载因子
+ */
+struct LoadPlan {
+    size_t slots;
+    size_t keys;
+};
+
+/**
+ * 取使装载因子为 load 时所需元素不超过 n 的最大的槽数
+ * 输入中有重复的关键字时实际装载因子会更低，few-uniques 等分布下只能作为参考
+ */
+LoadPlan planForLoad(size_t n, double load) {
+    size_t slots = kOpenHashGroupWidth;
+    while (static_cast<double>(slots * 2) * load <= static_cast<double>(n)) {
+        slots *= 2;
+    }
+    return {slots, std::min(n, static_cast<size_t>(static_cast<double>(slots) * load))};
+}
+
+/**
+ * 插入前 keys 个元素，再查找它们（命中）以及它们的相反数减一（输入非负，一定未命中）
+ * Table 需要提供 put、get、contains
+ */
+template<typename Table>
+uint64_t putGetMiss(Table& table, const std::vector<int>& input, size_t keys) {
+    for (size_t i = 0; i < keys; i++) table.put(input[i], static_cast<int>(i));
+    uint64_t h = 0;
+    for (size_t i = 0; i < keys; i++) h += static_cast<uint64_t>(table.get(input[i]));
+    for (size_t i = 0; i < keys; i++) h += table.contains(-1 - input[i]) ? 1 : 0;
+    return h;
+}
+
+/**
+ * 第 i 个操作是否为读操作：用乘法散列打乱，使读写在每个线程中均匀交错
+ */
+bool isRead(size_t i, int readPercent) {
+    return static_cast<int>(((static_cast<uint64_t>(i) * 2654435761u) >> 16) % 100) < readPercent;
+}
+
+/**
+ * 多线程读写测试：全部关键字在准备阶段插入，第 t 个线程处理下标模 threads 余 t 的操作，
+ * 读操作查找 input[i]，写操作把 input[i] 的值更新为 i
+ * @param apply 处理一个线程的全部操作，返回命中的读操作数
+ * @return 命中的读操作总数，读取的关键字都已插入，因此与读操作数相等
+ */
+template<typename Apply>
+uint64_t runThreads(size_t threads, Apply apply) {
+    std::atomic<uint64_t> hits{0};
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threads; t++) {
+        workers.emplace_back([&, t] { hits += apply(t); });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    return hits;
+}
+
+/**
+ * 插入全部关键字，再逐个查找
+ */
+template<typename Table, typename Key>
+uint64_t putGetAll(Table& table, const std::vector<Key>& keys) {
+    for (size_t i = 0; i < keys.size(); i++) table.put(keys[i], static_cast<int>(i));
+    uint64_t h = 0;
+    for (const Key& key : keys) h += static_cast<uint64_t>(table.get(key));
+    return h;
+}
+
+/**
+ * 注册一个散列函数策略的测试：关键字在准备阶段由输入转换得到
+ * @tparam Table 散列表模板（HashTable 或 OpenHashTable）
+ * @param makeKey 把输入元素转换为关键字
+ */
+template<typename Key, typename Hash, template<typename...> class Table = HashTable, typename MakeKey>
+void addHashPolicyCase(Registry& registry, const std::string& name, size_t maxSize, MakeKey makeKey) {
+    registry.add("hashPolicy", name, maxSize, [makeKey](const std::vector<int>& input) -> Runner {
+        auto keys = std::make_shared<std::vector<Key>>();
+        keys->reserve(input.size());
+        for (int x : input) keys->push_back(makeKey(x));
+        return [keys]() {
+            Table<Key, int, Hash> table(keys->size());
+            return putGetAll(table, *keys);
+        };
+    });
+}
+
+/**
+ * 去重后的键值对，值为关键字第一次出现的下标
+ */
+std::vector<std::pair<int, int>> uniqueItems(const std::vector<int>& input) {
+    std::unordered_map<int, int> first;
+    std::vector<std::pair<int, int>> items;
+    for (size_t i = 0; i < input.size(); i++) {
+        if (first.emplace(input[i], static_cast<int>(i)).second) {
+            items.emplace_back(input[i], static_cast<int>(i));
+        }
+    }
+    return items;
+}
+
+/**
+ * 逐个查找全部关键字，Table 需要提供 get
+ */
+template<typename Table>
+uint64_t lookupAll(const Table& table, const std::vector<int>& keys) {
+    uint64_t h = 0;
+    for (int key : keys) h += static_cast<uint64_t>(table.get(key));
+    return h;
+}
+
+// 一把读写锁保护的链接法散列表，作为对照
+struct LockedHashTable {
+    HashTable<int, int> table;
+    mutable std::shared_mutex mutex;
+
+    explicit LockedHashTable(size_t capacity) : table(capacity) {}
+};
+
+} // namespace
+
+void registerHashBenchmarks(Registry& registry) {
+    const size_t unlimited = static_cast<size_t>(-1);
+
+    registry.add("hash", "std::unordered_map", unlimited, [](const std::vector<int>& input) -> Runner {
+        return [&input]() {
+            std::unordered_map<int, int> table(input.size());
+            for (size_t i = 0; i < input.size(); i++) table[input[i]] = static_cast<int>(i);
+            uint64_t h = 0;
+            for (int key : input) h += static_cast<uint64_t>(table.at(key));
+            return h;
+        };
+    });
+
+    // 桶数与元素个数相同，装载因子约为1
+    registry.add("hash", "hashTable", unlimited, [](const std::vector<int>& input) -> Runner {
+        return [&input]() {
+            HashTable<int, int> table(input.empty() ? 1 : input.size());
+            for (size_t i = 0; i < input.size(); i++) table.put(input[i], static_cast<int>(i));
+            uint64_t h = 0;
+            for (int key : input) h += static_cast<uint64_t>(table.get(key));
+            return h;
+        };
+    });
+
+    // 从 16 个桶开始自动扩容：一次性迁移与增量迁移
+    for (bool incremental : {false, true}) {
+        registry.add("hash", incremental ? "hashTable.incrementalGrow" : "hashTable.grow", unlimited,
+                     [incremental](const std::vector<int>& input) -> Runner {
+            return [&input, incremental]() {
+                HashTable<int, int> table(16);
+                table.setIncrementalRehash(incremental);
+                for (size_t i = 0; i < input.size(); i++) table.put(input[i], static_cast<int>(i));
+                uint64_t h = 0;
+                for (int key : input) h += static_cast<uint64_t>(table.get(key));
+                return h;
+            };
+        });
+    }
+
+    // 槽数按元素个数预留（向上取到 2 的幂），装载因子超过 0.875 时会扩容一次
+    registry.add("hash", "openHashTable", unlimited, [](const std::vector<int>& input) -> Runner {
+        return [&input]() {
+            OpenHashTable<int, int> table(input.size());
+            for (size_t i = 0; i < input.size(); i++) table.put(input[i], static_cast<int>(i));
+            uint64_t h = 0;
+            for (int key : input) h += static_cast<uint64_t>(table.get(key));
+            return h;
+        };
+    });
+
+    for (double load : {0.5, 0.7, 0.9}) {
+        const std::string suffix = ".load" + std::to_string(static_cast<int>(load * 100));
+
+        registry.add("hashLoad", "std::unordered_map" + suffix, unlimited, [load](const std::vector<int>& input) -> Runner {
+            return [&input, load]() {
+                LoadPlan plan = planForLoad(input.size(), load);
+                std::unordered_map<int, int> table;
+                table.max_load_factor(1.0f);
+                table.rehash(plan.slots);
+                for (size_t i = 0; i < plan.keys; i++) table[input[i]] = static_cast<int>(i);
+                uint64_t h = 0;
+                for (size_t i = 0; i < plan.keys; i++) h += static_cast<uint64_t>(table.at(input[i]));
+                for (size_t i = 0; i < plan.keys; i++) h += table.count(-1 - input[i]);
+                return h;
+            };
+        });
+
+        registry.add("hashLoad", "hashTable" + suffix, unlimited, [load](const std::vector<int>& input) -> Runner {
+            return [&input, load]() {
+                LoadPlan plan = planForLoad(input.size(), load);
+                HashTable<int, int> table(plan.slots);
+                return putGetMiss(table, input, plan.keys);
+            };
+        });
+
+        // 扩容阈值调到 0.95，保证测量过程中不扩容
+        registry.add("hashLoad", "openHashTable" + suffix, unlimited, [load](const std::vector<int>& input) -> Runner {
+            return [&input, load]() {
+                LoadPlan plan = planForLoad(input.size(), load);
+                OpenHashTable<int, int> table(plan.slots);
+                table.setMaxLoadFactor(0.95);
+                return putGetMiss(table, input, plan.keys);
+            };
+        });
+    }
+
+    const size_t threads = 4;
+    for (int readPercent : {50, 90, 99}) {
+        const std::string suffix = "[" + std::to_string(threads) + "].read" + std::to_string(readPercent);
+
+        registry.add("concurrentHash", "concurrentHashTable" + suffix, unlimited,
+                     [readPercent, threads](const std::vector<int>& input) -> Runner {
+            auto table = std::make_shared<ConcurrentHashTable<int, int>>(input.size() * 2);
+            for (size_t i = 0; i < input.size(); i++) table->put(input[i], static_cast<int>(i));
+            return [&input, table, readPercent, threads]() {
+                uint64_t hits = runThreads(threads, [&](size_t t) {
+                    uint64_t local = 0;
+                    for (size_t i = t; i < input.size(); i += threads) {
+                        if (isRead(i, readPercent)) {
+                            local += table->find(input[i]).has_value() ? 1 : 0;
+                        } else {
+                            table->put(input[i], static_cast<int>(i));
+                        }
+                    }
+                    return local;
+                });
+                return static_cast<uint64_t>(table->size()) * 31 + hits;
+            };
+        });
+
+        // 每 1024 个操作分成一批读、一批写，按分片分组后执行：每个分片平均 16 个关键字共用一次加锁或校验
+        registry.add("concurrentHash", "concurrentHashTable" + suffix + ".batch", unlimited,
+                     [readPercent, threads](const std::vector<int>& input) -> Runner {
+            auto table = std::make_shared<ConcurrentHashTable<int, int>>(input.size() * 2);
+            for (size_t i = 0; i < input.size(); i++) table->put(input[i], static_cast<int>(i));
+            return [&input, table, readPercent, threads]() {
+                uint64_t hits = runThreads(threads, [&](size_t t) {
+                    uint64_t local = 0;
+                    std::vector<int> reads;
+                    std::vector<std::pair<int, int>> writes;
+                    for (size_t i = t; i < input.size(); ) {
+                        reads.clear();
+                        writes.clear();
+                        for (size_t k = 0; k < 1024 && i < input.size(); k++, i += threads) {
+                            if (isRead(i, readPercent)) {
+                                reads.push_back(input[i]);
+                            } else {
+                                writes.emplace_back(input[i], static_cast<int>(i));
+                            }
+                        }
+                        for (const auto& value : table->getBatch(reads)) local += value.has_value() ? 1 : 0;
+                        table->putBatch(writes);
+                    }
+                    return local;
+                });
+                return static_cast<uint64_t>(table->size()) * 31 + hits;
+            };
+        });
+
+        registry.add("concurrentHash", "lockedHashTable" + suffix, unlimited,
+                     [readPercent, threads](const std::vector<int>& input) -> Runner {
+            auto locked = std::make_shared<LockedHashTable>(input.empty() ? 1 : input.size());
+            for (size_t i = 0; i < input.size(); i++) locked->table.put(input[i], static_cast<int>(i));
+            return [&input, locked, readPercent, threads]() {
+                uint64_t hits = runThreads(threads, [&](size_t t) {
+                    uint64_t local = 0;
+                    for (size_t i = t; i < input.size(); i += threads) {
+                        if (isRead(i, readPercent)) {
+                            std::shared_lock<std::shared_mutex> lock(locked->mutex);
+                            local += locked->table.contains(input[i]) ? 1 : 0;
+                        } else {
+                            std::unique_lock<std::shared_mutex> lock(locked->mutex);
+                            locked->table.put(input[i], static_cast<int>(i));
+                        }
+                    }
+                    return local;
+                });
+                return static_cast<uint64_t>(locked->table.size()) * 31 + hits;
+            };
+        });
+    }
+
+    auto plain = [](int x) { return static_cast<uint64_t>(x); };
+    auto strided = [](int x) { return static_cast<uint64_t>(x) << 12; };
+    auto named = [](int x) { return "user:" + std::to_string(x); };
+    addHashPolicyCase<uint64_t, std::hash<uint64_t>>(registry, "std::hash", unlimited, plain);
+    addHashPolicyCase<uint64_t, MultiplyShiftHash<uint64_t>>(registry, "multiplyShift", unlimited, plain);
+    addHashPolicyCase<uint64_t, TabulationHash<uint64_t>>(registry, "tabulation", unlimited, plain);
+    // std::hash 是恒等映射，左移后全部关键字只落进 n / 4096 个桶，查找退化为 Θ(n) 次比较，只测较小的规模
+    addHashPolicyCase<uint64_t, std::hash<uint64_t>>(registry, "std::hash.strided", 10000, strided);
+    addHashPolicyCase<uint64_t, MultiplyShiftHash<uint64_t>>(registry, "multiplyShift.strided", unlimited, strided);
+    addHashPolicyCase<uint64_t, TabulationHash<uint64_t>>(registry, "tabulation.strided", unlimited, strided);
+    // 开放寻址表把散列值乘以 2^64 / phi 后取高位，std::hash 的 .strided 也不会退化；
+    // 指纹取自同一高半部分，对齐的关键字也不会全部得到相同的指纹
+    addHashPolicyCase<uint64_t, std::hash<uint64_t>, OpenHashTable>(registry, "openHashTable.std::hash", unlimited, plain);
+    addHashPolicyCase<uint64_t, std::hash<uint64_t>, OpenHashTable>(registry, "openHashTable.std::hash.strided", unlimited, strided);
+    addHashPolicyCase<uint64_t, MultiplyShiftHash<uint64_t>, OpenHashTable>(registry, "openHashTable.multiplyShift.strided", unlimited, strided);
+    addHashPolicyCase<std::string, std::hash<std::string>>(registry, "std::hash.string", unlimited, named);
+    addHashPolicyCase<std::string, FastStringHash>(registry, "fastStringHash.string", unlimited, named);
+
+    registry.add("perfectHash", "perfectHashTable.build", unlimited, [](const std::vector<int>& input) -> Runner {
+        auto items = std::make_shared<std::vector<std::pair<int, int>>>(uniqueItems(input));
+        return [items]() {
+            PerfectHashTable<int, int> table(*items);
+            return static_cast<uint64_t>(table.bytes());
+        };
+    });
+
+    registry.add("perfectHash", "perfectHashTable", unlimited, [](const std::vector<int>& input) -> Runner {
+        auto table = std::make_shared<PerfectHashTable<int, int>>(uniqueItems(input));
+        return [&input, table]() { return lookupAll(*table, input); };
+    });
+
+    registry.add("perfectHash", "openHashTable", unlimited, [](const std::vector<int>& input) -> Runner {
+        auto table = std::make_shared<OpenHashTable<int, int>>(input.size());
+        for (const auto& item : uniqueItems(input)) table->put(item.first, item.second);
+        return [&input, table]() { return lookupAll(*table, input); };
+    });
+
+    registry.add("perfectHash", "std::unordered_map", unlimited, [](const std::vector<int>& input) -> Runner {
+        auto items = uniqueItems(input);
+        auto table = std::make_shared<std::unordered_map<int, int>>(items.begin(), items.end());
+        return [&input, table]() {
+            uint64_t h = 0;
+            for (int key : input) h += static_cast<uint64_t>(table->at(key));
+            return h;
+        };
+    });
+}
+
+} // namespace bench
@@ -0,0 +1,271 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "Benchmark.h"
+#include "C2/U6/PRIORITY-QUEUE/PriorityQueue.h"
+#include "C5/U19/FIBONACCI-HEAP/FibonacciHeap.h"
+#include "C5/U19/PAIRING-HEAP/PairingHeap.h"
+#include "C5/U19/RADIX-HEAP/RadixHeap.h"
+
+/**
+ * 堆类基准测试：依次插入全部元素，再逐个取出
+ * *.insertClear 只插入、不抽取，由析构函数释放全部节点
+ * heapTrace 组在斐波那契堆、配对堆、基数堆上重放同一条操作轨迹（插入、抽取最小值、减小关键字）
+ */
+namespace bench {
+
+namespace {
+
+/**
+ * 操作轨迹中的一步，target 为第几次插入的节点
+ */
+struct HeapOp {
+    enum Kind : uint8_t { Insert, ExtractMin, DecreaseKey } kind;
+    int key;
+    uint32_t target;
+};
+
+/**
+ * 由输入生成操作轨迹：每个输入元素对应一次插入和一次减小关键字，每两个元素抽取一次最小值，最后全部取出
+ * 生成时模拟堆的内容。关键字相同时各种堆抽取出的节点可能不同，因此每次抽取后，
+ * 与被抽取关键字相同的节点都不再作为减小关键字的目标，保证轨迹在任何堆上重放时目标都仍在堆中。
+ * @param monotone 为 true 时模拟 Dijkstra：新关键字为 last 加上一个非负增量，且不小于最近抽取的最小值 last
+ */
+std::vector<HeapOp> makeHeapTrace(const std::vector<int>& input, bool monotone) {
+    std::vector<HeapOp> trace;
+    trace.reserve(input.size() * 3);
+    std::multiset<int> heap;                      // 堆中的关键字
+    std::set<std::pair<int, uint32_t>> targets;   // 可以作为减小关键字目标的 (关键字, 节点编号)
+    std::vector<uint32_t> live;                   // 同上，用于随机挑选
+    std::vector<size_t> slot;                     // 节点编号在 live 中的位置
+    std::vector<int> keyOf;
+    int last = 0;
+
+    auto untarget = [&](uint32_t id) {
+        uint32_t moved = live.back();
+        live[slot[id]] = moved;
+        slot[moved] = slot[id];
+        live.pop_back();
+    };
+    auto extract = [&] {
+        last = *heap.begin();
+        heap.erase(heap.begin());
+        auto it = targets.lower_bound({last, 0});
+        while (it != targets.end() && it->first == last) {
+            untarget(it->second);
+            it = targets.erase(it);
+        }
+        trace.push_back({HeapOp::ExtractMin, 0, 0});
+    };
+
+    for (size_t i = 0; i < input.size(); i++) {
+        uint32_t x = static_cast<uint32_t>(input[i]) * 2654435761u;
+        uint32_t id = static_cast<uint32_t>(i);
+        int key = monotone ? last + static_cast<int>(x % 65536) : input[i];
+        heap.insert(key);
+        targets.insert({key, id});
+        slot.push_back(live.size());
+        live.push_back(id);
+        keyOf.push_back(key);
+        trace.push_back({HeapOp::Insert, key, id});
+
+        // 随机挑一个节点减小关键字
+        uint32_t target = live[(x >> 16) % live.size()];
+        int lower = keyOf[target] - static_cast<int>((x >> 8) % 1024) - 1;
+        if (monotone && lower < last) lower = last;
+        if (lower < keyOf[target]) {
+            heap.erase(heap.find(keyOf[target]));
+            heap.insert(lower);
+            targets.erase({keyOf[target], target});
+            targets.insert({lower, target});
+            keyOf[target] = lower;
+            trace.push_back({HeapOp::DecreaseKey, lower, target});
+        }
+
+        if (i % 2 == 1) {
+            extract();
+        }
+    }
+    while (!heap.empty()) {
+        extract();
+    }
+    return trace;
+}
+
+/**
+ * 在堆上重放操作轨迹，返回抽取出的关键字序列的校验和
+ */
+template<typename Heap>
+uint64_t replayHeapTrace(const std::vector<HeapOp>& trace, std::vector<typename Heap::Node*>& nodes) {
+    Heap heap;
+    uint64_t h = 0;
+    for (const HeapOp& op : trace) {
+        switch (op.kind) {
+            case HeapOp::Insert:
+                nodes[op.target] = heap.insert(op.key);
+                break;
+            case HeapOp::ExtractMin: {
+                typename Heap::Node* node = heap.extractMin();
+                h = h * 31 + static_cast<uint64_t>(node->key);
+                heap.release(node);
+                break;
+            }
+            case HeapOp::DecreaseKey:
+                heap.decreaseKey(nodes[op.target], op.key);
+                break;
+        }
+    }
+    return h;
+}
+
+/**
+ * 注册一个重放轨迹的测试用例：轨迹与节点表在准备阶段生成
+ */
+template<typename Heap>
+Prepare heapTraceCase(bool monotone) {
+    return [monotone](const std::vector<int>& input) -> Runner {
+        auto trace = std::make_shared<std::vector<HeapOp>>(makeHeapTrace(input, monotone));
+        auto nodes = std::make_shared<std::vector<typename Heap::Node*>>(input.size());
+        return [trace, nodes]() {
+            return replayHeapTrace<Heap>(*trace, *nodes);
+        };
+    };
+}
+
+/**
+ * 依次插入全部元素，再逐个取出
+ */
+template<typename Heap>
+Prepare insertExtractCase() {
+    return [](const std::vector<int>& input) -> Runner {
+        return [&input]() {
+            Heap heap;
+            for (int key : input) {
+                heap.insert(key);
+            }
+            uint64_t h = 0;
+            while (typename Heap::Node* node = heap.extractMin()) {
+                h = h * 31 + static_cast<uint64_t>(node->key);
+                heap.release(node);
+            }
+            return h;
+        };
+    };
+}
+
+/**
+ * 插入全部元素后直接销毁堆，衡量节点分配与整体释放的代价
+ */
+template<typename Heap>
+Prepare insertClearCase() {
+    return [](const std::vector<int>& input) -> Runner {
+        return [&input]() {
+            Heap heap;
+            for (int key : input) {
+                heap.insert(key);
+            }
+            typename Heap::Node* top = heap.minimum();
+            return static_cast<uint64_t>(heap.size()) * 31 + static_cast<uint64_t>(top == nullptr ? 0 : top->key);
+        };
+    };
+}
+
+} // namespace
+
+void registerHeapBenchmarks(Registry& registry) {
+    const size_t unlimited = static_cast<size_t>(-1);
+
+    registry.add("heap", "priorityQueue", unlimited, [](const std::vector<int>& input) -> Runner {
+        return [&input]() {
+            std::vector<int> heap;
+            heap.reserve(input.size());
+            int heapSize = 0;
+            for (int key : input) {
+                heapInsert(heap, heapSize, key);
+            }
+            uint64_t h = 0;
+            while (heapSize > 0) {
+                h = h * 31 + static_cast<uint64_t>(heapExtractMax(heap, heapSize));
+            }
+            return h;
+        };
+    });
+
+    registry.add("heap", "indexedPriorityQueue", unlimited, [](const std::vector<int>& input) -> Runner {
+        return [&input]() {
+            IndexedPriorityQueue<int, int> queue;
+            for (int key : input) {
+                queue.push(key, 0);
+            }
+            uint64_t h = 0;
+            while (!queue.empty()) {
+                h = h * 31 + static_cast<uint64_t>(queue.pop().first);
+            }
+            return h;
+        };
+    });
+
+    // 批量建堆（buildMaxHeap，O(n)）代替逐个插入
+    registry.add("heap", "indexedPriorityQueue.heapify", unlimited, [](const std::vector<int>& input) -> Runner {
+        return [&input]() {
+            std::vector<std::pair<int, int>> items;
+            items.reserve(input.size());
+            for (int key : input) {
+                items.emplace_back(key, 0);
+            }
+            IndexedPriorityQueue<int, int> queue(std::move(items));
+            uint64_t h = 0;
+            while (!queue.empty()) {
+                h = h * 31 + static_cast<uint64_t>(queue.pop().first);
+            }
+            return h;
+        };
+    });
+
+    // 先全部插入，再对每个元素做一次 increaseKey，模拟 Dijkstra 的松弛操作
+    registry.add("heap", "indexedPriorityQueue.increaseKey", unlimited, [](const std::vector<int>& input) -> Runner {
+        return [&input]() {
+            IndexedPriorityQueue<int, int> queue;
+            std::vector<IndexedPriorityQueue<int, int>::Handle> handles;
+            handles.reserve(input.size());
+            for (int key : input) {
+                handles.push_back(queue.push(key / 2, 0));
+            }
+            for (size_t i = 0; i < input.size(); i++) {
+                queue.increaseKey(handles[i], input[i]);
+            }
+            uint64_t h = 0;
+            while (!queue.empty()) {
+                h = h * 31 + static_cast<uint64_t>(queue.pop().first);
+            }
+            return h;
+        };
+    });
+
+    registry.add("heap", "fibonacciHeap", unlimited, insertExtractCase<FibonacciHeap>());
+    registry.add("heap", "pairingHeap", unlimited, insertExtractCase<PairingHeap>());
+    // 先插入全部元素再取出，关键字不小于初始的 last，满足单调性
+    registry.add("heap", "radixHeap", unlimited, insertExtractCase<RadixHeap>());
+
+    // 斐波那契堆的节点来自节点池，销毁时整块释放；配对堆逐个 delete
+    registry.add("heap", "fibonacciHeap.insertClear", unlimited, insertClearCase<FibonacciHeap>());
+    registry.add("heap", "pairingHeap.insertClear", unlimited, insertClearCase<PairingHeap>());
+
+    // Dijkstra 式的单调轨迹，三种堆都适用
+    registry.add("heapTrace", "fibonacciHeap.dijkstra", unlimited, heapTraceCase<FibonacciHeap>(true));
+    registry.add("heapTrace", "pairingHeap.dijkstra", unlimited, heapTraceCase<PairingHeap>(true));
+    registry.add("heapTrace", "radixHeap.dijkstra", unlimited, heapTraceCase<RadixHeap>(true));
+
+    // 关键字任意的轨迹，基数堆不适用
+    registry.add("heapTrace", "fibonacciHeap.mixed", unlimited, heapTraceCase<FibonacciHeap>(false));
+    registry.add("heapTrace", "pairingHeap.mixed", unlimited, heapTraceCase<PairingHeap>(false));
+}
+
+} // namespace bench
@@ -0,0 +1,114 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#include <algorithm>
+#include <vector>
+
+#include "Benchmark.h"
+#include "C2/U9/QUANTILE-SKETCH/KllSketch.h"
+#include "C2/U9/RANDOMIZED-SELECT/IntroSelect.h"
+#include "C2/U9/RANDOMIZED-SELECT/RandomizedSelect.h"
+
+/**
+ * 选择类基准测试：求输入的中位数；quantile 组一次求出 p50/p90/p99/p999 四个分位数
+ */
+namespace bench {
+
+void registerSelectBenchmarks(Registry& registry) {
+    const size_t unlimited = static_cast<size_t>(-1);
+
+    registry.add("select", "std::nth_element", unlimited, [](const std::vector<int>& input) -> Runner {
+        return [data = input]() mutable -> uint64_t {
+            if (data.empty()) return 0;
+            auto mid = data.begin() + data.size() / 2;
+            std::nth_element(data.begin(), mid, data.end());
+            return static_cast<uint64_t>(*mid);
+        };
+    });
+
+    // Floyd–Rivest 抽样 + 中位数的中位数兜底
+    registry.add("select", "nthElement", unlimited, [](const std::vector<int>& input) -> Runner {
+        return [data = input]() mutable -> uint64_t {
+            if (data.empty()) return 0;
+            return static_cast<uint64_t>(nthElement(data, static_cast<int>(data.size() / 2)));
+        };
+    });
+
+    // 只用兜底算法，衡量最坏情况保证的常数
+    registry.add("select", "medianOfMediansSelect", unlimited, [](const std::vector<int>& input) -> Runner {
+        return [data = input]() mutable -> uint64_t {
+            if (data.empty()) return 0;
+            int mid = static_cast<int>(data.size() / 2);
+            medianOfMediansSelect(data, 0, static_cast<int>(data.size()) - 1, mid, std::less<int>());
+            return static_cast<uint64_t>(data[mid]);
+        };
+    });
+
+    // 三路划分把等于基准的元素一次性排除，全部相等时一轮结束
+    registry.add("select", "threeWayRandomizedSelect", unlimited, [](const std::vector<int>& input) -> Runner {
+        return [data = input]() mutable -> uint64_t {
+            if (data.empty()) return 0;
+            return static_cast<uint64_t>(threeWayRandomizedSelect(data, static_cast<int>(data.size() / 2 + 1)));
+        };
+    });
+
+    // Lomuto 划分遇到大量重复元素时退化为平方级
+    registry.add("select", "randomizedSelect", 1 << 16, [](const std::vector<int>& input) -> Runner {
+        return [data = input]() mutable -> uint64_t {
+            if (data.empty()) return 0;
+            return static_cast<uint64_t>(randomizedSelect(data, static_cast<int>(data.size() / 2 + 1)));
+        };
+    });
+
+    static const std::vector<double> percentiles = {0.5, 0.9, 0.99, 0.999};
+
+    registry.add("quantile", "quantiles", unlimited, [](const std::vector<int>& input) -> Runner {
+        return [data = input]() mutable -> uint64_t {
+            if (data.empty()) return 0;
+            uint64_t checksum = 0;
+            for (int v : quantiles(data, percentiles)) checksum = checksum * 31 + static_cast<uint64_t>(v);
+            return checksum;
+        };
+    });
+
+    // 每个分位数各调用一次 std::nth_element，后一次只在前一次的右侧继续
+    registry.add("quantile", "std::nth_element", unlimited, [](const std::vector<int>& input) -> Runner {
+        return [data = input]() mutable -> uint64_t {
+            if (data.empty()) return 0;
+            uint64_t checksum = 0;
+            auto first = data.begin();
+            for (double q : percentiles) {
+                auto nth = data.begin() + quantileRank(q, data.size());
+                std::nth_element(first, nth, data.end());
+                checksum = checksum * 31 + static_cast<uint64_t>(*nth);
+                first = nth;
+            }
+            return checksum;
+        };
+    });
+
+    // 流式近似：逐个接收元素，内存与 n 无关
+    registry.add("quantile", "kllSketch", unlimited, [](const std::vector<int>& input) -> Runner {
+        return [&input]() -> uint64_t {
+            if (input.empty()) return 0;
+            KllSketch<int> sketch(kKllDefaultK, 1);
+            for (int x : input) sketch.update(x);
+            uint64_t checksum = 0;
+            for (int v : sketch.quantiles(percentiles)) checksum = checksum * 31 + static_cast<uint64_t>(v);
+            return checksum;
+        };
+    });
+
+    registry.add("quantile", "std::sort", unlimited, [](const std::vector<int>& input) -> Runner {
+        return [data = input]() mutable -> uint64_t {
+            if (data.empty()) return 0;
+            std::sort(data.begin(), data.end());
+            uint64_t checksum = 0;
+            for (double q : percentiles) checksum = checksum * 31 + static_cast<uint64_t>(data[quantileRank(q, data.size())]);
+            return checksum;
+        };
+    });
+}
+
+} // namespace bench
@@ -0,0 +1,369 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Benchmark.h"
+#include "C1/U2/INSERTION-SORT/InsertionSort.h"
+#include "C1/U2/MERGE-SORT/ExternalSort.h"
+#include "C1/U2/MERGE-SORT/MergeSort.h"
+#include "C1/U2/SORTING-NETWORK/SortingNetwork.h"
+#include "C2/U6/HEAP-SORT/HeapSort.h"
+#include "C2/U7/HOARE-PARTITION/HoarePartition.h"
+#include "C2/U7/QUICK-SORT/ParallelQuickSort.h"
+#include "C2/U7/QUICK-SORT/QuickSort.h"
+#include "C2/U8/P1_COUNTING-SORT/CountingSort.h"
+#include "C2/U8/P2_RADIX-SORT/ParallelRadixSort.h"
+#include "C2/U8/P2_RADIX-SORT/RadixSort.h"
+#include "C2/U8/P3_BUCKET-SORT/BucketSort.h"
+
+/**
+ * 排序类基准测试：每次运行排序输入的一份拷贝
+ */
+namespace bench {
+
+namespace {
+
+/**
+ * 把原地排序函数包装成测试用例
+ */
+template<typename Sort>
+Prepare inPlace(Sort sort) {
+    return [sort](const std::vector<int>& input) -> Runner {
+        return [sort, data = input]() mutable {
+            sort(data);
+            return checksum(data);
+        };
+    };
+}
+
+/**
+ * 与顺序无关的校验值：各元素位模式混合后求和，只要元素的多重集合（包括 -0.0 与 +0.0 各自的个数）不变，结果就不变
+ */
+uint64_t multisetChecksum(const std::vector<float>& data) {
+    uint64_t sum = 0;
+    for (float x : data) {
+        uint64_t h = checksumBits(x);
+        h = (h ^ (h >> 33)) * 0xFF51AFD7ED558CCDULL;
+        h = (h ^ (h >> 33)) * 0xC4CEB9FE1A85EC53ULL;
+        sum += h ^ (h >> 33);
+    }
+    return sum;
+}
+
+/**
+ * 把浮点数组上的排序函数包装成测试用例：输入由 makeInput 在计时之外生成，
+ * 排序后检查结果有序，且是输入的一个排列；相等的元素（例如 -0.0 与 +0.0）可以按任意顺序排列。
+ * 检查不通过时抛出 std::logic_error
+ */
+template<typename MakeInput, typename Sort>
+Prepare checkedFloatSort(const std::string& name, MakeInput makeInput, Sort sort) {
+    return [name, makeInput, sort](const std::vector<int>& input) -> Runner {
+        std::vector<float> data = makeInput(input);
+        return [name, sort, data, expectedSum = multisetChecksum(data)]() mutable {
+            sort(data);
+            uint64_t sum = multisetChecksum(data);
+            if (sum != expectedSum || !std::is_sorted(data.begin(), data.end())) {
+                throw std::logic_error(name + ": result is not a sorted permutation of the input");
+            }
+            return sum;
+        };
+    };
+}
+
+/**
+ * 基准测试用的临时文件，析构时删除
+ */
+struct TempFile {
+    std::filesystem::path path;
+    ~TempFile() {
+        std::error_code ignored;
+        std::filesystem::remove(path, ignored);
+    }
+};
+
+} // namespace
+
+void registerSortBenchmarks(Registry& registry) {
+    const size_t unlimited = static_cast<size_t>(-1);
+
+    registry.add("sort", "std::sort", unlimited, inPlace([](std::vector<int>& a) {
+        std::sort(a.begin(), a.end());
+    }));
+
+    registry.add("sort", "insertionSort", 1 << 15, inPlace([](std::vector<int>& a) {
+        insertionSort(a);
+    }));
+
+    // 小数组排序的微基准：把输入切成长度为 block 的小段，逐段排序
+    for (int block : {8, 16, 32, 64}) {
+        const std::string suffix = "[" + std::to_string(block) + "]";
+        registry.add("sort", "sortingNetwork" + suffix, unlimited, inPlace([block](std::vector<int>& a) {
+            for (size_t i = 0; i < a.size(); i += block) {
+                sortingNetworkSort(a.data() + i, std::min(a.size() - i, (size_t)block));
+            }
+        }));
+        registry.add("sort", "insertionSort" + suffix, unlimited, inPlace([block](std::vector<int>& a) {
+            for (size_t i = 0; i < a.size(); i += block) {
+                insertionSort(a, (int)i, (int)std::min(a.size(), i + block) - 1);
+            }
+        }));
+    }
+
+    // 堆排序的各用例都用 CountingLess 统计比较次数，计数开销相同，可以直接比较时间与缓存未命中次数
+    registry.add("sort", "heapSort", unlimited, inPlace([](std::vector<int>& a) {
+        heapSort(a, CountingLess<int>());
+    }));
+
+    registry.add("sort", "dAryHeapSort<2>", unlimited, inPlace([](std::vector<int>& a) {
+        dAryHeapSort<2>(a, CountingLess<int>());
+    }));
+
+    registry.add("sort", "dAryHeapSort<4>", unlimited, inPlace([](std::vector<int>& a) {
+        dAryHeapSort<4>(a, CountingLess<int>());
+    }));
+
+    registry.add("sort", "dAryHeapSort<8>", unlimited, inPlace([](std::vector<int>& a) {
+        dAryHeapSort<8>(a, CountingLess<int>());
+    }));
+
+    // Lomuto 划分在有序输入上递归深度为 n，规模过大时会栈溢出
+    registry.add("sort", "quickSort", 1 << 14, inPlace([](std::vector<int>& a) {
+        quickSort(a);
+    }));
+
+    registry.add("sort", "introSort", unlimited, inPlace([](std::vector<int>& a) {
+        introSort(a);
+    }));
+
+    registry.add("sort", "threeWayQuickSort", unlimited, inPlace([](std::vector<int>& a) {
+        threeWayQuickSort(a);
+    }));
+
+    // 经典Hoare划分与块划分使用相同的选基准与递归策略，只比较划分本身
+    registry.add("sort", "hoareQuickSort", unlimited, inPlace([](std::vector<int>& a) {
+        hoareQuickSort(a, PartitionScheme::Hoare);
+    }));
+
+    registry.add("sort", "blockQuickSort", unlimited, inPlace([](std::vector<int>& a) {
+        hoareQuickSort(a, PartitionScheme::Block);
+    }));
+
+    // 线程池在准备阶段创建，计时不包括创建线程的开销
+    for (size_t threads : {2, 4, 8}) {
+        registry.add("sort", "parallelQuickSort[" + std::to_string(threads) + "]", unlimited,
+                     [threads](const std::vector<int>& input) -> Runner {
+            auto pool = std::make_shared<WorkStealingPool>(threads);
+            return [pool, data = input]() mutable {
+                parallelQuickSort(*pool, data);
+                return checksum(data);
+            };
+        });
+    }
+
+    // 归并排序的缓冲区在准备阶段分配，各次运行间复用
+    registry.add("sort", "mergeSort", unlimited, [](const std::vector<int>& input) -> Runner {
+        auto buffer = std::make_shared<std::vector<int>>(input.size());
+        return [buffer, data = input]() mutable {
+            mergeSort(data, *buffer);
+            return checksum(data);
+        };
+    });
+
+    for (size_t threads : {2, 4, 8}) {
+        registry.add("sort", "parallelMergeSort[" + std::to_string(threads) + "]", unlimited,
+                     [threads](const std::vector<int>& input) -> Runner {
+            auto pool = std::make_shared<WorkStealingPool>(threads);
+            auto buffer = std::make_shared<std::vector<int>>(input.size());
+            return [pool, buffer, data = input]() mutable {
+                parallelMergeSort(*pool, data, *buffer);
+                return checksum(data);
+            };
+        });
+    }
+
+    // 缓冲区比输入长，相当于复用了上一次更大规模排序留下的缓冲区，检查排序后数组长度不变；
+    // 两个线程时只有一轮归并，结果留在缓冲区中，需要与数组交换
+    registry.add("sort", "parallelMergeSort[2]<oversizedBuffer>", unlimited, [](const std::vector<int>& input) -> Runner {
+        auto pool = std::make_shared<WorkStealingPool>(2);
+        auto buffer = std::make_shared<std::vector<int>>(2 * input.size() + 1);
+        return [pool, buffer, data = input]() mutable {
+            const size_t n = data.size();
+            parallelMergeSort(*pool, data, *buffer);
+            if (data.size() != n) {
+                throw std::logic_error("parallelMergeSort: reusing an oversized buffer changed the array size");
+            }
+            return checksum(data);
+        };
+    });
+
+    registry.add("sort", "std::stable_sort", unlimited, inPlace([](std::vector<int>& a) {
+        std::stable_sort(a.begin(), a.end());
+    }));
+
+    // 外部排序：输入文件在准备阶段写好，内存预算为数据量的 1/4，计时包括读回输出文件
+    registry.add("sort", "externalSort", unlimited, [](const std::vector<int>& input) -> Runner {
+        const std::filesystem::path dir = std::filesystem::temp_directory_path();
+        auto in = std::make_shared<TempFile>(TempFile{dir / "clrs-bench-external-in.bin"});
+        auto out = std::make_shared<TempFile>(TempFile{dir / "clrs-bench-external-out.bin"});
+        {
+            std::ofstream file(in->path, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char*>(input.data()), (std::streamsize)(input.size() * sizeof(int)));
+        }
+        const size_t budget = std::max<size_t>(1024, input.size() * sizeof(int) / 4);
+        return [in, out, budget, n = input.size()]() {
+            externalSort<int>(in->path.string(), out->path.string(), budget);
+            std::vector<int> sorted(n);
+            std::ifstream file(out->path, std::ios::binary);
+            file.read(reinterpret_cast<char*>(sorted.data()), (std::streamsize)(n * sizeof(int)));
+            return checksum(sorted);
+        };
+    });
+
+    registry.add("sort", "countingSort", unlimited, inPlace([](std::vector<int>& a) {
+        int k = a.empty() ? 0 : *std::max_element(a.begin(), a.end());
+        countingSort(a, k);
+    }));
+
+    // 按键排序 (键, 负载) 记录：工作区与线程池在准备阶段创建并在各次运行间复用
+    using Record = std::pair<int, uint32_t>;
+    auto toRecords = [](const std::vector<int>& input) {
+        std::vector<Record> records(input.size());
+        for (size_t i = 0; i < input.size(); i++) records[i] = {input[i], static_cast<uint32_t>(i)};
+        return records;
+    };
+    auto recordChecksum = [](const std::vector<Record>& records) {
+        std::vector<uint32_t> payloads(records.size());
+        for (size_t i = 0; i < records.size(); i++) payloads[i] = records[i].second;
+        return checksum(payloads);
+    };
+    registry.add("sort", "countingSortByKey", unlimited, [=](const std::vector<int>& input) -> Runner {
+        auto scratch = std::make_shared<CountingSortScratch<Record>>();
+        return [=, data = toRecords(input)]() mutable {
+            countingSortByKey(data, [](const Record& r) { return r.first; }, *scratch);
+            return recordChecksum(data);
+        };
+    });
+    for (size_t threads : {2, 4, 8}) {
+        registry.add("sort", "countingSortByKey[" + std::to_string(threads) + "]", unlimited,
+                     [=](const std::vector<int>& input) -> Runner {
+            auto scratch = std::make_shared<CountingSortScratch<Record>>();
+            auto pool = std::make_shared<WorkStealingPool>(threads);
+            return [=, data = toRecords(input)]() mutable {
+                countingSortByKey(data, [](const Record& r) { return r.first; }, *scratch, pool.get());
+                return recordChecksum(data);
+            };
+        });
+    }
+    registry.add("sort", "std::stable_sort<record>", unlimited, [=](const std::vector<int>& input) -> Runner {
+        return [=, data = toRecords(input)]() mutable {
+            std::stable_sort(data.begin(), data.end(), [](const Record& a, const Record& b) {
+                return a.first < b.first;
+            });
+            return recordChecksum(data);
+        };
+    });
+
+    registry.add("sort", "radixSort", unlimited, inPlace([](std::vector<int>& a) {
+        radixSort(a);
+    }));
+
+    registry.add("sort", "lsdRadixSort", unlimited, inPlace([](std::vector<int>& a) {
+        lsdRadixSort(a);
+    }));
+
+    for (size_t threads : {2, 4, 8}) {
+        registry.add("sort", "parallelMsdRadixSort[" + std::to_string(threads) + "]", unlimited,
+                     [threads](const std::vector<int>& input) -> Runner {
+            auto pool = std::make_shared<WorkStealingPool>(threads);
+            return [pool, data = input]() mutable {
+                parallelMsdRadixSort(*pool, data);
+                return checksum(data);
+            };
+        });
+    }
+
+    // 64 位与浮点键经过键变换后按字节排序，类型转换放在计时之外
+    registry.add("sort", "lsdRadixSort<int64>", unlimited, [](const std::vector<int>& input) -> Runner {
+        std::vector<int64_t> data(input.begin(), input.end());
+        for (int64_t& x : data) x = (x << 32) - x;
+        return [data]() mutable {
+            lsdRadixSort(data);
+            return checksum(data);
+        };
+    });
+
+    registry.add("sort", "lsdRadixSort<double>", unlimited, [](const std::vector<int>& input) -> Runner {
+        std::vector<double> data(input.size());
+        for (size_t i = 0; i < input.size(); i++) {
+            data[i] = static_cast<double>(input[i]) / 3.0 - static_cast<double>(input.size()) / 2.0;
+        }
+        return [data]() mutable {
+            lsdRadixSort(data);
+            return checksum(data);
+        };
+    });
+
+    registry.add("sort", "std::sort<double>", unlimited, [](const std::vector<int>& input) -> Runner {
+        std::vector<double> data(input.size());
+        for (size_t i = 0; i < input.size(); i++) {
+            data[i] = static_cast<double>(input[i]) / 3.0 - static_cast<double>(input.size()) / 2.0;
+        }
+        return [data]() mutable {
+            std::sort(data.begin(), data.end());
+            return checksum(data);
+        };
+    });
+
+    // 浮点输入在计时之外生成：uniform 为 [0, 1) 上的线性映射，skewed 取其四次方，大部分元素集中在 0 附近，
+    // infinite 把两端各 1/16 的元素换成 -∞、+∞，signedZeros 中 -0.0 与 +0.0 各占 1/4，其余元素分布在 0 的两侧
+    struct FloatInput {
+        const char* name;
+        float (*map)(float);
+    };
+    const FloatInput floatInputs[] = {
+        {"uniform", [](float x) { return x; }},
+        {"skewed", [](float x) { return x * x * x * x; }},
+        {"infinite", [](float x) {
+            const float inf = std::numeric_limits<float>::infinity();
+            return x < 0.0625f ? -inf : x >= 0.9375f ? inf : x;
+        }},
+        {"signedZeros", [](float x) { return x < 0.25f ? -0.0f : x < 0.5f ? 0.0f : x - 0.75f; }},
+    };
+    for (const FloatInput& in : floatInputs) {
+        auto toFloats = [map = in.map](const std::vector<int>& input) {
+            std::vector<float> data(input.size());
+            for (size_t i = 0; i < input.size(); i++) {
+                data[i] = map(static_cast<float>(input[i]) / static_cast<float>(input.size()));
+            }
+            return data;
+        };
+        const std::string minMaxName = std::string("bucketSort<") + in.name + ">";
+        registry.add("sort", minMaxName, unlimited, checkedFloatSort(minMaxName, toFloats, [](std::vector<float>& a) {
+            bucketSort(a);
+        }));
+        const std::string sampledName = std::string("bucketSort[sampled]<") + in.name + ">";
+        registry.add("sort", sampledName, unlimited, checkedFloatSort(sampledName, toFloats, [](std::vector<float>& a) {
+            bucketSort(a, BucketSplitters::Sampled);
+        }));
+        registry.add("sort", std::string("std::sort<") + in.name + ">", unlimited,
+                     [toFloats](const std::vector<int>& input) -> Runner {
+            return [data = toFloats(input)]() mutable {
+                std::sort(data.begin(), data.end());
+                return checksum(data);
+            };
+        });
+    }
+}
+
+} // namespace bench
@@ -0,0 +1,63 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#include <set>
+#include <vector>
+
+#include "Benchmark.h"
+#include "C3/U12/BINARY-SEARCH-TREE/BinarySearchTree.h"
+#include "C3/U13/RED-BLACK-TREE/RedBlackTree.h"
+#include "C5/U18/B-TREE/B-Tree.h"
+
+/**
+ * 搜索树类基准测试：依次插入全部元素，再逐个查找
+ */
+namespace bench {
+
+void registerTreeBenchmarks(Registry& registry) {
+    const size_t unlimited = static_cast<size_t>(-1);
+
+    registry.add("tree", "std::set", unlimited, [](const std::vector<int>& input) -> Runner {
+        return [&input]() {
+            std::set<int> tree;
+            for (int key : input) tree.insert(key);
+            uint64_t found = 0;
+            for (int key : input) found += tree.count(key);
+            return found;
+        };
+    });
+
+    // 有序输入下退化为链表，插入和查找都是平方级
+    registry.add("tree", "binarySearchTree", 1 << 14, [](const std::vector<int>& input) -> Runner {
+        return [&input]() {
+            BinarySearchTree tree;
+            for (int key : input) tree.insert(key);
+            uint64_t found = 0;
+            for (int key : input) found += tree.search(key) != nullptr;
+            return found;
+        };
+    });
+
+    registry.add("tree", "redBlackTree", unlimited, [](const std::vector<int>& input) -> Runner {
+        return [&input]() {
+            RedBlackTree tree;
+            for (int key : input) tree.insert(key);
+            uint64_t found = 0;
+            for (int key : input) found += tree.search(key);
+            return found;
+        };
+    });
+
+    registry.add("tree", "bTree", unlimited, [](const std::vector<int>& input) -> Runner {
+        return [&input]() {
+            BTree<int> tree(16);
+            for (int key : input) tree.insert(key);
+            uint64_t found = 0;
+            for (int key : input) found += tree.search(key) != nullptr;
+            return found;
+        };
+    });
+}
+
+} // namespace bench
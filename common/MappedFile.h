@@ -0,0 +1,124 @@
+//
+// Created by HaPpY on 2026/10/17.
+//
+
+#ifndef CLRS_COMMON_MAPPED_FILE_H
+#define CLRS_COMMON_MAPPED_FILE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * 只读映射整个文件
+ *
+ * POSIX 系统上用 mmap 映射，打开时不读取文件内容，页面在第一次访问时才由操作系统载入，
+ * 多个进程映射同一文件时共享页缓存；其他系统上退化为一次性读入内存。
+ * 映射的起始地址按页对齐，文件中按 8 字节对齐存放的数组可以直接按指针访问。
+ *
+ * 用法：
+ *   MappedFile file("table.bin");
+ *   const unsigned char* p = file.data();
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+
+    /**
+     * 映射文件
+     * @param path 文件路径
+     * @throws std::runtime_error 如果文件无法打开或映射
+     */
+    explicit MappedFile(const std::string& path) {
+#if defined(__unix__) || defined(__APPLE__)
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("Cannot open file: " + path);
+        }
+        struct stat st;
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            throw std::runtime_error("Cannot stat file: " + path);
+        }
+        size_ = static_cast<size_t>(st.st_size);
+        if (size_ > 0) {
+            void* p = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED) {
+                ::close(fd);
+                throw std::runtime_error("Cannot map file: " + path);
+            }
+            data_ = static_cast<const unsigned char*>(p);
+        }
+        ::close(fd);
+#else
+        std::ifstream in(path, std::ios::binary);
+        if (!in) {
+            throw std::runtime_error("Cannot open file: " + path);
+        }
+        std::vector<char> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        size_ = bytes.size();
+        // 按 uint64_t 分配，保证 8 字节对齐
+        buffer_.resize((size_ + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+        std::copy(bytes.begin(), bytes.end(), reinterpret_cast<char*>(buffer_.data()));
+        data_ = reinterpret_cast<const unsigned char*>(buffer_.data());
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept
+        : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0)),
+          buffer_(std::move(other.buffer_)) {}
+
+    MappedFile& operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            unmap();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+            buffer_ = std::move(other.buffer_);
+        }
+        return *this;
+    }
+
+    ~MappedFile() {
+        unmap();
+    }
+
+    // 文件内容的起始地址，文件为空时为 nullptr
+    const unsigned char* data() const { return data_; }
+
+    // 文件大小（字节）
+    size_t size() const { return size_; }
+
+private:
+    void unmap() {
+#if defined(__unix__) || defined(__APPLE__)
+        if (data_ != nullptr) {
+            ::munmap(const_cast<unsigned char*>(data_), size_);
+        }
+#endif
+        data_ = nullptr;
+        size_ = 0;
+        buffer_.clear();
+    }
+
+    const unsigned char* data_ = nullptr;
+    size_t size_ = 0;
+    std::vector<uint64_t> buffer_;  // 不支持 mmap 时存放读入的内容
+};
+
+#endif //CLRS_COMMON_MAPPED_FILE_H
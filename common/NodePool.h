@@ -0,0 +1,145 @@
+//
+// Created by HaPpY on 2026/10/17.
+//
+
+#ifndef CLRS_COMMON_NODE_POOL_H
+#define CLRS_COMMON_NODE_POOL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * 节点池（slab 分配器）
+ *
+ * 为链式数据结构（斐波那契堆等）成批分配固定大小的节点：
+ * - 节点从大块内存（slab）中顺序切出，slab 的容量从 kFirstSlab 开始翻倍，直到 kMaxSlab；
+ * - destroy() 把节点放入空闲列表，下一次 create() 优先复用，不调用 operator delete；
+ * - reset() 一次性作废全部节点但保留 slab，O(1)，之后的 create() 从头复用这些内存；
+ * - 析构时按 slab 释放，n 个节点只需 O(log n + n / kMaxSlab) 次 operator delete。
+ * 节点必须是平凡析构的，reset() 与析构时不逐个调用析构函数。
+ *
+ * 用法：
+ *   NodePool<Node> pool;
+ *   Node* x = pool.create(key);
+ *   pool.destroy(x);
+ *   pool.reset();       // 作废全部节点
+ */
+template<typename T>
+class NodePool {
+    static_assert(std::is_trivially_destructible<T>::value, "NodePool requires trivially destructible nodes");
+
+public:
+    // 第一个 slab 的节点数
+    static constexpr size_t kFirstSlab = 64;
+    // 单个 slab 的最大节点数
+    static constexpr size_t kMaxSlab = size_t(1) << 16;
+
+    NodePool() = default;
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    /**
+     * 构造一个节点，优先复用 destroy() 归还的节点
+     */
+    template<typename... Args>
+    T* create(Args&&... args) {
+        void* p;
+        if (!free_.empty()) {
+            p = free_.back();
+            free_.pop_back();
+        } else {
+            while (current_ < slabs_.size() && used_ == slabs_[current_].size) {
+                current_++;
+                used_ = 0;
+            }
+            if (current_ == slabs_.size()) {
+                addSlab();
+            }
+            p = &slabs_[current_].slots[used_++];
+        }
+        live_++;
+        return ::new (p) T(std::forward<Args>(args)...);
+    }
+
+    /**
+     * 归还节点，之后 node 不能再使用
+     */
+    void destroy(T* node) {
+        free_.push_back(node);
+        live_--;
+    }
+
+    /**
+     * 作废全部节点，保留已分配的 slab 供之后复用
+     */
+    void reset() {
+        free_.clear();
+        current_ = 0;
+        used_ = 0;
+        live_ = 0;
+    }
+
+    /**
+     * 接管 other 中已使用的 slab 与空闲节点，other 中的节点随后属于本池
+     * 数据结构合并（如 FibonacciHeap::unite）时调用，O(other 的 slab 数 + 空闲节点数)。
+     * other 保留尚未使用的 slab，之后仍可继续分配。
+     */
+    void splice(NodePool& other) {
+        if (&other == this) {
+            return;
+        }
+        size_t moved = other.current_ + (other.used_ > 0 ? 1 : 0);
+        moved = std::min(moved, other.slabs_.size());
+        // 接管的 slab 插在本池当前 slab 之前，视为已用完，不会被顺序分配覆盖
+        slabs_.insert(slabs_.begin() + static_cast<std::ptrdiff_t>(current_),
+                      std::make_move_iterator(other.slabs_.begin()),
+                      std::make_move_iterator(other.slabs_.begin() + static_cast<std::ptrdiff_t>(moved)));
+        current_ += moved;
+        other.slabs_.erase(other.slabs_.begin(), other.slabs_.begin() + static_cast<std::ptrdiff_t>(moved));
+        other.current_ = 0;
+        other.used_ = 0;
+
+        free_.insert(free_.end(), other.free_.begin(), other.free_.end());
+        other.free_.clear();
+        live_ += other.live_;
+        other.live_ = 0;
+    }
+
+    // 尚未归还的节点数
+    size_t live() const { return live_; }
+
+    // 已分配的 slab 个数，即析构时 operator delete 的调用次数
+    size_t slabCount() const { return slabs_.size(); }
+
+private:
+    // 与 T 大小、对齐相同的未初始化存储
+    struct alignas(T) Slot {
+        unsigned char bytes[sizeof(T)];
+    };
+
+    struct Slab {
+        std::unique_ptr<Slot[]> slots;
+        size_t size;
+    };
+
+    void addSlab() {
+        size_t size = slabs_.empty() ? kFirstSlab : std::min(kMaxSlab, slabs_.back().size * 2);
+        slabs_.push_back(Slab{std::unique_ptr<Slot[]>(new Slot[size]), size});
+        used_ = 0;
+    }
+
+    std::vector<Slab> slabs_;   // slabs_[0, current_) 已用完，slabs_[current_] 已用去 used_ 个节点
+    size_t current_ = 0;
+    size_t used_ = 0;
+    std::vector<T*> free_;      // destroy() 归还的节点
+    size_t live_ = 0;
+};
+
+#endif //CLRS_COMMON_NODE_POOL_H
@@ -0,0 +1,222 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#ifndef CLRS_COMMON_TRACE_H
+#define CLRS_COMMON_TRACE_H
+
+/**
+ * 全书共用的追踪输出设施
+ *
+ * 追踪级别在编译期通过 CLRS_TRACE_LEVEL 选择：
+ *   CLRS_TRACE_OFF     (0) 不输出任何追踪信息，宏展开为空语句，只剩算法本身
+ *   CLRS_TRACE_SUMMARY (1) 输出每次调用的阶段信息，并在程序退出时汇总计数器
+ *   CLRS_TRACE_STEP    (2) 在 SUMMARY 的基础上输出逐步演示过程
+ *
+ * 用法：
+ *   TRACE_SUMMARY("开始快速排序..." << std::endl);
+ *   TRACE_STEP("交换 arr[" << i << "] 和 arr[" << j << "]" << std::endl);
+ *   TRACE_COUNT("quickSort.swaps");
+ *   TRACE_STEP_EXEC(printTree());   // 只在 STEP 级别执行的打印语句
+ *
+ * 宏参数只在对应级别下求值，因此参数中不能带有算法需要的副作用。
+ * 模板化的算法在 STEP 级别下会输出元素本身，此时元素类型需要支持 operator<<；
+ * OFF 级别没有这一要求。
+ */
+
+#define CLRS_TRACE_OFF 0
+#define CLRS_TRACE_SUMMARY 1
+#define CLRS_TRACE_STEP 2
+
+#ifndef CLRS_TRACE_LEVEL
+#define CLRS_TRACE_LEVEL CLRS_TRACE_OFF
+#endif
+
+#if CLRS_TRACE_LEVEL > CLRS_TRACE_OFF
+
+#include <atomic>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace trace {
+
+/**
+ * 具名计数器，同名计数器共享同一个实例
+ */
+class Counter {
+public:
+    void add(unsigned long long n) {
+        value_.fetch_add(n, std::memory_order_relaxed);
+    }
+
+    unsigned long long value() const {
+        return value_.load(std::memory_order_relaxed);
+    }
+
+    void reset() {
+        value_.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<unsigned long long> value_{0};
+};
+
+/**
+ * 计数器注册表，程序退出时把非零计数器汇总到标准输出
+ */
+class Registry {
+public:
+    static Registry& instance() {
+        static Registry registry;
+        return registry;
+    }
+
+    Counter& counter(const std::string& name) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return counters_[name];  // std::map 的节点地址稳定，可以长期持有引用
+    }
+
+    unsigned long long value(const std::string& name) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = counters_.find(name);
+        return it == counters_.end() ? 0 : it->second.value();
+    }
+
+    void reset() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& entry : counters_) {
+            entry.second.reset();
+        }
+    }
+
+    void report(std::ostream& os) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        bool header = false;
+        for (const auto& entry : counters_) {
+            if (entry.second.value() == 0) continue;
+            if (!header) {
+                os << "[trace] 计数器汇总:" << std::endl;
+                header = true;
+            }
+            os << "[trace]   " << entry.first << " = " << entry.second.value() << std::endl;
+        }
+    }
+
+    ~Registry() {
+        report(std::cout);
+    }
+
+private:
+    Registry() = default;
+
+    std::mutex mutex_;
+    std::map<std::string, Counter> counters_;
+};
+
+inline Counter& counter(const char* name) {
+    return Registry::instance().counter(name);
+}
+
+inline unsigned long long value(const char* name) {
+    return Registry::instance().value(name);
+}
+
+inline void reset() {
+    Registry::instance().reset();
+}
+
+inline void report(std::ostream& os = std::cout) {
+    Registry::instance().report(os);
+}
+
+/**
+ * 缩进，depth 每增加一层多输出两个空格
+ */
+struct Indent {
+    int depth;
+};
+
+inline Indent indent(int depth) {
+    return {depth};
+}
+
+inline std::ostream& operator<<(std::ostream& os, Indent in) {
+    for (int i = 0; i < in.depth; i++) os << "  ";
+    return os;
+}
+
+/**
+ * 闭区间 [first, last] 内的元素，以空格分隔
+ */
+template<typename Container>
+struct Range {
+    const Container& c;
+    long first;
+    long last;
+};
+
+template<typename Container>
+Range<Container> range(const Container& c, long first, long last) {
+    return {c, first, last};
+}
+
+template<typename Container>
+std::ostream& operator<<(std::ostream& os, const Range<Container>& r) {
+    for (long k = r.first; k <= r.last; k++) {
+        os << r.c[k] << " ";
+    }
+    return os;
+}
+
+/**
+ * 容器中的全部元素，以空格分隔（也适用于 std::list 等不支持下标的容器）
+ */
+template<typename Container>
+struct Items {
+    const Container& c;
+};
+
+template<typename Container>
+Items<Container> range(const Container& c) {
+    return {c};
+}
+
+template<typename Container>
+std::ostream& operator<<(std::ostream& os, const Items<Container>& items) {
+    for (const auto& value : items.c) {
+        os << value << " ";
+    }
+    return os;
+}
+
+} // namespace trace
+
+#endif
+
+#if CLRS_TRACE_LEVEL >= CLRS_TRACE_SUMMARY
+#define TRACE_SUMMARY(...) do { std::cout << __VA_ARGS__; } while (0)
+#define TRACE_SUMMARY_EXEC(...) do { __VA_ARGS__; } while (0)
+#define TRACE_COUNT_ADD(name, n) \
+    do { \
+        static ::trace::Counter& clrs_trace_counter_ = ::trace::counter(name); \
+        clrs_trace_counter_.add(n); \
+    } while (0)
+#else
+#define TRACE_SUMMARY(...) do { } while (0)
+#define TRACE_SUMMARY_EXEC(...) do { } while (0)
+#define TRACE_COUNT_ADD(name, n) do { } while (0)
+#endif
+
+#if CLRS_TRACE_LEVEL >= CLRS_TRACE_STEP
+#define TRACE_STEP(...) do { std::cout << __VA_ARGS__; } while (0)
+#define TRACE_STEP_EXEC(...) do { __VA_ARGS__; } while (0)
+#else
+#define TRACE_STEP(...) do { } while (0)
+#define TRACE_STEP_EXEC(...) do { } while (0)
+#endif
+
+#define TRACE_COUNT(name) TRACE_COUNT_ADD(name, 1)
+
+#endif //CLRS_COMMON_TRACE_H
@@ -0,0 +1,200 @@
+//
+// Created by HaPpY on 2026/10/16.
+//
+
+#ifndef CLRS_COMMON_WORK_STEALING_POOL_H
+#define CLRS_COMMON_WORK_STEALING_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * 工作窃取线程池
+ *
+ * 每个线程（包括调用 wait() 的线程）有自己的任务队列：
+ *   自己提交的任务压入自己队列的尾部，也从尾部取出（后进先出，缓存友好）；
+ *   自己的队列空了就从其他队列的头部窃取（先进先出，窃取到的通常是较大的任务）。
+ * 适合快速排序这类分治算法：任务在执行过程中不断派生新任务，负载自动在线程间均衡。
+ *
+ * 用法：
+ *   WorkStealingPool pool(8);
+ *   pool.submit([&] { ... pool.submit(...); ... });
+ *   pool.wait();   // 调用线程也参与执行，直到所有任务（包括派生出的任务）完成
+ */
+class WorkStealingPool {
+public:
+    /**
+     * @param threads 参与计算的线程总数（包括调用 wait() 的线程），0 表示使用硬件线程数
+     */
+    explicit WorkStealingPool(size_t threads = 0) {
+        if (threads == 0) {
+            threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+        // 队列 0 属于调用 wait() 的线程，其余各属于一个工作线程
+        for (size_t i = 0; i < threads; i++) {
+            queues_.push_back(std::make_unique<Queue>());
+        }
+        for (size_t i = 1; i < threads; i++) {
+            workers_.emplace_back([this, i] { workerLoop(i); });
+        }
+    }
+
+    ~WorkStealingPool() {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex_);
+            stop_ = true;
+        }
+        wakeup_.notify_all();
+        for (std::thread& t : workers_) {
+            t.join();
+        }
+    }
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    /**
+     * 参与计算的线程总数
+     */
+    size_t size() const {
+        return queues_.size();
+    }
+
+    /**
+     * 提交一个任务
+     * 在池内线程上调用时压入该线程自己的队列，否则压入调用线程的队列 0
+     */
+    void submit(std::function<void()> task) {
+        pending_.fetch_add(1, std::memory_order_relaxed);
+        size_t self = currentIndex();
+        {
+            std::lock_guard<std::mutex> lock(queues_[self]->mutex);
+            queues_[self]->tasks.push_back(std::move(task));
+        }
+        queued_.fetch_add(1, std::memory_order_release);
+        // 先获取一次睡眠锁，避免工作线程在检查条件之后、进入等待之前错过通知
+        { std::lock_guard<std::mutex> lock(sleepMutex_); }
+        wakeup_.notify_one();
+    }
+
+    /**
+     * 调用线程参与执行，直到所有已提交的任务及其派生任务完成
+     * 只能在池外的线程上调用，任务内部不应调用 wait()
+     * @throws 任务抛出的第一个异常，在所有任务结束后重新抛出
+     */
+    void wait() {
+        current() = this;
+        index() = 0;
+        while (pending_.load(std::memory_order_acquire) > 0) {
+            if (!runOne(0)) {
+                std::this_thread::yield();
+            }
+        }
+        current() = nullptr;
+
+        std::exception_ptr error;
+        {
+            std::lock_guard<std::mutex> lock(errorMutex_);
+            std::swap(error, error_);
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    // 当前线程所属的线程池及其队列编号
+    static const WorkStealingPool*& current() {
+        static thread_local const WorkStealingPool* pool = nullptr;
+        return pool;
+    }
+
+    static size_t& index() {
+        static thread_local size_t i = 0;
+        return i;
+    }
+
+    size_t currentIndex() const {
+        return current() == this ? index() : 0;
+    }
+
+    /**
+     * 取出并执行一个任务：先查自己的队列尾部，再依次窃取其他队列的头部
+     * @return 执行了任务返回true
+     */
+    bool runOne(size_t self) {
+        std::function<void()> task;
+        {
+            Queue& own = *queues_[self];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if (!own.tasks.empty()) {
+                task = std::move(own.tasks.back());
+                own.tasks.pop_back();
+            }
+        }
+        for (size_t k = 1; !task && k < queues_.size(); k++) {
+            Queue& victim = *queues_[(self + k) % queues_.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.tasks.empty()) {
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+            }
+        }
+        if (!task) {
+            return false;
+        }
+
+        queued_.fetch_sub(1, std::memory_order_relaxed);
+        try {
+            task();
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex_);
+            if (!error_) error_ = std::current_exception();
+        }
+        pending_.fetch_sub(1, std::memory_order_acq_rel);
+        return true;
+    }
+
+    void workerLoop(size_t self) {
+        current() = this;
+        index() = self;
+        while (true) {
+            if (runOne(self)) {
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(sleepMutex_);
+            wakeup_.wait(lock, [this] {
+                return stop_ || queued_.load(std::memory_order_acquire) > 0;
+            });
+            if (stop_) {
+                return;
+            }
+        }
+    }
+
+    std::vector<std::unique_ptr<Queue>> queues_;
+    std::vector<std::thread> workers_;
+    std::atomic<long> pending_{0};  // 已提交但尚未执行完的任务数
+    std::atomic<long> queued_{0};   // 仍在队列中等待执行的任务数
+    std::mutex sleepMutex_;
+    std::condition_variable wakeup_;
+    bool stop_ = false;
+    std::mutex errorMutex_;
+    std::exception_ptr error_;
+};
+
+#endif //CLRS_COMMON_WORK_STEALING_POOL_H